@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Module:        CTBlit
+// Description:   Burst copies of pixel rectangles into framebuffer memory.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+/**
+ * @file TBlit.h
+ * @brief Declares the presentation blitter of the shadow buffer.
+ * @details The framebuffer is GPU memory that the ARM maps uncached (or write
+ * combined): every store is a bus transaction of its own unless the stores
+ * are wide and back to back. CBcmFrameBuffer::SetArea() copies whole pixel
+ * lines of the area. CTBlit copies only the byte span that changed and
+ * groups the stores of each pixel line into aligned bursts of BurstBytes.
+ */
+
+/**
+ * @class CTBlit
+ * @brief Rectangle copy with 32-byte bursts, and a byte-wise reference.
+ * @details Copy() aligns the destination of every line to BurstBytes with
+ * single bytes and words, then moves BurstBytes at a time: eight words are
+ * loaded before the first one is stored, which the ARM compilers emit as
+ * one LDM/STM pair. Source and destination with a different word alignment
+ * fall back to memcpy(). Callers round the span out to BurstBytes
+ * (AlignDown()/AlignUp()) so that no line starts or ends with single stores.
+ *
+ * CopyReference() does the same copy byte by byte; it is the expected
+ * result for VT100_BENCH and builds everywhere.
+ */
+class CTBlit
+{
+public:
+    static constexpr unsigned BurstBytes = 32;
+
+    /// \brief Copy nLines lines of nBytes each, in bursts where the alignment allows.
+    /// \param pDest First destination byte; lines are nDestPitch bytes apart.
+    /// \param pSource First source byte; lines are nSourcePitch bytes apart.
+    static void Copy(u8 *pDest, unsigned nDestPitch, const u8 *pSource, unsigned nSourcePitch,
+                     unsigned nBytes, unsigned nLines);
+
+    /// \brief Byte-wise copy with the same arguments as Copy().
+    static void CopyReference(u8 *pDest, unsigned nDestPitch, const u8 *pSource, unsigned nSourcePitch,
+                              unsigned nBytes, unsigned nLines);
+
+    /// \brief Round a byte offset down to a burst boundary.
+    static unsigned AlignDown(unsigned nOffset) { return nOffset & ~(BurstBytes - 1); }
+
+    /// \brief Round a byte offset up to a burst boundary, but not beyond nLimit.
+    static unsigned AlignUp(unsigned nOffset, unsigned nLimit)
+    {
+        const unsigned nAligned = (nOffset + BurstBytes - 1) & ~(BurstBytes - 1);
+        return nAligned < nLimit ? nAligned : nLimit;
+    }
+
+private:
+    /// \brief Copy one line of Copy().
+    static void CopyLine(u8 *pDest, const u8 *pSource, unsigned nBytes);
+};
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+// Module:        CTCellBuffer
+// Description:   Character/attribute grid mirroring the renderer's pixel screen.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Per-row checksum trees for DECRQCRA
+// 2026-10-18     R. Zuehlsdorff        Content exchange for virtual consoles
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+/**
+ * @file TCellBuffer.h
+ * @brief Declares the text cell grid kept alongside the pixel shadow buffer.
+ * @details The renderer draws straight into pixels, so the characters on screen
+ * cannot be recovered from the framebuffer. CTCellBuffer records the character
+ * and attribute of every cell as it is drawn, erased or scrolled. Each row
+ * carries a generation number taken from a buffer-wide sequence so consumers
+ * (warm resume, screen queries) can find rows changed since they last looked.
+ * Each row also keeps a Fenwick tree of DEC cell checksum weights, so the sum
+ * of any column span costs O(log columns) instead of a scan of the row.
+ */
+
+/**
+ * @class CTCellBuffer
+ * @brief Row-major grid of character cells with per-row change generations.
+ * @details The buffer is owned by CTRenderer and mutated only under the
+ * renderer lock. Erased cells hold a blank with no attributes. All mutating
+ * operations clamp their arguments to the current geometry.
+ */
+class CTCellBuffer
+{
+public:
+    /// \brief One character cell: the byte as received and its attribute bits.
+    struct TCell
+    {
+        u8 ch;
+        u8 attr;
+    };
+
+    /// \brief Attribute bits stored per cell.
+    enum TAttribute : u8
+    {
+        AttrNone = 0x00,
+        AttrBold = 0x01,
+        AttrUnderline = 0x02,
+        AttrBlink = 0x04,
+        AttrReverse = 0x08,
+        AttrDim = 0x10,
+        AttrGraphics = 0x20 ///< Drawn from the DEC special graphics set
+    };
+
+    static constexpr u8 BlankChar = ' ';
+
+    CTCellBuffer(void);
+    ~CTCellBuffer(void);
+
+    /// \brief Change the grid geometry, keeping the overlapping top-left area.
+    /// \param nColumns New number of columns.
+    /// \param nRows New number of rows.
+    /// \return TRUE on success, FALSE if memory could not be allocated.
+    boolean Resize(unsigned nColumns, unsigned nRows);
+
+    unsigned GetColumns(void) const { return m_nColumns; }
+    unsigned GetRows(void) const { return m_nRows; }
+
+    /// \brief Blank every cell.
+    void Clear(void);
+
+    /// \brief Swap contents and geometry with another buffer without copying cells.
+    /// \details Both buffers continue from the larger generation so row
+    /// generations stay monotonic for consumers of either buffer.
+    void Exchange(CTCellBuffer &rOther);
+
+    /// \brief Mark every row as changed, e.g. after Exchange() put new contents on screen.
+    void TouchAll(void);
+
+    /// \brief Store a character at a cell position.
+    void PutChar(unsigned nRow, unsigned nColumn, u8 chChar, u8 nAttr);
+
+    /// \brief Blank the cells [nFirstColumn, nEndColumn) of one row.
+    void EraseRange(unsigned nRow, unsigned nFirstColumn, unsigned nEndColumn);
+
+    /// \brief Blank the rows [nFirstRow, nEndRow).
+    void EraseRows(unsigned nFirstRow, unsigned nEndRow);
+
+    /// \brief Move rows [nTopRow, nEndRow) up by nCount, blanking at the bottom.
+    void ScrollUp(unsigned nTopRow, unsigned nEndRow, unsigned nCount);
+
+    /// \brief Move rows [nTopRow, nEndRow) down by nCount, blanking at the top.
+    void ScrollDown(unsigned nTopRow, unsigned nEndRow, unsigned nCount);
+
+    /// \brief Delete nCount cells at a position, shifting the row tail left.
+    void DeleteChars(unsigned nRow, unsigned nColumn, unsigned nCount);
+
+    /// \brief Replace one row with caller-provided cells.
+    /// \param nRow Row index.
+    /// \param pCells Source cells, nCount entries (clamped to the row width).
+    /// \param nCount Number of cells provided; missing cells are blanked.
+    void SetRow(unsigned nRow, const TCell *pCells, unsigned nCount);
+
+    /// \brief Read access to one row (nullptr if out of range).
+    const TCell *GetRow(unsigned nRow) const;
+
+    /// \brief Generation of the last change to a row (0 if out of range).
+    u32 GetRowGeneration(unsigned nRow) const;
+
+    /// \brief Generation of the most recent change anywhere in the buffer.
+    u32 GetGeneration(void) const { return m_nGeneration; }
+
+    /// \brief Sum of the cell checksum weights in a rectangle (modulo 2^16).
+    /// \param nFirstRow First row (based on 0).
+    /// \param nEndRow One past the last row.
+    /// \param nFirstColumn First column (based on 0).
+    /// \param nEndColumn One past the last column.
+    /// \return Sum over the clamped rectangle, 0 if it is empty.
+    u16 GetChecksum(unsigned nFirstRow, unsigned nEndRow, unsigned nFirstColumn, unsigned nEndColumn) const;
+
+    /// \brief DEC checksum weight of one cell: character code plus rendition weights.
+    static u16 GetCellWeight(const TCell &rCell);
+
+private:
+    /// \brief Record a change to the rows [nFirstRow, nEndRow).
+    void Touch(unsigned nFirstRow, unsigned nEndRow);
+    /// \brief Blank nCount cells starting at pCell.
+    static void Blank(TCell *pCell, unsigned nCount);
+    /// \brief Rebuild the checksum trees of the rows [nFirstRow, nEndRow).
+    void RebuildSums(unsigned nFirstRow, unsigned nEndRow);
+    /// \brief Add a weight delta to one cell of a row's checksum tree.
+    void AddSum(unsigned nRow, unsigned nColumn, u16 nDelta);
+    /// \brief Sum of the first nCount cell weights of a row.
+    u16 PrefixSum(unsigned nRow, unsigned nCount) const;
+
+    TCell *m_pCells;
+    u16 *m_pRowSums;
+    u32 *m_pRowGenerations;
+    unsigned m_nColumns;
+    unsigned m_nRows;
+    u32 m_nGeneration;
+};
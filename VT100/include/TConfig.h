@@ -253,6 +253,81 @@ public:
     /// \param enabled TRUE to enable margin bell.
     void SetMarginBellEnabled(boolean enabled);
 
+    /// \brief Query whether the screen is persisted and restored across reboots.
+    /// \return TRUE if enabled.
+    boolean GetWarmResumeEnabled(void) const { return m_WarmResumeEnabled != 0; }
+    /// \brief Enable or disable warm resume of the screen contents.
+    /// \param enabled TRUE to persist the screen to SD and restore it on boot.
+    void SetWarmResumeEnabled(boolean enabled);
+
+    /// \brief Query the predictive local echo mode for TCP host sessions.
+    /// \return 0=off, 1=adaptive (shown when the measured RTT is high), 2=always shown.
+    unsigned GetPredictiveEcho(void) const { return m_PredictiveEcho; }
+    /// \brief Set the predictive local echo mode.
+    /// \param mode 0=off, 1=adaptive, 2=always (clamped).
+    void SetPredictiveEcho(unsigned mode);
+
+    /// \brief Query whether the serial and TCP hosts get separate virtual consoles.
+    /// \return TRUE if enabled.
+    boolean GetVirtualConsolesEnabled(void) const { return m_VirtualConsolesEnabled != 0; }
+    /// \brief Enable or disable virtual consoles.
+    /// \param enabled TRUE to keep one console per host, switched with F9.
+    void SetVirtualConsolesEnabled(boolean enabled);
+
+    /// \brief Query the CRT scan-line strength.
+    /// \return Darkening of every second scan line in percent (0-100).
+    unsigned GetCrtScanlines(void) const { return m_CrtScanlines; }
+    /// \brief Set the CRT scan-line strength in percent (clamped to 100).
+    void SetCrtScanlines(unsigned percent);
+
+    /// \brief Query the CRT horizontal bloom strength.
+    /// \return Spill of lit dots into their neighbours in percent (0-100).
+    unsigned GetCrtBloom(void) const { return m_CrtBloom; }
+    /// \brief Set the CRT bloom strength in percent (clamped to 100).
+    void SetCrtBloom(unsigned percent);
+
+    /// \brief Query the configured CRT glow strength.
+    /// \return Halo strength around glyph strokes in percent (0-100).
+    unsigned GetCrtGlow(void) const { return m_CrtGlow; }
+    /// \brief Glow strength for the configured text color; only amber and green phosphor glow.
+    unsigned GetCrtGlowForTextColor(void) const
+    {
+        return (m_TextColorIndex == TerminalColorAmber || m_TextColorIndex == TerminalColorGreen) ? m_CrtGlow : 0;
+    }
+    /// \brief Set the CRT glow strength in percent (clamped to 100).
+    void SetCrtGlow(unsigned percent);
+
+    /// \brief Query whether the renderer draws straight into the framebuffer.
+    /// \return TRUE to render without a shadow buffer; read once at startup.
+    boolean GetDirectRenderEnabled(void) const { return m_DirectRenderEnabled != 0; }
+
+    /// \brief Query whether telnet clients are offered MCCP2 stream compression.
+    boolean GetTelnetCompressEnabled(void) const { return m_TelnetCompressEnabled != 0; }
+
+    /// \brief Query whether printer controller mode (CSI 5 i) captures host data to SD.
+    /// \return TRUE to write print jobs to SD:/PRINTnnn.TXT; read once at startup.
+    boolean GetPrintCaptureEnabled(void) const { return m_PrintCaptureEnabled != 0; }
+
+    /// \brief Query whether the renderer primitives are benchmarked at boot.
+    /// \return TRUE to run CTRenderBench once after the renderer is up.
+    boolean GetRenderBenchEnabled(void) const { return m_RenderBenchEnabled != 0; }
+
+    /// \brief Query whether screen log lines go to the F8 log pane.
+    /// \return TRUE to keep log output off the host screen; read once at startup.
+    boolean GetLogPaneEnabled(void) const { return m_LogPaneEnabled != 0; }
+
+    /// \brief Seconds without progress after which a loop counts as stalled.
+    /// \return 0 to trace only, otherwise 1..60; read once at startup.
+    unsigned int GetStallTimeout(void) const { return m_StallTimeout; }
+
+    /// \brief Query whether a stall that does not end resets the board.
+    /// \return TRUE to arm the hardware watchdog; read once at startup.
+    boolean GetStallRebootEnabled(void) const { return m_StallRebootEnabled != 0; }
+
+    /// \brief PC samples per second taken from boot on.
+    /// \return 0 to start sampling only on request, otherwise 10..10000; read once at startup.
+    unsigned int GetProfileRate(void) const { return m_ProfileRate; }
+
     // --- End Configuration Parameters ---
 
     /// \brief Decode the log output bitmask into individual booleans.
@@ -315,9 +390,23 @@ private:
     unsigned int m_SerialParityMode;        // UART parity (0=none, 1=even, 2=odd)
     unsigned int m_SoftwareFlowControl;     // 0=off, 1=on software flow control (XON/XOFF)
     unsigned int m_MarginBellEnabled;       // 0=off, 1=on margin bell (8 columns before right margin)
+    unsigned int m_WarmResumeEnabled;       // 0=off, 1=on persist/restore screen across reboots
+    unsigned int m_PredictiveEcho;          // 0=off, 1=adaptive, 2=always predictive echo in TCP host mode
+    unsigned int m_VirtualConsolesEnabled;  // 0=off shared screen, 1=on one console per host (F9 switches)
+    unsigned int m_CrtScanlines;            // 0-100% darkening of every second scan line
+    unsigned int m_CrtBloom;                // 0-100% horizontal bloom next to lit dots
+    unsigned int m_CrtGlow;                 // 0-100% halo around strokes (amber/green text only)
+    unsigned int m_DirectRenderEnabled;     // 0=shadow buffer, 1=draw straight into the framebuffer
+    unsigned int m_TelnetCompressEnabled;   // 0=off, 1=offer MCCP2 (telnet COMPRESS2) to log clients
+    unsigned int m_PrintCaptureEnabled;     // 0=CSI 5 i ignored, 1=print jobs written to SD
+    unsigned int m_RenderBenchEnabled;      // 0=off, 1=log cycle counts of the drawing primitives at boot
+    unsigned int m_LogPaneEnabled;          // 0=log lines written over the screen, 1=F8 log pane
+    unsigned int m_StallTimeout;            // 0=off, 1-60 seconds without progress until a stall report
+    unsigned int m_StallRebootEnabled;      // 0=off, 1=hardware watchdog resets the board on a lasting stall
+    unsigned int m_ProfileRate;             // 0=off, 10-10000 PC samples per second from boot
     char m_LogFileName[64];                 // Log filename (string, special handling)
     bool m_TabStops[TabStopsMax];           // Tab stop positions (0-based columns)
 
     static const char ConfigFileName[];
-    TConfigParam s_ConfigParams[24]; // Instance array for config params
+    TConfigParam s_ConfigParams[38]; // Instance array for config params
 };
@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// Module:        CTDeflateStream
+// Description:   Fixed-memory zlib stream compressor for the telnet console.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+#include <stddef.h>
+
+/**
+ * @file TDeflateStream.h
+ * @brief Declares the small deflate encoder behind MCCP2 (telnet COMPRESS2).
+ * @details MCCP2 turns everything the server sends after the negotiation into
+ * one zlib stream. Console output is short, repetitive text (log prefixes, hex
+ * dumps), so a 4 KiB window with fixed Huffman codes already removes most of
+ * it. All state lives in the object: window, hash heads and chains take about
+ * 24 KiB and nothing is allocated while compressing.
+ */
+
+/**
+ * @class CTDeflateStream
+ * @brief Streaming deflate encoder with fixed Huffman and stored blocks.
+ * @details The caller hands in at most MaxInputChunk bytes per call and
+ * provides an output buffer of MaxOutput() bytes. Compress() runs the LZ77
+ * matcher, Store() only frames the data (cheap fallback under CPU load); both
+ * add the data to the window and the Adler-32 checksum, so they can be mixed
+ * freely. Flush() ends the pending output on a byte boundary (zlib sync flush),
+ * after which the peer can decode everything sent so far.
+ */
+class CTDeflateStream
+{
+public:
+    static constexpr unsigned WindowBits = 12;
+    static constexpr unsigned WindowSize = 1U << WindowBits;
+    static constexpr unsigned HashBits = 11;
+    static constexpr unsigned HashSize = 1U << HashBits;
+    static constexpr unsigned MaxChain = 8;
+    static constexpr unsigned MinMatch = 3;
+    static constexpr unsigned MaxMatch = 258;
+    static constexpr size_t MaxInputChunk = 1024;
+
+    /// \brief Worst-case output of one call with nLength input bytes, including header and flush.
+    static constexpr size_t MaxOutput(size_t nLength) { return nLength + nLength / 8 + 32; }
+
+    CTDeflateStream(void);
+
+    /// \brief Start a new stream; the next call emits the zlib header.
+    void Reset(void);
+
+    /// \brief Compress data with LZ77 matching and fixed Huffman codes.
+    /// \return Number of bytes written to pOut.
+    size_t Compress(const void *pData, size_t nLength, u8 *pOut);
+
+    /// \brief Emit data as a stored block without matching.
+    /// \return Number of bytes written to pOut.
+    size_t Store(const void *pData, size_t nLength, u8 *pOut);
+
+    /// \brief Close the open block and align the stream (empty stored block).
+    /// \return Number of bytes written to pOut.
+    size_t Flush(u8 *pOut);
+
+    /// \brief End the stream with a final block and the Adler-32 trailer.
+    /// \return Number of bytes written to pOut.
+    size_t Finish(u8 *pOut);
+
+private:
+    static constexpr u16 NoPosition = 0xFFFF;
+
+    /// \brief Append input to the window, sliding it by WindowSize when full.
+    void AppendWindow(const u8 *pData, size_t nLength);
+    /// \brief Insert the three-byte string at window position nPos into the hash chains.
+    void InsertString(unsigned nPos);
+    /// \brief Find the longest match for the string at nPos before nEnd.
+    unsigned FindMatch(unsigned nPos, unsigned nEnd, unsigned &rDistance) const;
+    /// \brief Emit the zlib header once per stream.
+    void BeginStream(void);
+    /// \brief End an open fixed Huffman block with the end-of-block code.
+    void CloseBlock(void);
+    void PutBits(u32 nValue, unsigned nCount);
+    void PutLiteral(unsigned nSymbol);
+    void PutMatch(unsigned nLength, unsigned nDistance);
+    void AlignByte(void);
+    void UpdateAdler(const u8 *pData, size_t nLength);
+
+    u8 m_Window[2 * WindowSize];
+    u16 m_Head[HashSize];
+    u16 m_Prev[WindowSize];
+    unsigned m_nWindowEnd;
+
+    u32 m_nBitBuffer;
+    unsigned m_nBitCount;
+    u8 *m_pOut;
+    boolean m_bStarted;
+    boolean m_bInBlock;
+    u32 m_nAdler;
+};
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// Module:        CTKeyMap
+// Description:   Table driven translation of USB HID key reports to VT sequences.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+/**
+ * @file TKeyMap.h
+ * @brief Declares the keymap used by the raw keyboard path.
+ * @details A key press arrives as a HID usage code plus the modifier byte of
+ * the boot report. The tables behind CTKeyMap are built by constexpr functions
+ * at compile time: one character table per keyboard layout (normal, shift and
+ * AltGr plane) and one sequence table per combination of the keyboard modes
+ * the host can select (DECCKM, DECKPAM, VT52). Translating a key is therefore
+ * an index into a table, and a mode change only selects another table.
+ */
+
+/**
+ * @class CTKeyMap
+ * @brief Static lookup of VT100 key sequences for US, UK and German keyboards.
+ */
+class CTKeyMap
+{
+public:
+    enum TLayout
+    {
+        LayoutUS,
+        LayoutUK,
+        LayoutDE,
+        LayoutCount
+    };
+
+    /// \brief Keyboard modes set by the host; combinations select a sequence table.
+    enum TKeyMode : u8
+    {
+        KeyModeCursorApplication = 0x01,    ///< DECCKM: cursor keys send ESC O x
+        KeyModeKeypadApplication = 0x02,    ///< DECKPAM: keypad sends ESC O x
+        KeyModeVT52 = 0x04,                 ///< VT52 mode: ESC x, keypad ESC ? x
+        KeyModeCount = 0x08
+    };
+
+    /// \brief Modifier bits of the HID boot report.
+    enum TModifier : u8
+    {
+        ModLeftCtrl = 0x01,
+        ModLeftShift = 0x02,
+        ModLeftAlt = 0x04,
+        ModLeftGUI = 0x08,
+        ModRightCtrl = 0x10,
+        ModRightShift = 0x20,
+        ModRightAlt = 0x40,                 ///< AltGr on European keyboards
+        ModRightGUI = 0x80
+    };
+
+    /// \brief Lock state; the bits match the HID LED output report.
+    enum TLock : u8
+    {
+        LockNum = 0x01,
+        LockCaps = 0x02
+    };
+
+    static constexpr u8 UsageCapsLock = 0x39;
+    static constexpr u8 UsageNumLock = 0x53;
+
+    /// \brief Longest sequence Translate() writes, without the terminating zero.
+    static constexpr unsigned MaxSequence = 6;
+
+    /// \brief Look up a layout by its Circle keymap name ("US", "UK", "DE").
+    /// \return FALSE if there is no table for the name.
+    static boolean ParseLayout(const char *pName, TLayout &rLayout);
+
+    /// \brief Name of a layout as used in cmdline.txt.
+    static const char *GetLayoutName(TLayout Layout);
+
+    /// \brief Translate a pressed key.
+    /// \param Layout Keyboard layout.
+    /// \param ucUsage HID usage code of the key.
+    /// \param ucModifiers Modifier byte of the report (TModifier bits).
+    /// \param ucLocks Num and Caps Lock state (TLock bits).
+    /// \param ucModes Keyboard modes of the shown console (TKeyMode bits).
+    /// \param pBuffer Receives the zero-terminated sequence, MaxSequence + 1 bytes.
+    /// \param rRepeat Set to TRUE if the key auto-repeats.
+    /// \return Length of the sequence; 0 if the key sends nothing.
+    static unsigned Translate(TLayout Layout, u8 ucUsage, u8 ucModifiers, u8 ucLocks,
+                              u8 ucModes, char *pBuffer, boolean &rRepeat);
+};
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-21     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Raw HID report path with CTKeyMap tables
 //------------------------------------------------------------------------------
 
 #pragma once
@@ -19,6 +20,7 @@
 #include <circle/logger.h>
 #include <circle/types.h>
 #include <circle/timer.h>
+#include "TKeyMap.h"
 
 /**
  * @file TKeyboard.h
@@ -27,6 +29,11 @@
  * sequences, auto-repeat handling, and LED synchronization for the VT100
  * terminal. The task acts as the central place where raw USB events are
  * translated into ANSI strings consumed by the renderer and kernel.
+ *
+ * For layouts with a CTKeyMap table (the `keymap=` option in cmdline.txt) the
+ * keyboard runs in raw mode: each new usage code of a boot report is looked up
+ * in the table of the current keyboard modes, and Caps/Num Lock and the LEDs
+ * are kept here. Other layouts use the strings translated by Circle.
  */
 
 
@@ -100,6 +107,12 @@ public:
     /// \brief Get current raw key status handler.
     TKeyStatusHandlerRaw GetKeyStatusHandlerRaw() const;
 
+    /// \brief Select the sequences sent by cursor and keypad keys.
+    /// \param nModes CTKeyMap::TKeyMode bits, as reported by the renderer.
+    void SetKeyModes(unsigned nModes);
+    /// \brief Keyboard modes currently applied to the raw key path.
+    unsigned GetKeyModes() const;
+
 private:
     // Static callback handlers
     /// \brief Invoked when the keyboard device is unplugged.
@@ -116,6 +129,15 @@ private:
     /// \param pString Processed key string.
     /// \param fromAutoRepeat TRUE if invoked from auto-repeat.
     void HandleKeyPressed(const char *pString, boolean fromAutoRepeat);
+    /// \brief Apply line endings and key click, pass the string on and arm auto-repeat.
+    /// \param pString Key sequence to send.
+    /// \param fromAutoRepeat TRUE if invoked from auto-repeat.
+    /// \param queueRepeat TRUE if the key should auto-repeat.
+    void DispatchKey(const char *pString, boolean fromAutoRepeat, boolean queueRepeat);
+    /// \brief Translate a newly pressed key through the CTKeyMap tables.
+    /// \param ucModifiers Modifier bitmask of the report.
+    /// \param ucUsage HID usage code of the key.
+    void HandleRawKeyPress(unsigned char ucModifiers, unsigned char ucUsage);
     /// \brief Process raw key matrix data and track modifier state.
     /// \param ucModifiers Modifier bitmask.
     /// \param RawKeys Raw key matrix values.
@@ -158,6 +180,12 @@ private:
     unsigned m_KeyRepeatDelayMs;
     unsigned m_KeyRepeatRateCps;
 
+    boolean m_bRawKeymap;               ///< Keys are translated by CTKeyMap, not by Circle
+    CTKeyMap::TLayout m_KeyLayout;
+    volatile u8 m_ucKeyModes;           ///< CTKeyMap::TKeyMode bits of the shown console
+    u8 m_ucLocks;                       ///< CTKeyMap::TLock bits, also the LED state
+    volatile boolean m_bLEDsPending;    ///< LED report to send from task context
+
     TKeyPressedHandler m_pKeyPressedHandler;
     TKeyStatusHandlerRaw m_pKeyStatusHandlerRaw;
 };
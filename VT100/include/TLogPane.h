@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// Module:        CTLogPane
+// Description:   Rate-limited overlay pane for screen log output.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/device.h>
+#include <circle/spinlock.h>
+#include <circle/types.h>
+#include <stddef.h>
+
+class CTRenderer;
+
+/**
+ * @file TLogPane.h
+ * @brief Declares the log pane that replaces writing log lines over the host screen.
+ * @details The screen log used to go to CScreenDevice, which draws into the
+ * same framebuffer as the renderer: every log line scrolled the whole screen
+ * behind the renderer's back, and a burst of warnings destroyed the host's
+ * screen and cost host throughput. CTLogPane is the screen log target
+ * instead. It keeps the last MaxLines lines in a ring and shows the newest
+ * PaneRows of them over the bottom rows of the screen while toggled on (F8).
+ */
+
+/**
+ * @class CTLogPane
+ * @brief Log target with its own line ring and a coalesced overlay.
+ * @details Write() only appends to the ring and never draws, so it is safe
+ * from any context and with the renderer lock held. Tick() (kernel heartbeat)
+ * draws at most MaxUpdatesPerSecond times per second, and only the pane rows
+ * that need it: rows whose log line changed and rows the host has written
+ * over since the last update, detected through the cell row generations.
+ * Hiding the pane redraws its rows from the cell grid.
+ *
+ * Until Attach() the output is passed through to the previous target, so
+ * boot messages before the renderer is up stay visible.
+ */
+class CTLogPane : public CDevice
+{
+public:
+    /// \brief Access the singleton log pane.
+    static CTLogPane *Get(void);
+
+    /// \brief Become a log target; output goes to pPassThrough until Attach().
+    void Initialize(CDevice *pPassThrough);
+
+    /// \brief Check whether Initialize() was called.
+    boolean IsInitialized(void) const { return m_bInitialized; }
+
+    /// \brief Collect log lines for the pane from now on.
+    void Attach(CTRenderer *pRenderer);
+
+    /// \brief Log target entry: queue complete lines, never draws.
+    int Write(const void *pBuffer, size_t nCount) override;
+
+    /// \brief Show or hide the pane (F8); takes effect at the next Tick().
+    void Toggle(void);
+
+    /// \brief Check whether the pane is toggled on.
+    boolean IsVisible(void) const { return m_bVisible; }
+
+    /// \brief Draw pending changes (kernel heartbeat).
+    /// \param bScreenFree FALSE while SET-UP or the VT test own the screen.
+    void Tick(boolean bScreenFree);
+
+    /// \brief Number of complete log lines received since Attach().
+    u32 GetLineCount(void) const { return m_nLines; }
+
+    /// \brief Number of pane updates drawn.
+    unsigned GetUpdateCount(void) const { return m_nUpdates; }
+
+    static constexpr unsigned MaxLines = 32;
+    static constexpr unsigned LineLength = 132;
+    static constexpr unsigned PaneRows = 6;
+    static constexpr unsigned MaxUpdatesPerSecond = 4;
+
+private:
+    CTLogPane(void);
+    ~CTLogPane(void);
+
+    struct TLine
+    {
+        char text[LineLength];
+        unsigned length;
+        boolean highlight;          ///< Line carried an SGR attribute (warning, error)
+    };
+
+    enum TParseState
+    {
+        ParseText,
+        ParseEscape,
+        ParseCsi
+    };
+
+    /// \brief Append one byte of log output to the current line (lock held).
+    void Parse(char chChar);
+    /// \brief Move the current line into the ring (lock held).
+    void EndLine(void);
+    /// \brief Redraw the pane rows from the cell grid.
+    void Hide(void);
+
+    CTRenderer *m_pRenderer;
+    CDevice *m_pPassThrough;
+    boolean m_bInitialized;
+    CSpinLock m_SpinLock;
+
+    // Writer side, guarded by m_SpinLock
+    TLine m_Lines[MaxLines];
+    TLine m_Current;
+    TParseState m_ParseState;
+    unsigned m_nSgrParam;
+    volatile u32 m_nLines;              ///< Complete lines since Attach() (free running)
+
+    // Tick side
+    volatile boolean m_bVisible;
+    boolean m_bShown;                   ///< Pane pixels are on screen
+    unsigned m_nFirstRow;               ///< Screen row of the first pane row while shown
+    unsigned m_nRows;                   ///< Pane rows while shown
+    unsigned m_nConsole;                ///< Console on screen while shown
+    u32 m_nShownLines;                  ///< m_nLines when the pane was drawn
+    u32 m_RowGenerations[PaneRows];     ///< Cell row generations when the pane was drawn
+    unsigned m_nLastUpdateTicks;
+    unsigned m_nUpdates;
+};
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// Module:        CTPerfHud
+// Description:   Hotkey-toggled status line with throughput and health counters.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "TRenderer.h"
+
+#include <circle/string.h>
+#include <circle/types.h>
+#include <stddef.h>
+
+/**
+ * @file TPerfHud.h
+ * @brief Declares the performance HUD shown over the top screen row.
+ * @details Whether the terminal keeps up with the host was only visible in
+ * the 30 second scroll statistics of the log. The HUD shows live rates in one
+ * reverse video line while toggled on (F7): host input, renderer busy time,
+ * framebuffer blits, UART overruns and flow control state, WLAN traffic and
+ * free heap, plus the share of CPU time the HUD itself takes.
+ */
+
+/**
+ * @class CTPerfHud
+ * @brief Samples free-running counters and draws their rates as an overlay line.
+ * @details Tick() (kernel heartbeat) does nothing until the next update is
+ * due, at most UpdatesPerSecond times per second. It then reads the renderer
+ * counters and the transport counters of the sampler given to Initialize(),
+ * turns the differences into rates and draws the line through
+ * CTRenderer::DrawOverlayLines(), which flushes only the update area of that
+ * row; an unchanged line is not drawn again unless the host wrote over the
+ * row, detected through its cell row generation. Hiding redraws the row from
+ * the cell grid.
+ *
+ * The time from sampling to the end of drawing is measured with the system
+ * timer and shown as a share of the update interval.
+ */
+class CTPerfHud
+{
+public:
+    /// \brief Counters outside the renderer; free running, rates come from differences.
+    struct TSample
+    {
+        u32 nUartOverruns;          ///< Receive overruns since boot
+        boolean bFlowControl;       ///< Software flow control enabled
+        boolean bXoff;              ///< XOFF sent, host held
+        u32 nNetRxBytes;            ///< Bytes received from telnet clients
+        u32 nNetTxBytes;            ///< Bytes sent to telnet clients
+        size_t nFreeHeap;           ///< Free heap in bytes
+    };
+
+    /// \brief Fills a sample; called from Tick() in task context.
+    typedef void TSampler(TSample &rSample);
+
+    /// \brief Access the singleton HUD.
+    static CTPerfHud *Get(void);
+
+    /// \brief Sample pRenderer and pSampler from now on.
+    void Initialize(CTRenderer *pRenderer, TSampler *pSampler);
+
+    /// \brief Show or hide the HUD (F7); takes effect at the next Tick().
+    void Toggle(void);
+
+    /// \brief Check whether the HUD is toggled on.
+    boolean IsVisible(void) const { return m_bVisible; }
+
+    /// \brief Sample and draw when due (kernel heartbeat).
+    /// \param bScreenFree FALSE while SET-UP or the VT test own the screen.
+    void Tick(boolean bScreenFree);
+
+    /// \brief Text of the last formatted line.
+    const char *GetText(void) const { return m_Text; }
+
+    /// \brief Number of HUD updates drawn.
+    unsigned GetUpdateCount(void) const { return m_nUpdates; }
+
+    /// \brief Time of the last update in microseconds.
+    unsigned GetLastCostUs(void) const { return m_nLastCostUs; }
+
+    static constexpr unsigned UpdatesPerSecond = 2;
+    static constexpr unsigned LineLength = 80;
+
+private:
+    CTPerfHud(void);
+    ~CTPerfHud(void);
+
+    /// \brief Append a count with one decimal and a K/M suffix above 1000.
+    static void AppendScaled(CString &rText, u64 nValue);
+    /// \brief Build m_Text from the differences to the previous sample.
+    void Format(const CTRenderer::TPerfCounters &rCounters, const TSample &rSample, unsigned nElapsedUs);
+    /// \brief Redraw the HUD row from the cell grid.
+    void Hide(void);
+
+    CTRenderer *m_pRenderer;
+    TSampler *m_pSampler;
+
+    volatile boolean m_bVisible;
+    boolean m_bShown;                   ///< HUD pixels are on screen
+    unsigned m_nConsole;                ///< Console on screen while shown
+    u32 m_nRowGeneration;               ///< Cell row 0 generation when the HUD was drawn
+    char m_ShownText[LineLength + 1];   ///< Line on screen while shown
+
+    // Previous sample; rates are differences to it
+    boolean m_bSampled;
+    unsigned m_nSampleTicks;
+    CTRenderer::TPerfCounters m_Counters;
+    TSample m_Sample;
+
+    char m_Text[LineLength + 1];
+    unsigned m_nLastCostUs;
+    unsigned m_nUpdates;
+};
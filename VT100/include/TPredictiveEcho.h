@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+// Module:        CTPredictiveEcho
+// Description:   Speculative local echo for high-latency TCP host sessions.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Confirm only cells the host wrote and moved past
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+/**
+ * @file TPredictiveEcho.h
+ * @brief Declares the predictive local echo layer for WLAN host mode.
+ * @details In TCP host mode a typed character only appears once the host has
+ * echoed it over Wi-Fi. CTPredictiveEcho guesses the echo of printable keys
+ * and simple cursor motion, draws the guess as a dimmed, underlined overlay at
+ * the predicted position and checks it against the cell grid after each block
+ * of host output. A guess counts as echoed once the host wrote its row, the
+ * cell holds the character and the host cursor has moved past it. Confirmed guesses feed a smoothed round-trip estimate;
+ * a wrong or overdue guess rolls back every outstanding overlay.
+ */
+
+class CTRenderer;
+
+/**
+ * @class CTPredictiveEcho
+ * @brief Prediction queue, overlay drawing and RTT estimation.
+ * @details Overlays live only between two blocks of host output: the kernel
+ * calls BeginHostOutput() before handing host data to the renderer, which
+ * redraws the overlaid cells from the cell grid, and EndHostOutput()
+ * afterwards to confirm, roll back or redraw the remaining predictions. In
+ * adaptive mode overlays are only shown once the smoothed RTT exceeds
+ * ShowRttMs and the last prediction was confirmed; predictions are still
+ * tracked while hidden so the RTT keeps being measured.
+ */
+class CTPredictiveEcho
+{
+public:
+    /// \brief Access the singleton predictive echo instance.
+    static CTPredictiveEcho *Get(void);
+
+    /// \brief Operating modes, matching the predictive_echo config key.
+    enum TMode : unsigned
+    {
+        ModeOff = 0,
+        ModeAdaptive = 1,
+        ModeAlways = 2
+    };
+
+    /// \brief Attach the renderer and select the mode.
+    void Initialize(CTRenderer *pRenderer, unsigned nMode);
+
+    /// \brief Change the mode; switching off removes all overlays.
+    void SetMode(unsigned nMode);
+
+    /// \brief Record keyboard output sent to the TCP host.
+    void OnHostInput(const char *pData, size_t nLength);
+
+    /// \brief Remove overlays before host output is rendered.
+    void BeginHostOutput(void);
+
+    /// \brief Reconcile predictions with the rendered host output.
+    void EndHostOutput(void);
+
+    /// \brief Expire overdue predictions (kernel heartbeat).
+    void Tick(void);
+
+    /// \brief Drop every prediction, e.g. when the host session ends.
+    void Reset(void);
+
+    /// \brief Smoothed round-trip time in milliseconds (0 until measured).
+    unsigned GetSmoothedRttMs(void) const;
+
+    /// \brief Number of predictions confirmed by host echo.
+    unsigned GetConfirmedCount(void) const { return m_nConfirmed; }
+    /// \brief Number of rollbacks caused by wrong or overdue predictions.
+    unsigned GetMispredictedCount(void) const { return m_nMispredicted; }
+
+    static constexpr unsigned MaxPredictions = 64;
+    static constexpr unsigned ShowRttMs = 30;
+    static constexpr unsigned HideRttMs = 20;
+    static constexpr unsigned TimeoutMinMs = 1000;
+    static constexpr unsigned TimeoutRttFactor = 3;
+
+private:
+    CTPredictiveEcho(void);
+    ~CTPredictiveEcho(void);
+
+    struct TPrediction
+    {
+        unsigned row;
+        unsigned column;
+        char ch;
+        u32 rowGeneration;  ///< Cell row generation when the key was sent
+        u64 sentUs;
+        boolean shown;
+    };
+
+    /// \brief Start predicting at the host cursor if nothing is outstanding.
+    boolean Anchor(void);
+    /// \brief Queue a printable character at the predicted position.
+    void PredictChar(char chChar);
+    /// \brief Predict a backspace, retracting the newest unconfirmed character.
+    void PredictBackspace(void);
+    /// \brief Check whether overlays should currently be visible.
+    boolean IsShowing(void) const;
+    /// \brief Draw or remove overlays to match IsShowing().
+    void SyncOverlays(void);
+    /// \brief Count a wrong or overdue prediction and roll back.
+    void Mispredict(void);
+    /// \brief Remove every overlay and forget all predictions.
+    void Rollback(void);
+    /// \brief Fold one confirmed round trip into the smoothed RTT.
+    void AddRttSample(u64 nSampleUs);
+    /// \brief Age after which an unconfirmed prediction counts as wrong.
+    u64 GetTimeoutUs(void) const;
+
+    CTRenderer *m_pRenderer;
+    unsigned m_nMode;
+    TPrediction m_Predictions[MaxPredictions];
+    unsigned m_nCount;
+    boolean m_bAnchored;
+    unsigned m_nRow;
+    unsigned m_nColumn;
+    boolean m_bConfident;
+    boolean m_bHighLatency;
+    u64 m_nSmoothedRttUs;
+    unsigned m_nConfirmed;
+    unsigned m_nMispredicted;
+};
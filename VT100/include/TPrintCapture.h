@@ -0,0 +1,123 @@
+//------------------------------------------------------------------------------
+// Module:        CTPrintCapture
+// Description:   Writes printer-controller data from the host to SD card files.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Jobs beyond the queue reopen and extend the last job
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/sched/task.h>
+#include <circle/types.h>
+#include <fatfs/ff.h>
+#include <stddef.h>
+
+/**
+ * @file TPrintCapture.h
+ * @brief Declares the SD writer behind printer-controller mode (CSI 5 i / CSI 4 i).
+ * @details A VT100 with a printer port passes everything between CSI 5 i and
+ * CSI 4 i to the printer without showing it. Hosts use this for print jobs and
+ * data dumps. Here the "printer" is a file on the SD card: the renderer copies
+ * the bytes into a ring buffer, and this task writes them out in whole
+ * sectors, so the parser never waits for the card.
+ */
+
+/**
+ * @class CTPrintCapture
+ * @brief Background task writing each print job to `SD:/PRINTnnn.TXT`.
+ * @details BeginJob(), Write() and EndJob() are called by the renderer with
+ * its lock held; they only copy into the ring buffer and never log or touch
+ * the card. Run() opens one file per job, writes up to WriteChunk bytes at a
+ * time, each write ending on a sector boundary, and writes the remainder when
+ * the job ends (or after IdleFlushMs without data). Data that does not fit into the ring
+ * is counted and dropped. A job that begins while MaxPendingJobs are waiting
+ * for the writer is appended to the file of the previous job.
+ */
+class CTPrintCapture : public CTask
+{
+public:
+    /// \brief Access the singleton print capture task.
+    static CTPrintCapture *Get(void);
+
+    /// \brief Pick the first free file number and start the writer task.
+    /// \return TRUE if the capture is ready to accept jobs.
+    boolean Initialize(void);
+
+    /// \brief Start a new job (renderer lock held, no I/O).
+    void BeginJob(void);
+    /// \brief Queue job data (renderer lock held, no I/O).
+    void Write(const char *pData, size_t nLength);
+    /// \brief Mark the end of the current job (renderer lock held, no I/O).
+    void EndJob(void);
+
+    /// \brief Check whether all jobs are written and closed.
+    boolean IsIdle(void) const;
+
+    /// \brief Bytes queued but not yet written.
+    u32 GetBacklog(void) const { return m_nHead - m_nTail; }
+
+    /// \brief Bytes dropped since start because the ring buffer was full.
+    u32 GetDroppedBytes(void) const { return m_nDroppedBytes; }
+
+    /// \brief Jobs written into the file of the previous job because MaxPendingJobs were queued.
+    unsigned GetMergedJobs(void) const { return m_nJobsMerged; }
+
+    /// \brief Writer loop.
+    void Run(void) override;
+
+    static constexpr unsigned SectorSize = 512;
+    static constexpr unsigned RingSize = 64 * 1024;
+    static constexpr unsigned WriteChunk = 16 * SectorSize;
+    static constexpr unsigned MaxChunksPerPass = 8;
+    static constexpr unsigned MaxPendingJobs = 8;
+    static constexpr unsigned MaxFileNumber = 999;
+    static constexpr unsigned IdleFlushMs = 2000;
+    static constexpr unsigned BusySleepMs = 2;
+    static constexpr unsigned IdleSleepMs = 20;
+
+private:
+    CTPrintCapture(void);
+    ~CTPrintCapture(void);
+
+    /// \brief Write ready data of the oldest job; closes it when its end is reached.
+    /// \return TRUE if more data is ready to be written right away.
+    boolean Service(void);
+    /// \brief Create the file of the next job.
+    boolean OpenJobFile(void);
+    /// \brief Close the current file and report the job.
+    void CloseJobFile(void);
+    /// \brief Move nLength bytes from the ring through the staging buffer to the file.
+    boolean WriteOut(unsigned nLength);
+
+    u8 m_Ring[RingSize];
+    u8 m_Staging[WriteChunk] __attribute__((aligned(64)));
+
+    // Producer side (renderer)
+    volatile u32 m_nHead;                   ///< Bytes queued since start (free running)
+    volatile unsigned m_nJobsBegun;
+    volatile unsigned m_nJobsEnded;
+    volatile u32 m_JobEnd[MaxPendingJobs];  ///< m_nHead at EndJob(), by job number
+    volatile unsigned m_nJobsMerged;        ///< Jobs appended to the previous one, queue was full
+    volatile u32 m_nDroppedBytes;
+
+    // Writer side (task)
+    volatile u32 m_nTail;                   ///< Bytes written or discarded
+    volatile unsigned m_nJobsClosed;
+    FIL m_File;
+    boolean m_bFileOpen;
+    boolean m_bJobFailed;                   ///< SD error, rest of the job is discarded
+    boolean m_bInitialized;
+    unsigned m_nNextFileNumber;
+    char m_FileName[20];
+    u32 m_nJobStartTail;
+    u32 m_nJobDroppedStart;
+    unsigned m_nJobStartTicks;
+    u32 m_nLastHead;
+    unsigned m_nLastDataTicks;
+    unsigned m_nMergedReported;
+};
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// Module:        CTRenderBench
+// Description:   Cycle counter microbenchmarks of the renderer drawing primitives.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Burst blit cases (cell, row, screen)
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+class CTRenderer;
+
+/**
+ * @file TRenderBench.h
+ * @brief Declares the on-device microbenchmark of the rendering primitives.
+ * @details The scroll statistics of CTRenderer are kept in kernel ticks (10 ms),
+ * which cannot resolve a glyph. CTRenderBench calls each primitive in isolation
+ * in batches and times the batches with the CPU cycle counter
+ * (cyclecounter.h), for every VT100 font at the framebuffer depth in use.
+ */
+
+/**
+ * @class CTRenderBench
+ * @brief Times DisplayChar, EraseChar, InvertCursor, Scroll, DeleteLines,
+ * InsertLines, ClearDisplayEnd, SetArea and the presentation blit and logs
+ * cycles per call and per pixel.
+ * @details Run() takes over the screen: it switches fonts, draws on the
+ * whole screen and clears it afterwards, so it is meant for boot time
+ * (`render_bench=1`) or the host benchmark. Each primitive runs in Repeats
+ * batches; the fastest batch counts, which drops batches hit by an interrupt.
+ * Results are logged after the renderer lock has been released.
+ */
+class CTRenderBench
+{
+public:
+    /// \brief Measure all primitives for all fonts and log the results.
+    /// \param pRenderer Initialized renderer; its screen is cleared afterwards.
+    /// \return FALSE if the renderer is not ready.
+    static boolean Run(CTRenderer *pRenderer);
+
+    /// \brief Primitives timed by Run().
+    enum TPrimitive
+    {
+        PrimDisplayChar,
+        PrimDisplayCharBold,
+        PrimDisplayCharUnderline,
+        PrimEraseChar,
+        PrimInvertCursor,
+        PrimScroll,
+        PrimDeleteLines,
+        PrimInsertLines,
+        PrimClearDisplayEnd,
+        PrimSetAreaRow,
+        PrimSetAreaScreen,
+        PrimBlitCell,
+        PrimBlitRow,
+        PrimBlitScreen,
+        PrimCount
+    };
+
+    static constexpr unsigned Repeats = 5;
+    static constexpr unsigned CalibrationMs = 20;
+
+private:
+    struct TResult
+    {
+        u32 nCycles;            ///< Fastest batch
+        unsigned nCalls;        ///< Calls per batch
+        unsigned nPixels;       ///< Pixels touched per call
+    };
+
+    /// \brief Time one primitive; renderer lock held.
+    static TResult Measure(CTRenderer &rRenderer, TPrimitive Primitive);
+    /// \brief Call a primitive nCalls times.
+    static void Call(CTRenderer &rRenderer, TPrimitive Primitive, unsigned nCalls);
+    /// \brief Calls per batch, sized so that a batch stays far below the counter wrap.
+    static unsigned GetCalls(TPrimitive Primitive);
+    /// \brief Pixels one call touches with the current font.
+    static unsigned GetPixels(const CTRenderer &rRenderer, TPrimitive Primitive);
+    /// \brief Counter increments per microsecond, measured against the system timer.
+    static unsigned CalibrateMHz(void);
+    /// \brief Log name of a primitive.
+    static const char *GetName(TPrimitive Primitive);
+};
@@ -7,6 +7,26 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Added cell grid and warm-resume state access
+// 2026-10-18     R. Zuehlsdorff        DECRQCRA checksum reports and host reply handler
+// 2026-10-18     R. Zuehlsdorff        Prediction overlay for predictive local echo
+// 2026-10-18     R. Zuehlsdorff        Virtual consoles with background parsing
+// 2026-10-18     R. Zuehlsdorff        Sixel graphics (DCS q)
+// 2026-10-18     R. Zuehlsdorff        Glyphs drawn from pre-shaded CRT atlases
+// 2026-10-18     R. Zuehlsdorff        Cold parser branches moved out of Write(char)
+// 2026-10-18     R. Zuehlsdorff        Direct-to-framebuffer rendering without shadow buffer
+// 2026-10-18     R. Zuehlsdorff        Adaptive scroll governor (smooth, instant, jump)
+// 2026-10-18     R. Zuehlsdorff        DECCKM/DECKPAM keyboard modes and key mode handler
+// 2026-10-18     R. Zuehlsdorff        Printer controller mode (CSI 5 i / CSI 4 i)
+// 2026-10-18     R. Zuehlsdorff        Primitive access for the cycle counter microbenchmark
+// 2026-10-18     R. Zuehlsdorff        Overlay lines for the log pane
+// 2026-10-18     R. Zuehlsdorff        Copy-on-write blank pixel lines in the shadow buffer
+// 2026-10-18     R. Zuehlsdorff        Burst blit of the dirty column span into the framebuffer
+// 2026-10-18     R. Zuehlsdorff        Task loop counter for the stall watchdog
+// 2026-10-18     R. Zuehlsdorff        Throughput counters for the performance HUD
+// 2026-10-18     R. Zuehlsdorff        Printable span front end with SWAR scanning
+// 2026-10-18     R. Zuehlsdorff        Versioned terminal state snapshots replace screen buffer copies
+// 2026-10-18     R. Zuehlsdorff        Snapshots only mark the screen for the next update
 //------------------------------------------------------------------------------
 
 
@@ -22,6 +42,7 @@
 #include <circle/bcmframebuffer.h>
 #include <circle/spinlock.h>
 #include <circle/types.h>
+#include "TKeyMap.h"
 
 /**
  * @file TRenderer.h
@@ -35,8 +56,14 @@
  */
 
 // Forward declarations and includes for classes used in this module
+#include "TCellBuffer.h"
 #include "TColorPalette.h"
+#include "TConfig.h"
 #include "TFontConverter.h"
+#include "TSixelDecoder.h"
+#include "VT100_FontConverter.h"
+
+class CTRenderBench;
 
 /**
  * @class CTRenderer
@@ -91,6 +118,36 @@ public:
         boolean useG1;
     };
 
+    /// \brief Mode bits carried in TResumeState::modes.
+    enum TResumeMode : u8
+    {
+        ResumeModeUseG1 = 0x01,
+        ResumeModeInsert = 0x02,
+        ResumeModeAutoPage = 0x04,
+        ResumeModeVT52 = 0x08,
+        ResumeModeCursorOn = 0x10,
+        ResumeModeCursorKeys = 0x20,
+        ResumeModeKeypad = 0x40
+    };
+
+    /// \brief Terminal state persisted across reboots (cell contents excluded).
+    /// \details Positions are in cells, not pixels, so the state stays valid as
+    /// long as the screen geometry is unchanged.
+    struct TResumeState
+    {
+        unsigned columns;
+        unsigned rows;
+        unsigned cursorColumn;
+        unsigned cursorRow;
+        unsigned scrollTopRow;
+        unsigned scrollEndRow;  ///< Exclusive
+        u8 attributes;          ///< CTCellBuffer::TAttribute bits of the active rendition
+        u8 g0CharSet;
+        u8 g1CharSet;
+        u8 modes;               ///< TResumeMode bits
+        u8 fontFlags;
+    };
+
     /// \brief Access the singleton renderer instance.
     /// \return Pointer to the renderer singleton.
     static CTRenderer *Get(void);
@@ -120,6 +177,12 @@ public:
     boolean SetFont(EFontSelection selection,
                     CCharGenerator::TFontFlags FontFlags = CCharGenerator::FontFlagsNone);
 
+    /// \brief Set the CRT scan-line, bloom and glow strengths baked into the glyphs.
+    /// \details Rebuilds the glyph atlases of the current font; text drawn
+    /// afterwards uses the new shading, like a color change.
+    /// \param rEffects Effect strengths in percent.
+    void SetCrtEffects(const TCrtEffects &rEffects);
+
     /// \brief Translate a configured color selection into the renderer palette.
     /// \param color Logical color selection enum value.
     /// \return Render-specific color value.
@@ -164,6 +227,46 @@ public:
     /// \brief Reset ANSI parser state (used by VT tests).
     void ResetParserState(void);
 
+    /// \brief Callback receiving terminal reports destined for the host.
+    /// \param nConsole Virtual console whose host asked for the report.
+    typedef void (*ReplyHandler)(unsigned nConsole, const char *pData, size_t nLength);
+
+    /// \brief Register the handler that forwards reports (e.g. DECRQCRA) to the host.
+    /// \details Reports are queued while parsing and delivered after Write()
+    /// has released the renderer lock.
+    /// \param pHandler Handler, or nullptr to discard reports.
+    void RegisterReplyHandler(ReplyHandler pHandler);
+
+    /// \brief Callback receiving the keyboard modes of the console on screen.
+    /// \param nModes CTKeyMap::TKeyMode bits (DECCKM, DECKPAM, VT52).
+    typedef void (*KeyModeHandler)(unsigned nModes);
+
+    /// \brief Register the handler told when the host switches cursor or keypad keys.
+    /// \details Called after Write() or SwitchConsole() has released the lock,
+    /// only when the modes of the shown console differ from the last call.
+    void RegisterKeyModeHandler(KeyModeHandler pHandler);
+
+    /// \brief Keyboard modes of the console on screen (CTKeyMap::TKeyMode bits).
+    unsigned GetKeyModes(void) const;
+
+    /// \brief Events of a printer controller job.
+    enum TPrintEvent
+    {
+        PrintJobStart,  ///< CSI 5 i received
+        PrintJobData,   ///< Host bytes of the job, passed on unparsed
+        PrintJobEnd     ///< CSI 4 i received
+    };
+
+    /// \brief Callback receiving printer controller data.
+    /// \details Called from Write() with the renderer lock held; must only
+    /// copy the data and must not log or block.
+    typedef void (*PrintHandler)(TPrintEvent Event, const char *pData, size_t nLength);
+
+    /// \brief Register the handler behind printer controller mode.
+    /// \details Without a handler CSI 5 i is ignored and the data is shown.
+    /// \param pHandler Handler, or nullptr to disable printer controller mode.
+    void RegisterPrintHandler(PrintHandler pHandler);
+
     /// \brief Move the cursor to a specific position.
     /// \param nRow Row number (based on 0).
     /// \param nColumn Column number (based on 0).
@@ -230,6 +333,46 @@ public:
     /// \return TRUE when smooth-scroll animation is enabled.
     boolean GetSmoothScrollEnabled(void) const { return m_bSmoothScrollEnabled; }
 
+    /// \brief Report input still queued by the transport behind the next Write() chunk.
+    /// \details Consumed by the next Write(); the scroll governor adds it to the
+    /// chunk length to judge how far rendering lags behind the host.
+    void SetIngestBacklog(unsigned nBytes) { m_nIngestBacklogHint = nBytes; }
+
+    /// \brief Query whether glyphs are drawn straight into the framebuffer.
+    /// \return TRUE if there is no shadow buffer and no smooth scroll (config direct_render).
+    boolean IsDirectRender(void) const { return m_bDirectRender; }
+
+    /// \brief Number of presentations that wrote the framebuffer in place, bypassing SetArea().
+    unsigned GetInPlaceCount(void) const { return m_nInPlaceCount; }
+
+    /// \brief Number of passes of the rendering task loop; stops advancing while the task is stuck.
+    u32 GetLoopCount(void) const { return m_nLoopCount; }
+
+    /// \brief Free-running totals for the performance HUD; rates come from differences.
+    struct TPerfCounters
+    {
+        u32 nBytes;             ///< Host bytes written, all consoles
+        u32 nBusyUs;            ///< Time in Write(), WriteConsole() and Update() with the lock held
+        u32 nBlits;             ///< Pixel line runs copied into the framebuffer by PresentLines()
+    };
+
+    /// \brief Read the performance counters.
+    void GetPerfCounters(TPerfCounters &rCounters) const
+    {
+        rCounters.nBytes = m_nPerfBytes;
+        rCounters.nBusyUs = m_nPerfBusyUs;
+        rCounters.nBlits = m_nPerfBlits;
+    }
+
+    /// \brief Length of the printable prefix of a chunk: bytes from 0x20 up except DEL.
+    /// \details Tests a machine word at a time (SWAR) for C0 controls, ESC and DEL,
+    /// then finishes byte by byte.
+    static size_t ScanPrintable(const char *pChar, size_t nCount);
+
+    /// \brief Hand printable spans to the glyph path in one call (default), or
+    /// dispatch every byte through the parser as before (benchmarks).
+    void SetPrintableSpans(boolean bEnable) { m_bPrintableSpans = bEnable; }
+
     /// \brief Force-hide the cursor and restore underlying pixels.
     void ForceHideCursor(void);
 
@@ -274,25 +417,128 @@ public:
     /// \brief Conduct a rendering self-test using various attributes.
     void doRenderTest(void);
 
-    /// \brief Save the current renderer state for later restore.
-    void SaveState(TRendererState &state);
+    /// \brief Park the terminal state and continue on a blank power-on screen.
+    /// \details Parser state, modes, character sets, rendition, margins and the
+    /// saved cursor move into the snapshot together with the cell grid and the
+    /// shadow buffer lines, all by exchange, so taking and restoring cost no
+    /// copy of the screen. Only direct rendering, where the pixels are the
+    /// framebuffer, copies them. Taking and restoring only mark the screen for
+    /// the next Write() or Update() to present. Font, colors, cursor shape and
+    /// the tab stops of the configuration are recorded as well. Used by SET-UP
+    /// and VTTest.
+    /// \return Snapshot id, or 0 if a snapshot is already held or memory is short.
+    u32 TakeSnapshot(void);
+
+    /// \brief Bring back the terminal state and screen of TakeSnapshot().
+    /// \param nSnapshot Id returned by TakeSnapshot().
+    /// \param bRestoreTabStops FALSE keeps the tab stops set while the snapshot was held.
+    /// \return FALSE if nSnapshot is not the snapshot held; nothing is changed.
+    boolean RestoreSnapshot(u32 nSnapshot, boolean bRestoreTabStops = TRUE);
+
+    /// \brief Id of the snapshot held, 0 if none.
+    u32 GetSnapshot(void) const { return m_Snapshot.id; }
+
+    /// \brief Capture cursor, rendition, charset, scroll region and mode state.
+    void GetResumeState(TResumeState &state) const;
+
+    /// \brief Replace the screen with persisted cells and state in one render pass.
+    /// \param state State captured by GetResumeState() before the reboot.
+    /// \param pCells Row-major cells, state.columns * state.rows entries.
+    /// \param nCellCount Number of entries available at pCells.
+    /// \return FALSE if the geometry no longer matches; the screen is left unchanged.
+    boolean ApplyResumeState(const TResumeState &state, const CTCellBuffer::TCell *pCells, size_t nCellCount);
+
+    /// \brief Generation of the most recent cell change anywhere on screen.
+    u32 GetCellGeneration(void) const;
+
+    /// \brief Generation of the most recent cell change in one row.
+    u32 GetCellRowGeneration(unsigned nRow) const;
+
+    /// \brief Copy one row of cells under the renderer lock.
+    /// \param nRow Row index (based on 0).
+    /// \param pDest Destination, at least nMaxCells entries.
+    /// \param nMaxCells Capacity of pDest.
+    /// \param pGeneration Optional; receives the generation of the copied row.
+    /// \return Number of cells copied (0 if the row does not exist).
+    unsigned CopyCellRow(unsigned nRow, CTCellBuffer::TCell *pDest, unsigned nMaxCells, u32 *pGeneration = nullptr) const;
+
+    /// \brief Read one cell of the cell grid under the renderer lock.
+    /// \return FALSE if the position is outside the grid.
+    boolean GetCell(unsigned nRow, unsigned nColumn, CTCellBuffer::TCell &rCell) const;
+
+    /// \brief Draw a speculative character over a cell without touching the cell grid.
+    /// \details Used by predictive echo; the glyph is drawn dimmed and underlined
+    /// so it can be told apart from host output. RefreshCell() removes it.
+    void DrawPredictedChar(unsigned nRow, unsigned nColumn, char chChar);
+
+    /// \brief Redraw one cell from the cell grid, discarding any overlay.
+    void RefreshCell(unsigned nRow, unsigned nColumn);
+
+    /// \brief One text line for DrawOverlayLines().
+    struct TOverlayLine
+    {
+        const char *pText;      ///< Printable characters; the rest of the row is blank
+        unsigned nLength;
+        boolean bHighlight;     ///< Drawn bold
+    };
+
+    /// \brief Draw reverse-video text lines over cell rows without touching the cell grid.
+    /// \details Used by the log pane. Rows below the screen are skipped; the
+    /// update area is flushed once for all lines. RefreshRows() removes them.
+    /// Until then host scrolls redraw the rows the overlay pixels move into.
+    void DrawOverlayLines(unsigned nFirstRow, const TOverlayLine *pLines, unsigned nCount);
 
-    /// \brief Restore a previously saved renderer state.
-    void RestoreState(const TRendererState &state);
+    /// \brief Redraw cell rows [nRowStart, nRowEnd) from the cell grid, discarding any overlay.
+    void RefreshRows(unsigned nRowStart, unsigned nRowEnd);
 
-    /// \brief Query the size of the internal pixel buffer.
-    size_t GetBufferSize(void) const;
+    /// \brief Timer tick of the most recent Write() call, used for idle detection.
+    unsigned GetLastWriteTicks(void) const { return m_nLastWriteTicks; }
 
-    /// \brief Save the internal pixel buffer into a caller-provided buffer.
-    void SaveScreenBuffer(void *buffer, size_t bufferSize);
+    /// \brief Number of virtual consoles, each with its own parser state and cell grid.
+    static constexpr unsigned MaxConsoles = 2;
 
-    /// \brief Restore the internal pixel buffer from a caller-provided buffer.
-    void RestoreScreenBuffer(const void *buffer, size_t bufferSize);
+    /// \brief Index of the console currently shown on screen.
+    unsigned GetActiveConsole(void) const { return m_nActiveConsole; }
+
+    /// \brief Write host output to a virtual console.
+    /// \details Output for the active console is rendered exactly like Write().
+    /// Output for a background console only advances that console's parser and
+    /// cell grid; no pixels are touched until SwitchConsole() shows it.
+    /// \return Number of consumed characters (0 for an unknown console).
+    int WriteConsole(unsigned nConsole, const void *pBuffer, size_t nCount);
+
+    /// \brief Show another virtual console.
+    /// \details Swaps the parser state and cell grid in O(1) and redraws the
+    /// screen once from the cell grid. Font and colors are shared by all consoles.
+    /// \return FALSE if the console does not exist or the renderer is not ready.
+    boolean SwitchConsole(unsigned nConsole);
 
 
 private:
+    /// \brief Times the private drawing primitives in isolation (TRenderBench.cpp).
+    friend class CTRenderBench;
+
+    /// \brief Feed a chunk to the parser, or to the print handler in printer controller mode.
+    void WriteBytes(const char *pChar, size_t nCount);
+    /// \brief Pass printer controller data on until CSI 4 i.
+    /// \return Number of bytes consumed, terminator included.
+    size_t WritePrinterData(const char *pChar, size_t nCount);
+    /// \brief Enter printer controller mode (CSI 5 i).
+    void BeginPrinterController(void);
     /// \brief Write a single character respecting current state machine.
     void Write(char chChar);
+    /// \brief Draw a span found by ScanPrintable() in the ground state.
+    void WritePrintable(const char *pChar, size_t nCount);
+    /// \brief Handle the byte after ESC in VT52 mode.
+    void WriteVT52Escape(char chChar);
+    /// \brief Handle the final byte of ESC # (DECDHL/DECSWL/DECDWL).
+    void SetLineSize(char chChar);
+    /// \brief Set or clear the tab stop in the cursor column (HTS, TBC 0).
+    void SetTabStopAtCursor(boolean bEnabled);
+    /// \brief Clear all tab stops (TBC 3).
+    void ClearTabStops(void);
+    /// \brief Ring the bell when a printable character reaches the margin bell column.
+    void CheckMarginBell(void);
 
     /// \brief Move cursor to column zero without changing row.
     void CarriageReturn(void);
@@ -355,17 +601,90 @@ private:
     /// \brief Render one smooth scroll animation frame.
     void RenderSmoothScrollFrame(void);
 
+    /// \brief How a line feed at the bottom margin is shown, picked by the scroll governor.
+    enum TScrollMode
+    {
+        ScrollModeSmooth,   ///< Animated scroll, one line at a time
+        ScrollModeInstant,  ///< Pixel move per line
+        ScrollModeJump,     ///< Lines coalesced, screen redrawn once per chunk
+        ScrollModeCount
+    };
+
+    /// \brief Update backlog and smoothed input and scroll rates at the start of a chunk.
+    void NoteIngest(size_t nCount, unsigned nNow);
+    /// \brief Pick the mode for the next scroll from backlog and rates.
+    /// \details Steps down to a cheaper mode at once and back up only after the
+    /// load stayed low for GovernorDwellMs, like the VT100 degrading from smooth
+    /// to jump scroll under load.
+    TScrollMode ChooseScrollMode(void);
+    /// \brief Stop rasterising until the end of the chunk; only the cell grid scrolls.
+    /// \return FALSE if the screen holds pixels the cell grid cannot redraw.
+    boolean BeginJumpScroll(void);
+    /// \brief Bring the screen up to date after coalesced scrolls.
+    /// \details Moves the scroll region once by all coalesced lines (shadow
+    /// buffer only) and redraws the cells that differ from what is then shown.
+    void ResolveJumpScroll(void);
+    /// \brief Log governor decisions and time spent in each mode.
+    void LogScrollGovernor(unsigned nNow);
+
     /// \brief Render a character at an explicit position with specified color.
     void DisplayChar(char chChar, unsigned nPosX, unsigned nPosY, CDisplay::TRawColor nColor);
     /// \brief Clear a character cell at the given position.
     void EraseChar(unsigned nPosX, unsigned nPosY);
     /// \brief Invert current cursor pixels to show cursor state.
     void InvertCursor(void);
-
-
-    // We always update entire pixel lines.
+    /// \brief Cell attribute bits for the active rendition.
+    u8 GetCellAttributes(void) const;
+    /// \brief Draw every non-blank cell of the cell grid into the pixel buffer.
+    void RenderCells(void);
+    /// \brief Draw one cell of the cell grid, switching rendition and charset as stored.
+    void RenderCell(unsigned nRow, unsigned nColumn);
+    /// \brief Switch the rendition flags to the given cell attribute bits.
+    void ApplyCellAttributes(u8 nAttributes);
+    /// \brief Redraw columns [nColumnStart, nColumnEnd) of a cell row, blanks included.
+    void RedrawCells(unsigned nRow, unsigned nColumnStart, unsigned nColumnEnd);
+    /// \brief Redraw cell rows [nRowStart, nRowEnd) after the grid moved them by nMoved rows.
+    /// \details Direct mode replaces pixel moves by this; only cells that differ from
+    /// the row previously shown at the same place are drawn.
+    void RedrawRows(unsigned nRowStart, unsigned nRowEnd, int nMoved);
+    /// \brief TRUE if cell row nRow shows overlay lines rather than the cell grid.
+    boolean IsOverlayRow(unsigned nRow) const
+    {
+        return nRow >= m_nOverlayTopRow && nRow < m_nOverlayEndRow;
+    }
+    /// \brief Redraw rows of [nRowStart, nRowEnd) that a pixel move by nMoved rows filled from overlay rows.
+    void RepairOverlayRows(unsigned nRowStart, unsigned nRowEnd, int nMoved);
+    /// \brief Hand the update area to the framebuffer; direct mode only resets it.
+    void FlushUpdateArea(void);
+    /// \brief Hide the cursor and remember the rendition before drawing outside Write().
+    void BeginOverlay(void);
+    /// \brief Restore rendition and cursor after BeginOverlay() and flush the update area.
+    /// \param bFlush FALSE leaves the update area to the next Write() or Update().
+    void EndOverlay(boolean bFlush = TRUE);
+    /// \brief Answer DECRQCRA (CSI Pi;Pg;Pt;Pl;Pb;Pr * y) from the collected parameters.
+    void ReportAreaChecksum(void);
+    /// \brief Queue a report for delivery to the host after Write() returns.
+    void QueueReply(const char *pData, size_t nLength);
+    /// \brief Hand queued reports and changed key modes to their handlers; called with the lock held, releases it.
+    void ReleaseAndDeliverReplies(unsigned nConsole);
+
+    /// \brief Start a Sixel image at the cursor with the collected DCS parameters.
+    void BeginSixel(void);
+    /// \brief Finish the Sixel image and move the cursor below it.
+    void EndSixel(void);
+    /// \brief Add the pixel lines drawn by the Sixel decoder to the update area.
+    void FlushSixelDamage(void);
+
+
+    // The update area covers whole pixel lines; its columns narrow the span
+    // blitted from the shadow buffer when the framebuffer is addressable.
     /// \brief Expand the pending update area to include the provided rows.
     void SetUpdateArea(unsigned nPosY1, unsigned nPosY2)
+    {
+        SetUpdateArea(nPosY1, nPosY2, 0, m_nWidth - 1);
+    }
+    /// \brief Expand the pending update area to include the provided rows and pixel columns.
+    void SetUpdateArea(unsigned nPosY1, unsigned nPosY2, unsigned nPosX1, unsigned nPosX2)
     {
         if (nPosY1 < m_UpdateArea.y1)
         {
@@ -376,7 +695,53 @@ private:
         {
             m_UpdateArea.y2 = nPosY2;
         }
+
+        if (nPosX1 < m_UpdateArea.x1)
+        {
+            m_UpdateArea.x1 = nPosX1;
+        }
+
+        if (nPosX2 > m_UpdateArea.x2)
+        {
+            m_UpdateArea.x2 = nPosX2;
+        }
+    }
+
+    /// \brief TRUE if pixel lines [nPosY1, nPosY2] may hold Sixel pixels the cell grid does not know.
+    boolean HasGraphics(unsigned nPosY1, unsigned nPosY2) const
+    {
+        return m_nGraphicsY1 <= m_nGraphicsY2 && m_nGraphicsY1 <= nPosY2 && nPosY1 <= m_nGraphicsY2;
+    }
+    /// \brief Follow Sixel pixels moved by nPixels lines inside the region [nStartY, nEndY].
+    void MoveGraphics(unsigned nStartY, unsigned nEndY, int nPixels);
+
+    // Copy-on-write blank lines: a cleared shadow buffer line only records its
+    // color; the pixels are stored when something is drawn into it or reads it.
+    /// \brief Store the pixels of blank lines in [nPosY1, nPosY2] before they are drawn over or read.
+    /// \details Lines are blanked and stored per character row, so checking both ends is enough.
+    void TouchLines(unsigned nPosY1, unsigned nPosY2)
+    {
+        if (m_pBlankLines[nPosY1].blank || m_pBlankLines[nPosY2].blank)
+        {
+            MaterialiseLines(nPosY1, nPosY2);
+        }
     }
+    /// \brief Store the pixels of the blank lines in the character rows touching [nPosY1, nPosY2].
+    void MaterialiseLines(unsigned nPosY1, unsigned nPosY2);
+    /// \brief Fill pixel lines [nPosY1, nPosY2] with a color; with blank lines only the color is recorded.
+    void FillLines(unsigned nPosY1, unsigned nPosY2, CDisplay::TRawColor nColor);
+    /// \brief Move nCount pixel lines from nFromY to nToY; blank lines move without their pixels.
+    void MoveLines(unsigned nToY, unsigned nFromY, unsigned nCount);
+    /// \brief Copy nCount pixel lines from nPosY into a packed buffer, blank lines as their color.
+    void CopyLines(u8 *pDest, unsigned nPosY, unsigned nCount);
+    /// \brief Write the color into nCount pixel lines at pLine, nPitch bytes apart.
+    void FillPixelLines(u8 *pLine, unsigned nCount, unsigned nPitch, CDisplay::TRawColor nColor);
+    /// \brief Hand pixel lines [nPosY1, nPosY2] to the framebuffer; blank lines are filled in place.
+    /// \details With an addressable framebuffer only pixel columns [nPosX1, nPosX2] of stored
+    /// lines are copied, rounded out to bursts; otherwise whole lines go through SetArea().
+    void PresentLines(unsigned nPosY1, unsigned nPosY2, unsigned nPosX1, unsigned nPosX2);
+    /// \brief Note that framebuffer lines [nPosY1, nPosY2] were written other than by PresentLines().
+    void ForgetShownLines(unsigned nPosY1, unsigned nPosY2);
 
     enum TState
     {
@@ -394,26 +759,165 @@ private:
         StateFontChange,
         StateSkipTillCRLF,
         StateG0,
-        StateG1
+        StateG1,
+        StateParams,
+        StateAsterisk,
+        StateDcs,
+        StateDcsIgnore,
+        StateDcsEscape,
+        StateSixel
     };
 
+    static constexpr unsigned MaxParams = 6;
+    static constexpr unsigned MaxParamValue = 9999;
+    static constexpr size_t ReplyBufferSize = 128;
+
+    // Scroll governor thresholds; backlog in bytes, rates per second
+    static constexpr unsigned GovernorWindowMs = 100;      ///< Rate measurement window
+    static constexpr unsigned GovernorDwellMs = 500;       ///< Calm time before stepping up a mode
+    static constexpr unsigned SmoothMaxScrollRate = 6;     ///< Lines/s the animation can show (VT100: 6)
+    static constexpr unsigned SmoothEnterScrollRate = 3;
+    static constexpr unsigned SmoothMaxBacklog = 256;
+    static constexpr unsigned SmoothEnterBacklog = 64;
+    static constexpr unsigned JumpEnterBacklog = 1024;
+    static constexpr unsigned JumpLeaveBacklog = 256;
+    static constexpr unsigned JumpEnterRate = 16000;
+    static constexpr unsigned JumpLeaveRate = 6000;
+
     enum ECharacterSet
     {
         CharSetUS,
         CharSetGraphics
     };
 
+    /// \brief Parser and screen state of a virtual console that is not on screen.
+    struct TConsoleState
+    {
+        TState state;
+        unsigned param1;
+        unsigned param2;
+        unsigned params[MaxParams];
+        unsigned paramCount;
+        unsigned cursorX;
+        unsigned cursorY;
+        boolean cursorOn;
+        unsigned scrollStart;
+        unsigned scrollEnd;
+        boolean reverseAttribute;
+        boolean boldAttribute;
+        boolean dimAttribute;
+        boolean underlineAttribute;
+        boolean blinkAttribute;
+        boolean insertOn;
+        boolean vt52Mode;
+        boolean cursorKeyApplication;
+        boolean keypadApplication;
+        boolean printerController;
+        unsigned printerMatch;
+        boolean autoPage;
+        ECharacterSet g0CharSet;
+        ECharacterSet g1CharSet;
+        boolean useG1;
+        TRendererState savedCursor;
+        CTCellBuffer cells;
+        CTSixelDecoder *sixel;
+    };
+
+    /// \brief Put a parked console into its power-on state; cells and decoder are kept.
+    void ResetConsoleState(TConsoleState &rConsole, unsigned nScrollEnd);
+    /// \brief Swap the live parser and screen state with a parked console.
+    void ExchangeConsole(TConsoleState &rConsole);
+    /// \brief Adapt a console brought in by ExchangeConsole() to the current font geometry.
+    void FitConsoleGeometry(void);
+    /// \brief Fill the whole pixel buffer with the default background color.
+    void ClearPixels(void);
+
+    /// \brief Atlas of a font and size, built on first use and kept until the effects change.
+    const TCrtGlyphAtlas *GetGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags);
+    /// \brief Drop all cached atlases.
+    void FreeGlyphAtlases(void);
+    /// \brief Colors for the atlas levels between background and foreground.
+    const CDisplay::TRawColor *GetShadeRamp(CDisplay::TRawColor nForeground, CDisplay::TRawColor nBackground);
+    /// \brief Recompute the shade ramp for a new color pair.
+    void BuildShadeRamp(CDisplay::TRawColor nForeground, CDisplay::TRawColor nBackground);
+
     const TFont *m_pFont;
+    const TFont *m_pGraphicsFont;
     CCharGenerator::TFontFlags m_FontFlags;
     CCharGenerator *m_pCharGen;
     CCharGenerator *m_pGraphicsCharGen;
     EFontSelection m_CurrentFontSelection;
 
+    // Pre-shaded glyphs: one slot per font and size seen since the last effect change
+    struct TGlyphAtlasSlot
+    {
+        const TFont *font;
+        CCharGenerator::TFontFlags flags;
+        TCrtGlyphAtlas atlas;
+    };
+    static constexpr unsigned GlyphAtlasSlots = 8;  ///< Text and graphics font in every line size
+    TGlyphAtlasSlot m_GlyphAtlases[GlyphAtlasSlots];
+    unsigned m_nNextGlyphAtlasSlot;
+    TCrtEffects m_CrtEffects;
+    const TCrtGlyphAtlas *m_pGlyphAtlas;
+    const TCrtGlyphAtlas *m_pGraphicsGlyphAtlas;
+    CDisplay::TRawColor m_ShadeRamp[CrtShadeLevels];
+    CDisplay::TRawColor m_nShadeRampForeground;
+    CDisplay::TRawColor m_nShadeRampBackground;
+    boolean m_bShadeRampValid;
+
     ECharacterSet m_G0CharSet;
     ECharacterSet m_G1CharSet;
     boolean m_bUseG1;
 
     CDisplay::TRawColor *m_pCursorPixels;
+    boolean m_bDirectRender;                ///< m_pBuffer8 is the framebuffer itself
+    u8 *m_pCellRowCache;                    ///< One character row of pixels, direct mode only
+
+    /// \brief Fill state of one pixel line.
+    struct TBlankLine
+    {
+        CDisplay::TRawColor color;          ///< Fill color while blank
+        boolean blank;                      ///< Line is all color; for the shadow buffer, pixels not stored
+    };
+    boolean m_bBlankLines;                  ///< Shadow buffer with a framebuffer that can be filled in place
+    u8 *m_pFramePixels;                     ///< Framebuffer written in place by PresentLines(), or nullptr
+    unsigned m_nFramePitch;
+    unsigned m_nInPlaceCount;               ///< PresentLines() calls that wrote m_pFramePixels
+    volatile u32 m_nLoopCount;              ///< Run() passes, sampled by the stall watchdog
+    volatile u32 m_nPerfBytes;              ///< TPerfCounters totals
+    volatile u32 m_nPerfBusyUs;
+    volatile u32 m_nPerfBlits;
+    TBlankLine *m_pBlankLines;              ///< Per shadow buffer line, moves with the pixels
+    TBlankLine *m_pShownLines;              ///< Per framebuffer line, as left by PresentLines()
+    unsigned m_nGraphicsY1;                 ///< Pixel lines with Sixel pixels, empty if Y1 > Y2
+    unsigned m_nGraphicsY2;
+
+    /// \brief State parked by TakeSnapshot().
+    struct TSnapshot
+    {
+        u32 id;                             ///< 0 while no snapshot is held
+        TConsoleState console;
+        u8 *pixels;                         ///< Shadow buffer lines parked, or the copy in direct mode
+        TBlankLine *blankLines;             ///< Fill state of the parked lines
+        unsigned graphicsY1;
+        unsigned graphicsY2;
+        const TFont *font;
+        EFontSelection fontSelection;
+        CCharGenerator::TFontFlags fontFlags;
+        CDisplay::TRawColor foreground;
+        CDisplay::TRawColor background;
+        CDisplay::TRawColor defaultForeground;
+        CDisplay::TRawColor defaultBackground;
+        boolean cursorVisible;
+        boolean cursorBlock;
+        boolean blinkingCursor;
+        unsigned blinkPeriodTicks;
+        bool tabStops[CTConfig::TabStopsMax];    ///< As in CTConfig, which owns them
+    };
+    TSnapshot m_Snapshot;
+    u32 m_nSnapshotSerial;
+    CTSixelDecoder m_SnapshotSixel;         ///< Decoder of the state shown while a snapshot is held
     union
     {
         u8 *m_pBuffer8;
@@ -458,6 +962,20 @@ private:
     boolean m_bVT52Mode;
     unsigned m_nParam1;
     unsigned m_nParam2;
+    unsigned m_Params[MaxParams];
+    unsigned m_nParamCount;
+    boolean m_bCursorKeyApplication;    ///< DECCKM
+    boolean m_bKeypadApplication;       ///< DECKPAM
+    ReplyHandler m_pReplyHandler;
+    KeyModeHandler m_pKeyModeHandler;
+    unsigned m_nReportedKeyModes;
+    PrintHandler m_pPrintHandler;
+    boolean m_bPrinterController;       ///< Host data goes to m_pPrintHandler
+    unsigned m_nPrinterMatch;           ///< Bytes of CSI 4 i matched so far
+    boolean m_bPrintJobOpen;            ///< One console at a time may print
+    boolean m_bPrintableSpans;          ///< WriteBytes() scans for printable spans
+    char m_ReplyBuffer[ReplyBufferSize];
+    size_t m_nReplyLength;
     boolean m_bAutoPage;
     boolean m_bDelayedUpdate;
     unsigned m_nLastUpdateTicks;
@@ -474,13 +992,46 @@ private:
     u8 *m_pSmoothScrollCompose;
     size_t m_nSmoothScrollBufferSize;
     unsigned m_nSmoothScrollStartTick;
-    unsigned  m_nSmoothScrollDebounceUntil; // tick until which we suppress smooth to avoid bursts
     unsigned m_nScrollStatsLastLogTick;
     unsigned long long m_ScrollNormalTicksAccum;
     unsigned long long m_ScrollSmoothTicksAccum;
     unsigned m_ScrollNormalCount;
     unsigned m_ScrollSmoothCount;
+    TScrollMode m_ScrollMode;
+    unsigned m_nScrollModeSince;            ///< Tick the current mode was entered
+    unsigned m_nScrollCalmSince;            ///< Tick since which the load allows the next better mode
+    unsigned m_nIngestBacklogHint;          ///< Transport backlog reported for the next chunk
+    unsigned m_nIngestBacklog;              ///< Chunk length plus reported backlog
+    unsigned m_nRateWindowStart;
+    unsigned m_nRateWindowBytes;
+    unsigned m_nRateWindowScrolls;
+    unsigned m_nInputRate;                  ///< Smoothed input bytes per second
+    unsigned m_nScrollRate;                 ///< Smoothed scrolls per second
+    boolean m_bJumpPending;
+    unsigned m_nJumpTopRow;
+    unsigned m_nJumpEndRow;
+    unsigned m_nJumpLines;                  ///< Scrolls of the jump region since BeginJumpScroll()
+    unsigned m_nJumpColumns;
+    unsigned m_nJumpRows;
+    CTCellBuffer::TCell *m_pJumpShown;      ///< Cell grid as on screen when the jump began
+    size_t m_nJumpShownSize;
+    unsigned m_ScrollModeDecisions[ScrollModeCount];
+    unsigned long long m_ScrollModeTicks[ScrollModeCount];
+    unsigned m_nScrollModeChanges;
+    unsigned m_nJumpResolves;
+    unsigned m_nJumpResolvedLines;
     TRendererState m_SavedState;
+    CTCellBuffer m_Cells;
+    unsigned m_nLastWriteTicks;
+    boolean m_bOverlayCursorVisible;
+    u8 m_OverlayAttributes;
+    unsigned m_nOverlayTopRow;              ///< Rows [top, end) hold DrawOverlayLines() pixels
+    unsigned m_nOverlayEndRow;
+    TConsoleState m_Consoles[MaxConsoles];  ///< Slot of the active console is unused
+    unsigned m_nActiveConsole;
+    boolean m_bRasterise;                   ///< FALSE while parsing for a background console
+    CTSixelDecoder m_SixelDecoders[MaxConsoles];
+    CTSixelDecoder *m_pSixel;               ///< Decoder of the console in the live state
     /**
      * @brief Spinlock to protect the renderer state.
      * @details
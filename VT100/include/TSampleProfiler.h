@@ -0,0 +1,123 @@
+//------------------------------------------------------------------------------
+// Module:        CTSampleProfiler
+// Description:   Timer-interrupt program counter sampler with a fixed histogram.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/interrupt.h>
+#include <circle/sched/task.h>
+#include <circle/string.h>
+#include <circle/types.h>
+
+/**
+ * @file TSampleProfiler.h
+ * @brief Declares the statistical PC sampling profiler.
+ * @details Scope timers (tools/profiler.h) only measure what was
+ * instrumented. CTSampleProfiler interrupts the firmware at a fixed rate and
+ * counts where it was: the interrupted program counter and the task that was
+ * running. The counts are dumped as text over telnet (`profile dump`) or to
+ * `SD:/PROFILE.TXT` (`profile save`); `tools/host_profile/VT100_PROFILE`
+ * resolves the addresses against `build/kernel.lst` and `build/kernel.map`.
+ */
+
+/**
+ * @class CTSampleProfiler
+ * @brief ARM timer interrupt handler counting (PC, task) pairs.
+ * @details The BCM2835 ARM timer (SP804 style, basic IRQ 0) is used because
+ * the system timer channels are taken by CTimer and by the buzzer's
+ * CUserTimer. Its clock follows the core clock, so Initialize() measures it
+ * against the system timer once.
+ *
+ * The handler reads the return address that Circle's AArch32 IRQ stub pushed
+ * on top of the IRQ stack and counts it in an open-addressed table of
+ * Buckets entries; a pair that finds no free entry within ProbeLimit steps
+ * counts as dropped. Code that runs with interrupts disabled is sampled at
+ * the instruction that enables them again.
+ *
+ * Every dump line starts with `profile `, so the lines can be cut out of a
+ * telnet capture that also holds log output.
+ */
+class CTSampleProfiler
+{
+public:
+    /// \brief Access the singleton profiler.
+    static CTSampleProfiler *Get(void);
+
+    /// \brief Measure the timer clock and connect the interrupt; does not start sampling.
+    /// \return FALSE if the timer clock could not be measured.
+    boolean Initialize(CInterruptSystem *pInterrupt);
+
+    /// \brief Start sampling at nRateHz (clamped to MinRate..MaxRate); counts are kept.
+    boolean Start(unsigned nRateHz);
+
+    /// \brief Stop sampling; counts are kept.
+    void Stop(void);
+
+    /// \brief Drop all counts.
+    void Clear(void);
+
+    boolean IsRunning(void) const { return m_bRunning; }
+    unsigned GetRate(void) const { return m_nRateHz; }
+    u32 GetSampleCount(void) const { return m_nSamples; }
+    u32 GetDroppedCount(void) const { return m_nDropped; }
+    /// \brief Milliseconds sampled since the last Clear().
+    unsigned GetSampledMs(void) const;
+
+    /// \brief Format the next line of the dump.
+    /// \param rCursor 0 for the first line; advanced by the call.
+    /// \return FALSE after the last line.
+    boolean FormatLine(unsigned &rCursor, CString &rLine) const;
+
+    /// \brief Write the dump to SD:/PROFILE.TXT, replacing an older one.
+    boolean Save(void);
+
+    static constexpr unsigned MinRate = 10;
+    static constexpr unsigned MaxRate = 10000;
+    static constexpr unsigned DefaultRate = 1000;
+    static constexpr unsigned Buckets = 4096;
+    static constexpr unsigned ProbeLimit = 16;
+    static constexpr unsigned MaxTasks = 16;
+
+private:
+    CTSampleProfiler(void);
+    ~CTSampleProfiler(void);
+
+    struct TBucket
+    {
+        u32 nPC;
+        u32 nTask;                      ///< Index into m_Tasks
+        u32 nCount;                     ///< 0 = free
+    };
+
+    struct TTaskEntry
+    {
+        CTask *pTask;                   ///< nullptr = free; index 0 stands for "no task"
+        char Name[16];
+    };
+
+    /// \brief ARM timer interrupt (IRQ context).
+    static void InterruptHandler(void *pParam);
+    /// \brief Count one sample (IRQ context).
+    void Sample(u32 nPC);
+    /// \brief Task table index of the running task (IRQ context).
+    unsigned GetTaskIndex(void);
+
+    CInterruptSystem *m_pInterrupt;
+    unsigned m_nTimerClockHz;
+    unsigned m_nRateHz;
+    volatile boolean m_bRunning;
+    unsigned m_nStartTicks;             ///< Clock ticks (us) of the last Start()
+    unsigned m_nSampledUs;              ///< Time sampled before the last Start()
+
+    TBucket m_Buckets[Buckets];
+    TTaskEntry m_Tasks[MaxTasks];
+    volatile u32 m_nSamples;
+    volatile u32 m_nDropped;
+};
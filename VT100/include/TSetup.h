@@ -161,15 +161,7 @@ private:
     CTKeyboard *m_pKeyboard;
     CTKeyboard::TKeyPressedHandler m_pPrevKeyPressed;
     CTKeyboard::TKeyStatusHandlerRaw m_pPrevKeyStatusRaw;
-    struct TSetupSnapshot
-    {
-        u8 *buffer;
-        size_t size;
-        bool valid;
-        bool stateValid;
-        CTRenderer::TRendererState rendererState;
-    };
-    TSetupSnapshot m_Snapshot;
+    u32 m_nSnapshot;                    ///< Terminal state parked by Show(), 0 if none
     bool m_Visible;
     bool m_ExitRequested;
     bool m_SaveRequested;
@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// Module:        CTSixelDecoder
+// Description:   Streaming DEC Sixel decoder drawing into the renderer shadow buffer.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/display.h>
+#include <circle/types.h>
+
+/**
+ * @file TSixelDecoder.h
+ * @brief Declares the Sixel graphics decoder used for DCS q sequences.
+ * @details Sixel data describes an image as bands six pixels high; each data
+ * byte carries one pixel column of the current band. CTSixelDecoder stores the
+ * pixels of every byte straight into the renderer's shadow buffer as the byte
+ * arrives, so no image buffer is needed and memory use is fixed: one palette of
+ * 256 color registers kept in raw framebuffer format.
+ */
+
+/**
+ * @class CTSixelDecoder
+ * @brief Byte-at-a-time Sixel parser with a raw-color palette cache.
+ * @details The decoder is owned by CTRenderer and fed under the renderer lock.
+ * Pixels outside the clip rectangle (the text area) are dropped. Rows touched
+ * by the current band are collected as damage and handed to the renderer with
+ * TakeDamage(). Without a target buffer the data is parsed only, which keeps
+ * the image height known for background consoles.
+ */
+class CTSixelDecoder
+{
+public:
+    /// \brief Pixel buffer the image is drawn into.
+    struct TTarget
+    {
+        u8 *pBuffer;        ///< Shadow buffer, nullptr to parse without drawing
+        unsigned nPitch;    ///< Bytes per pixel line
+        unsigned nDepth;    ///< Bits per pixel; 8, 16 and 32 are drawn
+        unsigned nOriginX;  ///< Left edge of the image in pixels
+        unsigned nOriginY;  ///< Top edge of the image in pixels
+        unsigned nClipX;    ///< First pixel column right of the drawable area
+        unsigned nClipY;    ///< First pixel line below the drawable area
+    };
+
+    static constexpr unsigned PaletteSize = 256;
+    static constexpr unsigned BandHeight = 6;
+    static constexpr unsigned MaxParams = 5;
+    static constexpr unsigned MaxParamValue = 9999;
+
+    CTSixelDecoder(void);
+    ~CTSixelDecoder(void);
+
+    /// \brief Start an image at the target origin.
+    /// \param rTarget Buffer, origin and clip rectangle.
+    /// \param pDisplay Display used to convert register colors to raw pixels.
+    /// \param bTransparent TRUE if zero bits keep the pixels below (DCS P2 = 1).
+    /// \param nBackground Raw color used to clear the raster area if not transparent.
+    void Begin(const TTarget &rTarget, const CDisplay *pDisplay, boolean bTransparent,
+               CDisplay::TRawColor nBackground);
+
+    /// \brief Decode one byte of Sixel data (the bytes between DCS q and ST).
+    void Write(char chChar);
+
+    /// \brief Finish the image; the last band is added to the damage.
+    void End(void);
+
+    /// \brief Keep parsing the current image without drawing, e.g. once its console is hidden.
+    void DetachTarget(void);
+
+    boolean IsActive(void) const { return m_bActive; }
+
+    /// \brief Fetch and reset the pixel lines changed since the last call.
+    /// \return FALSE if nothing was drawn.
+    boolean TakeDamage(unsigned &rPosY1, unsigned &rPosY2);
+
+    /// \brief Height of the image in pixels (bands with data or the raster height).
+    unsigned GetHeight(void) const { return m_nHeight; }
+
+    /// \brief Pixels stored since construction, for throughput measurements.
+    u64 GetPixelCount(void) const { return m_nPixelCount; }
+
+private:
+    enum TState
+    {
+        StateData,
+        StateRepeat,
+        StateColor,
+        StateRaster
+    };
+
+    /// \brief Store one sixel at the current position, nCount times.
+    void DrawSixel(unsigned nBits, unsigned nCount);
+    /// \brief Fill nCount pixels of one line starting at nPosX.
+    void FillSpan(unsigned nPosX, unsigned nPosY, unsigned nCount, CDisplay::TRawColor nColor);
+    /// \brief Move to the start of the next band ('-').
+    void NextBand(void);
+    /// \brief Add the current band to the damage if it was drawn into.
+    void MarkBandDamage(void);
+    /// \brief Extend the damaged pixel lines.
+    void AddDamage(unsigned nPosY1, unsigned nPosY2);
+    /// \brief Handle a completed '#' color introducer.
+    void ApplyColor(void);
+    /// \brief Handle completed '"' raster attributes.
+    void ApplyRaster(void);
+    /// \brief Convert the default VT340 registers for a new display or depth.
+    void BuildDefaultPalette(const CDisplay *pDisplay, unsigned nDepth);
+    /// \brief Convert an RGB triple in percent to a raw color of the current display.
+    CDisplay::TRawColor MapColor(unsigned nRed, unsigned nGreen, unsigned nBlue) const;
+
+    TTarget m_Target;
+    const CDisplay *m_pDisplay;
+    boolean m_bActive;
+    boolean m_bTransparent;
+    CDisplay::TRawColor m_nBackground;
+    TState m_State;
+    unsigned m_Params[MaxParams];
+    unsigned m_nParamCount;
+    unsigned m_nRepeat;
+    unsigned m_nPosX;
+    unsigned m_nBandY;
+    unsigned m_nHeight;
+    CDisplay::TRawColor m_nColor;
+    boolean m_bBandDirty;
+    boolean m_bDamaged;
+    unsigned m_nDamageY1;
+    unsigned m_nDamageY2;
+    u64 m_nPixelCount;
+
+    // Palette cache: registers hold raw pixels, converted once when defined
+    CDisplay::TRawColor m_Palette[PaletteSize];
+    CDisplay::TRawColor m_DefaultPalette[PaletteSize];
+    const CDisplay *m_pPaletteDisplay;
+    unsigned m_nPaletteDepth;
+};
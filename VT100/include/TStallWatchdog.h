@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// Module:        CTStallWatchdog
+// Description:   Detects stalled loops and records what the terminal was doing.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Capture kept across a watchdog reset, written at next boot
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/bcmwatchdog.h>
+#include <circle/string.h>
+#include <circle/synchronize.h>
+#include <circle/timer.h>
+#include <circle/types.h>
+
+/**
+ * @file TStallWatchdog.h
+ * @brief Declares the stall watchdog with its trace ring and state capture.
+ * @details A terminal that "freezes" in the field leaves nothing behind: the
+ * scheduler is cooperative, so one task that does not return (a long scroll,
+ * a socket Send() waiting for the peer, an SD f_sync(), a USB transfer) stops
+ * every other task, including the log outputs. CTStallWatchdog watches the
+ * main loop and the renderer, network and keyboard tasks from the system
+ * timer interrupt, which still runs, and freezes a copy of the recent trace
+ * events the moment one of them stops making progress.
+ */
+
+/**
+ * @class CTStallWatchdog
+ * @brief Progress watches, an event trace ring and a captured stall report.
+ * @details Loops call Beat() once per pass; the renderer task, which must
+ * stay host-buildable, is sampled through a loop counter instead
+ * (WatchCounter()). Trace() appends an event to a ring of TraceEntries; call
+ * sites bracket the calls that may block (render, socket send, f_sync, USB
+ * update) with a begin and an end event, so an unmatched begin names the
+ * culprit.
+ *
+ * The periodic timer handler (100 Hz, interrupt context) marks a watch
+ * stalled when it saw no progress for the configured timeout and copies the
+ * watch states, the running task and the trace ring into the capture. Tick()
+ * (kernel heartbeat, task context) formats the capture, appends it to
+ * `SD:/STALL.TXT` and logs it, which also reaches the telnet log console.
+ * Stalls that wait in a call that yields are written while they last; others
+ * are written as soon as the scheduler runs again.
+ *
+ * With reboot enabled the BCM watchdog is armed and fed from the timer
+ * handler while no watch is stalled, so a stall that does not end within
+ * RebootSeconds resets the board. The capture is then also kept in a
+ * `.noinit` block with a checksum, which Initialize() writes out after the
+ * reset.
+ */
+class CTStallWatchdog
+{
+public:
+    /// \brief Loops that must make progress.
+    enum TWatch
+    {
+        WatchMainLoop,
+        WatchRenderer,
+        WatchNetwork,
+        WatchKeyboard,
+        WatchCount
+    };
+
+    /// \brief Trace ring events; the argument is noted per event.
+    enum TTraceEvent
+    {
+        TraceSerialRx,          ///< Bytes drained from the UART
+        TraceNetRx,             ///< Bytes received in TCP host mode
+        TraceRenderBegin,       ///< Console << 24 | bytes handed to the renderer
+        TraceRenderEnd,
+        TraceNetSend,           ///< Bytes passed to CSocket::Send()
+        TraceNetSent,           ///< Result of CSocket::Send()
+        TraceFileSync,          ///< Pending log bytes before f_sync()
+        TraceFileSynced,        ///< FatFs result
+        TraceUsbBegin,          ///< USB plug-and-play and keyboard update
+        TraceUsbEnd,
+        TraceStall,             ///< Watch that stalled
+        TraceEventCount
+    };
+
+    /// \brief Access the singleton watchdog.
+    static CTStallWatchdog *Get(void);
+
+    /// \brief Start watching.
+    /// \param nTimeoutSeconds Time without progress that counts as a stall; 0 only traces.
+    /// \param bReboot TRUE to arm the hardware watchdog.
+    /// \return FALSE if the timer handler could not be registered.
+    boolean Initialize(unsigned nTimeoutSeconds, boolean bReboot);
+
+    /// \brief Sample a watch through a progress counter from the timer handler.
+    /// \param pSampler Returns a value that changes while the loop makes progress.
+    void WatchCounter(TWatch Watch, u32 (*pSampler)(void));
+
+    /// \brief Note progress of a watched loop; arms the watch on first use.
+    void Beat(TWatch Watch)
+    {
+        TWatchState &rState = m_Watches[Watch];
+        EnterCritical();
+        const unsigned nNow = CTimer::GetClockTicks();
+        if (rState.bStalled)
+        {
+            rState.nStallUs = nNow - rState.nLastBeat;
+            rState.bStalled = FALSE;
+            rState.bRecovered = TRUE;
+        }
+        rState.nLastBeat = nNow;
+        rState.bArmed = TRUE;
+        ++rState.nBeats;
+        LeaveCritical();
+    }
+
+    /// \brief Stop watching a loop that ends or waits on purpose.
+    void Disarm(TWatch Watch) { m_Watches[Watch].bArmed = FALSE; }
+
+    /// \brief Append an event to the trace ring (task context).
+    void Trace(TTraceEvent Event, u32 nArg)
+    {
+        TTraceEntry &rEntry = m_Trace[m_nTraceNext % TraceEntries];
+        rEntry.nTicks = CTimer::GetClockTicks();
+        rEntry.nEvent = static_cast<u32>(Event);
+        rEntry.nArg = nArg;
+        ++m_nTraceNext;
+    }
+
+    /// \brief Write a pending capture to SD and the log (kernel heartbeat).
+    void Tick(void);
+
+    /// \brief Text of the last stall report, empty if there was none.
+    const char *GetReport(void) const { return m_Report; }
+
+    /// \brief Number of stalls detected since boot.
+    unsigned GetStallCount(void) const { return m_nStalls; }
+
+    static constexpr unsigned TraceEntries = 64;
+    static constexpr unsigned MaxTimeoutSeconds = 60;
+    static constexpr unsigned RebootSeconds = 10;
+    static constexpr unsigned MaxFileBytes = 64 * 1024;
+
+private:
+    CTStallWatchdog(void);
+    ~CTStallWatchdog(void);
+
+    struct TWatchState
+    {
+        volatile unsigned nLastBeat;    ///< Clock ticks (us) of the last progress
+        volatile unsigned nStallUs;     ///< Length of the last stall, set when it ends
+        volatile u32 nBeats;
+        volatile boolean bArmed;
+        volatile boolean bStalled;
+        volatile boolean bRecovered;    ///< Stall ended, not yet logged
+        u32 (*pSampler)(void);
+        u32 nLastSample;
+    };
+
+    struct TTraceEntry
+    {
+        u32 nTicks;
+        u32 nEvent;
+        u32 nArg;
+    };
+
+    /// \brief Watch states, running task and trace ring as seen by the timer handler.
+    struct TCapture
+    {
+        unsigned nTicks;
+        unsigned nStall;                ///< Stall number since boot
+        unsigned nUptime;               ///< Seconds since boot
+        unsigned nWatch;                ///< Watch that stalled first
+        char TaskName[16];
+        struct
+        {
+            unsigned nSinceUs;
+            u32 nBeats;
+            boolean bArmed;
+            boolean bStalled;
+        } Watches[WatchCount];
+        TTraceEntry Trace[TraceEntries];
+        unsigned nTrace;                ///< Valid entries, oldest first
+    };
+
+    /// \brief Periodic timer handler (interrupt context).
+    static void TimerHandler(void);
+    /// \brief Check the watches and feed the hardware watchdog (interrupt context).
+    void Check(void);
+    /// \brief Freeze the state for a stall of Watch (interrupt context).
+    void Capture(unsigned nWatch, unsigned nNow);
+    /// \brief Turn the capture into m_Report; pNote follows the time of the stall.
+    void FormatReport(const char *pNote);
+    /// \brief Append m_Report to SD:/STALL.TXT.
+    void WriteReport(void);
+    /// \brief Log m_Report line by line.
+    void LogReport(void);
+    /// \brief Write a capture kept across a watchdog reset, if a valid one is there.
+    void WriteSavedReport(void);
+
+    static const char *GetWatchName(unsigned nWatch);
+    static const char *GetEventName(unsigned nEvent);
+
+    boolean m_bInitialized;
+    boolean m_bReboot;
+    unsigned m_nTimeoutUs;
+    unsigned m_nLastFeedTicks;
+    CBcmWatchdog m_Watchdog;
+
+    TWatchState m_Watches[WatchCount];
+    TTraceEntry m_Trace[TraceEntries];
+    volatile u32 m_nTraceNext;
+
+    TCapture m_Capture;
+    volatile boolean m_bCapturePending;
+    volatile unsigned m_nStalls;
+    CString m_Report;
+};
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-27     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Receive backlog query for the scroll governor
+// 2026-10-18     R. Zuehlsdorff        Overrun count and XOFF state for the performance HUD
 //------------------------------------------------------------------------------
 
 #pragma once
@@ -86,6 +88,26 @@ public:
      */
     int DrainSerialInput(char *dest, size_t maxLen);
 
+    /**
+     * @brief Number of received bytes still waiting in the ring buffer.
+     */
+    unsigned GetRxBacklog();
+
+    /**
+     * @brief Number of receive overruns (data lost) since boot.
+     */
+    unsigned GetOverrunCount() const { return m_nOverruns; }
+
+    /**
+     * @brief Check whether software flow control is enabled.
+     */
+    bool IsFlowControlEnabled() const { return m_bSoftwareFlowControl; }
+
+    /**
+     * @brief Check whether XOFF was sent and the host is held.
+     */
+    bool IsFlowStopped() const { return m_bFlowStopped; }
+
 private:
     class CSerialDeviceWithAccess : public CSerialDevice
     {
@@ -102,6 +124,7 @@ private:
     bool m_bFlowStopped = false;
     unsigned m_FlowHighThreshold = 0;
     unsigned m_FlowLowThreshold = 0;
+    volatile unsigned m_nOverruns = 0;
 
     // Static receive handler pointer
     static ReceiveHandler g_ReceiveHandler;
@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// Module:        CTWarmResume
+// Description:   Persists the terminal screen to SD and restores it after reboot.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Checksum over the cells in the header
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+#include <fatfs/ff.h>
+
+#include "TCellBuffer.h"
+
+/**
+ * @file TWarmResume.h
+ * @brief Declares the warm-resume persistence of the terminal screen.
+ * @details After a power cycle the host would otherwise have to redraw the
+ * whole screen, which takes long on slow serial lines. CTWarmResume keeps a
+ * compact image of the cell grid, cursor, rendition, charsets, scroll region,
+ * modes and tab stops in a fixed-layout file on the SD card. The image is
+ * updated row by row while the host is idle and restored during boot with one
+ * sequential read followed by a single render pass.
+ */
+
+class CTRenderer;
+class CTConfig;
+
+/**
+ * @class CTWarmResume
+ * @brief Incremental screen image writer and boot-time restorer.
+ * @details The file starts with a 64 byte header followed by the cells in
+ * row-major order, so a changed row can be rewritten in place. Tick() is
+ * driven from the kernel heartbeat; it only touches the SD card after the
+ * renderer has seen no host data for IdleDelayMs and writes at most
+ * RowsPerTick rows per call. The header is written last in each pass and
+ * carries a checksum over the checksums of all rows as written, so an image
+ * whose cells were damaged or belong to an unfinished pass is not restored.
+ */
+class CTWarmResume
+{
+public:
+    /// \brief Access the singleton warm-resume instance.
+    static CTWarmResume *Get(void);
+
+    /// \brief Attach renderer and configuration and open the image file.
+    /// \param pRenderer Renderer whose screen is persisted.
+    /// \param pConfig Configuration holding the tab stops.
+    /// \param pFileName Image path on the SD card.
+    /// \return TRUE if the image file could be opened or created.
+    bool Initialize(CTRenderer *pRenderer, CTConfig *pConfig, const char *pFileName = DefaultFileName);
+
+    /// \brief Restore the persisted screen, if present and compatible.
+    /// \return TRUE if the screen was restored.
+    bool Restore(void);
+
+    /// \brief Persist changed rows while the host is idle (kernel heartbeat).
+    void Tick(void);
+
+    /// \brief Stop persisting and close the image file.
+    void Stop(void);
+
+    static constexpr const char *DefaultFileName = "SD:/VT100.scr";
+    static constexpr unsigned HeaderSize = 64;
+    static constexpr unsigned MaxColumns = 256;
+    static constexpr unsigned MaxRows = 128;
+    static constexpr unsigned IdleDelayMs = 1000;
+    static constexpr unsigned RowsPerTick = 4;
+
+private:
+    CTWarmResume(void);
+    ~CTWarmResume(void);
+
+    /// \brief Serialize the renderer and tab stop state into a header image.
+    void BuildHeader(u8 *pHeader) const;
+    /// \brief Write one row at its fixed file offset.
+    bool WriteRow(unsigned nRow);
+    /// \brief Write the header and commit the pass to the card.
+    bool WriteHeader(const u8 *pHeader);
+    /// \brief Match the per-row bookkeeping to the current screen geometry.
+    bool SyncGeometry(void);
+    /// \brief Disable persistence after an SD error.
+    void Fail(const char *pWhat, FRESULT result);
+
+    CTRenderer *m_pRenderer;
+    CTConfig *m_pConfig;
+    FIL m_File;
+    bool m_FileOpen;
+    bool m_Active;
+    unsigned m_nColumns;
+    unsigned m_nRows;
+    u32 *m_pWrittenGenerations;
+    u32 *m_pWrittenChecksums;           ///< FNV-1a of each row as written to the card
+    u32 m_nWrittenGeneration;
+    bool m_bHeaderPending;
+    u8 m_WrittenHeader[HeaderSize];
+    CTCellBuffer::TCell m_RowBuffer[MaxColumns];
+};
@@ -7,6 +7,11 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-02-02     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Screen query commands (screen/rect/since)
+// 2026-10-18     R. Zuehlsdorff        MCCP2 (telnet COMPRESS2) output compression
+// 2026-10-18     R. Zuehlsdorff        Socket byte counters for the performance HUD
+// 2026-10-18     R. Zuehlsdorff        'profile' command for the PC sampler
+// 2026-10-18     R. Zuehlsdorff        Serialise the MCCP2 stream with one task mutex
 //------------------------------------------------------------------------------
 
 #pragma once
@@ -16,11 +21,14 @@
 #include <circle/net/ipaddress.h>
 #include <circle/net/netsubsystem.h>
 #include <circle/net/socket.h>
+#include <circle/sched/mutex.h>
 #include <circle/sched/task.h>
 #include <circle/spinlock.h>
 #include <circle/string.h>
 #include <circle/types.h>
 
+#include "TDeflateStream.h"
+
 /**
  * @file TWlanLog.h
  * @brief Declares the WLAN-backed logging device and task.
@@ -73,8 +81,12 @@ public:
     bool IsClientConnected() const;
     /// \brief Check whether active session is in TCP host bridge mode.
     bool IsHostModeActive() const;
+    /// \brief Bytes received from clients since boot (free running).
+    u32 GetRxByteCount() const { return m_RxBytes; }
+    /// \brief Bytes passed to the client socket since boot, after compression (free running).
+    u32 GetTxByteCount() const { return m_TxBytes; }
 
-    /// \brief Send raw data to the active client if present.
+    /// \brief Send data to the active client if present, compressed once MCCP2 is active.
     void Send(const char *buffer, size_t length);
     /// \brief Send host-bound data when host bridge mode is active.
     bool SendHostData(const char *buffer, size_t length);
@@ -121,6 +133,29 @@ private:
     void SendTelnetCommand(u8 verb, u8 option);
     /// \brief Emit a minimal telnet negotiation set for terminal clients.
     void SendTelnetNegotiation();
+    /// \brief Write bytes to the socket unchanged.
+    /// \return false if the client is gone or the send failed.
+    bool SendRaw(const char *buffer, size_t length);
+    /// \brief Compress data into the MCCP2 stream and sync-flush it.
+    /// \details Runs stored blocks only while the CPU budget of an earlier flush
+    /// was exceeded, so bursts of log output do not stall the other tasks.
+    /// The caller holds m_StreamLock across the call.
+    void SendCompressed(const char *buffer, size_t length);
+    /// \brief Switch the output to MCCP2 after the client accepted COMPRESS2.
+    void StartCompression();
+    /// \brief End the zlib stream; later output goes out uncompressed.
+    void StopCompression();
+    /// \brief Format the MCCP2 ratio and CPU statistics of this session.
+    void FormatCompressionStats(CString &line) const;
+    /// \brief Handle the "screen" command family (full dump, rectangle, changed rows).
+    void HandleScreenCommand(const char *args);
+    /// \brief Handle the "profile" command family (status, start, stop, clear, dump, save).
+    void HandleProfileCommand(const char *args);
+    /// \brief Send rows of the rectangle whose generation is newer than nSince.
+    /// \details Each row is copied under the renderer lock on its own and
+    /// formatted afterwards, so the renderer is never held for longer than one
+    /// row copy.
+    void SendScreenRows(unsigned nTopRow, unsigned nEndRow, unsigned nFirstColumn, unsigned nEndColumn, u32 nSince);
     /// \brief Log client connection information.
     void AnnounceConnection(const CIPAddress &remoteIP, u16 remotePort);
     /// \brief Reset connection state tracking variables.
@@ -153,7 +188,24 @@ private:
     ETelnetRxState m_TelnetRxState;
     u8 m_TelnetCommand;
 
+    // MCCP2 state; the deflate context is fixed memory owned by the singleton
+    CTDeflateStream m_Deflate;
+    u8 m_CompressOutput[CTDeflateStream::MaxOutput(CTDeflateStream::MaxInputChunk)];
+    bool m_CompressOffered;
+    bool m_CompressActive;
+    u64 m_CompressPlainUntilUs;
+    u64 m_CompressBytesIn;
+    u64 m_CompressBytesOut;
+    u64 m_CompressCpuUs;
+    unsigned m_CompressFallbacks;
+
+    volatile u32 m_RxBytes;
+    volatile u32 m_TxBytes;
+
     CString m_RxLineBuffer;
     mutable CSpinLock m_ConnectionLock;
     mutable CSpinLock m_SendLock;
+    // Owns the byte stream: held across compress, flush and every socket send
+    // of one block, since Send() may yield to another task; recursive
+    CMutex m_StreamLock;
 };
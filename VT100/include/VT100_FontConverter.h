@@ -7,12 +7,15 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2025-12-05     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Pre-shaded CRT glyph atlases
+// 2026-10-18     R. Zuehlsdorff        Generated atlases and per-glyph row masks
 //------------------------------------------------------------------------------
 
 #pragma once
 
 #include <circle/types.h>
 #include <circle/font.h>
+#include <circle/chargenerator.h>
 
 // Forward declaration for font selection enum to avoid circular dependency
 enum class EFontSelection : unsigned int;
@@ -45,3 +48,64 @@ void ConvertVT100GraphicsToCircle(void);
 void ConvertVT100GraphicsToCircle_SolidDoubling(void);
 /// \brief Convert the graphics font 8x20 variant.
 void ConvertVT100GraphicsToCircle_8x20(void);
+
+/// \brief Intensity levels of a CRT atlas pixel: 0 is background, CrtShadeLevels - 1 a lit dot.
+static constexpr unsigned CrtShadeLevels = 16;
+
+/// \brief Strength of the simulated CRT effects in percent (0..100 each).
+struct TCrtEffects
+{
+    unsigned scanlines; ///< Darkening of every second ROM scan line
+    unsigned bloom;     ///< Spill of a lit dot into its left and right neighbours
+    unsigned glow;      ///< Halo around the strokes, meant for amber and green phosphor
+};
+
+/// \brief Lines per atlas glyph that a row mask can describe.
+static constexpr unsigned MaxGlyphAtlasHeight = 64;
+
+/**
+ * @brief Pre-shaded glyphs of one font in one size.
+ * @details Holds one intensity level per pixel for every glyph of the font,
+ * laid out like the character cell, plus a blank glyph for codes outside the
+ * font. The renderer maps the levels through a color ramp, so the effects cost
+ * the same per pixel as a plain bitmap lookup. The row mask of a glyph has bit
+ * y set when line y has a pixel above level 0, so blank lines (the gaps of the
+ * scan-line fonts, the space below the glyph) are filled without lookups.
+ */
+struct TCrtGlyphAtlas
+{
+    unsigned width;     ///< Pixels per glyph line (character cell width)
+    unsigned height;    ///< Lines per glyph (character cell height)
+    unsigned firstChar; ///< First code with its own glyph
+    unsigned lastChar;  ///< Last code with its own glyph
+    const u8 *levels;   ///< Glyphs firstChar..lastChar followed by the blank glyph
+    const u64 *rowMasks; ///< One mask per glyph of levels
+    u64 *storage;       ///< Heap block of a built atlas, nullptr for a generated one
+
+    /// \brief Glyph index of a character, the blank glyph if the font lacks it.
+    unsigned GetGlyphIndex(char chChar) const
+    {
+        const unsigned code = static_cast<u8>(chChar);
+        return (code >= firstChar && code <= lastChar) ? code - firstChar : lastChar - firstChar + 1;
+    }
+
+    /// \brief Levels of the glyph for a character.
+    const u8 *GetGlyph(char chChar) const { return levels + GetGlyphIndex(chChar) * width * height; }
+
+    /// \brief Lines of the glyph for a character that are not blank.
+    u64 GetRowMask(char chChar) const { return rowMasks[GetGlyphIndex(chChar)]; }
+};
+
+/// \brief Render all glyphs of a font in the given size with the CRT effects applied.
+/// \return FALSE if the atlas could not be allocated.
+boolean BuildCrtGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags,
+                           const TCrtEffects &rEffects, TCrtGlyphAtlas &rAtlas);
+
+/// \brief Take the generated atlas of a font (VT100_GlyphAtlas.h) if there is one.
+/// \details Generated atlases equal BuildCrtGlyphAtlas() without effects and
+/// live in the kernel image, so switching fonts costs no conversion.
+/// \return FALSE if the font in this size has no generated atlas.
+boolean GetGeneratedGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags, TCrtGlyphAtlas &rAtlas);
+
+/// \brief Release an atlas built by BuildCrtGlyphAtlas(); generated atlases are only forgotten.
+void FreeCrtGlyphAtlas(TCrtGlyphAtlas &rAtlas);
@@ -0,0 +1,11681 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_GlyphAtlas
+// Description:   Pre-shaded glyph atlases of the VT100 fonts (generated)
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+// GENERATED by tools/host_renderer/VT100_ATLAS - do not edit; after changing
+// the font sources run `make atlas` in tools/host_renderer.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+#include "TFontConverter.h"
+
+/**
+ * @file VT100_GlyphAtlas.h
+ * @brief Glyph atlases of all VT100 fonts in normal size without CRT effects.
+ * @details Equal to BuildCrtGlyphAtlas() with all effects 0, so the firmware
+ * takes them from the kernel image instead of converting pixel lines at run
+ * time. Included by VT100_FontConverter.cpp only.
+ */
+
+namespace VT100GlyphAtlas
+{
+struct TEntry
+{
+    EFontSelection font;
+    unsigned width;
+    unsigned height;
+    unsigned firstChar;
+    unsigned lastChar;
+    const u8 *levels;
+    const u64 *rowMasks;
+};
+
+// Levels: o = background, X = full intensity
+static constexpr u8 o = 0;
+static constexpr u8 X = 15;
+
+// VT100Font10x20: 10x22, 0x00..0x7F and the blank glyph
+static const u8 Text10x20Levels[] = {
+    // 0x00
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x01
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x02
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x03
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x04
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x05
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x06
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x07
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x08
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x09
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0A
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0B
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0C
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0D
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0E
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0F
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x10
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x11
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x12
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x13
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x14
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x15
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x16
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x17
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x18
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x19
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1A
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1B
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1C
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1D
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1E
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1F
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x20 ' '
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x21 '!'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x22 '"'
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x23 '#'
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x24 '$'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x25 '%'
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x26 '&'
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x27 '''
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x28 '('
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x29 ')'
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2A '*'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2B '+'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2C ','
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2D '-'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2E '.'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2F '/'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x30 '0'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x31 '1'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x32 '2'
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x33 '3'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x34 '4'
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x35 '5'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x36 '6'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x37 '7'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x38 '8'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x39 '9'
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3A ':'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3B ';'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3C '<'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3D '='
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3E '>'
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3F '?'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x40 '@'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x41 'A'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x42 'B'
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x43 'C'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x44 'D'
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x45 'E'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x46 'F'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x47 'G'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x48 'H'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x49 'I'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4A 'J'
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4B 'K'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4C 'L'
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4D 'M'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4E 'N'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4F 'O'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x50 'P'
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x51 'Q'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x52 'R'
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x53 'S'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x54 'T'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x55 'U'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x56 'V'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x57 'W'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x58 'X'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x59 'Y'
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5A 'Z'
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5B '['
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5C
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5D ']'
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5E '^'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5F '_'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x60 '`'
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,X,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7F
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+};
+static const u64 Text10x20RowMasks[] = {
+    0x0000000000000000ULL, // 0x00
+    0x0000000000001555ULL, // 0x01
+    0x0000000000001555ULL, // 0x02
+    0x0000000000015555ULL, // 0x03
+    0x0000000000015555ULL, // 0x04
+    0x0000000000015555ULL, // 0x05
+    0x0000000000015555ULL, // 0x06
+    0x0000000000000055ULL, // 0x07
+    0x0000000000001554ULL, // 0x08
+    0x0000000000015555ULL, // 0x09
+    0x0000000000015555ULL, // 0x0A
+    0x0000000000000055ULL, // 0x0B
+    0x0000000000015540ULL, // 0x0C
+    0x0000000000015540ULL, // 0x0D
+    0x0000000000000055ULL, // 0x0E
+    0x0000000000015555ULL, // 0x0F
+    0x0000000000000000ULL, // 0x10
+    0x0000000000000004ULL, // 0x11
+    0x0000000000000040ULL, // 0x12
+    0x0000000000000400ULL, // 0x13
+    0x0000000000004000ULL, // 0x14
+    0x0000000000015555ULL, // 0x15
+    0x0000000000015555ULL, // 0x16
+    0x0000000000000055ULL, // 0x17
+    0x0000000000015540ULL, // 0x18
+    0x0000000000015555ULL, // 0x19
+    0x0000000000005555ULL, // 0x1A
+    0x0000000000005555ULL, // 0x1B
+    0x0000000000001550ULL, // 0x1C
+    0x0000000000001555ULL, // 0x1D
+    0x0000000000005555ULL, // 0x1E
+    0x0000000000000040ULL, // 0x1F
+    0x0000000000000000ULL, // 0x20 ' '
+    0x0000000000001155ULL, // 0x21 '!'
+    0x0000000000000015ULL, // 0x22 '"'
+    0x0000000000001555ULL, // 0x23 '#'
+    0x0000000000001555ULL, // 0x24 '$'
+    0x0000000000001555ULL, // 0x25 '%'
+    0x0000000000001555ULL, // 0x26 '&'
+    0x0000000000000015ULL, // 0x27 '''
+    0x0000000000001555ULL, // 0x28 '('
+    0x0000000000001555ULL, // 0x29 ')'
+    0x0000000000000554ULL, // 0x2A '*'
+    0x0000000000000554ULL, // 0x2B '+'
+    0x0000000000005400ULL, // 0x2C ','
+    0x0000000000000040ULL, // 0x2D '-'
+    0x0000000000001400ULL, // 0x2E '.'
+    0x0000000000001555ULL, // 0x2F '/'
+    0x0000000000001555ULL, // 0x30 '0'
+    0x0000000000001555ULL, // 0x31 '1'
+    0x0000000000001555ULL, // 0x32 '2'
+    0x0000000000001555ULL, // 0x33 '3'
+    0x0000000000001555ULL, // 0x34 '4'
+    0x0000000000001555ULL, // 0x35 '5'
+    0x0000000000001555ULL, // 0x36 '6'
+    0x0000000000001555ULL, // 0x37 '7'
+    0x0000000000001555ULL, // 0x38 '8'
+    0x0000000000001555ULL, // 0x39 '9'
+    0x0000000000001414ULL, // 0x3A ':'
+    0x0000000000005414ULL, // 0x3B ';'
+    0x0000000000001555ULL, // 0x3C '<'
+    0x0000000000000110ULL, // 0x3D '='
+    0x0000000000001555ULL, // 0x3E '>'
+    0x0000000000001155ULL, // 0x3F '?'
+    0x0000000000001555ULL, // 0x40 '@'
+    0x0000000000001555ULL, // 0x41 'A'
+    0x0000000000001555ULL, // 0x42 'B'
+    0x0000000000001555ULL, // 0x43 'C'
+    0x0000000000001555ULL, // 0x44 'D'
+    0x0000000000001555ULL, // 0x45 'E'
+    0x0000000000001555ULL, // 0x46 'F'
+    0x0000000000001555ULL, // 0x47 'G'
+    0x0000000000001555ULL, // 0x48 'H'
+    0x0000000000001555ULL, // 0x49 'I'
+    0x0000000000001555ULL, // 0x4A 'J'
+    0x0000000000001555ULL, // 0x4B 'K'
+    0x0000000000001555ULL, // 0x4C 'L'
+    0x0000000000001555ULL, // 0x4D 'M'
+    0x0000000000001555ULL, // 0x4E 'N'
+    0x0000000000001555ULL, // 0x4F 'O'
+    0x0000000000001555ULL, // 0x50 'P'
+    0x0000000000001555ULL, // 0x51 'Q'
+    0x0000000000001555ULL, // 0x52 'R'
+    0x0000000000001555ULL, // 0x53 'S'
+    0x0000000000001555ULL, // 0x54 'T'
+    0x0000000000001555ULL, // 0x55 'U'
+    0x0000000000001555ULL, // 0x56 'V'
+    0x0000000000001555ULL, // 0x57 'W'
+    0x0000000000001555ULL, // 0x58 'X'
+    0x0000000000001555ULL, // 0x59 'Y'
+    0x0000000000001555ULL, // 0x5A 'Z'
+    0x0000000000001555ULL, // 0x5B '['
+    0x0000000000001555ULL, // 0x5C
+    0x0000000000001555ULL, // 0x5D ']'
+    0x0000000000000055ULL, // 0x5E '^'
+    0x0000000000001000ULL, // 0x5F '_'
+    0x0000000000000015ULL, // 0x60 '`'
+    0x0000000000001550ULL, // 0x61 'a'
+    0x0000000000001555ULL, // 0x62 'b'
+    0x0000000000001550ULL, // 0x63 'c'
+    0x0000000000001555ULL, // 0x64 'd'
+    0x0000000000001550ULL, // 0x65 'e'
+    0x0000000000001555ULL, // 0x66 'f'
+    0x0000000000015554ULL, // 0x67 'g'
+    0x0000000000001555ULL, // 0x68 'h'
+    0x0000000000001551ULL, // 0x69 'i'
+    0x0000000000015551ULL, // 0x6A 'j'
+    0x0000000000001555ULL, // 0x6B 'k'
+    0x0000000000001555ULL, // 0x6C 'l'
+    0x0000000000001550ULL, // 0x6D 'm'
+    0x0000000000001550ULL, // 0x6E 'n'
+    0x0000000000001550ULL, // 0x6F 'o'
+    0x0000000000015550ULL, // 0x70 'p'
+    0x0000000000015550ULL, // 0x71 'q'
+    0x0000000000001550ULL, // 0x72 'r'
+    0x0000000000001550ULL, // 0x73 's'
+    0x0000000000001555ULL, // 0x74 't'
+    0x0000000000001550ULL, // 0x75 'u'
+    0x0000000000001550ULL, // 0x76 'v'
+    0x0000000000001550ULL, // 0x77 'w'
+    0x0000000000001550ULL, // 0x78 'x'
+    0x0000000000015550ULL, // 0x79 'y'
+    0x0000000000001550ULL, // 0x7A 'z'
+    0x0000000000001555ULL, // 0x7B '{'
+    0x0000000000005415ULL, // 0x7C '|'
+    0x0000000000001555ULL, // 0x7D '}'
+    0x0000000000000015ULL, // 0x7E '~'
+    0x0000000000000000ULL, // 0x7F
+    0x0000000000000000ULL, // blank
+};
+
+// VT100Font10x20Solid: 10x22, 0x00..0x7F and the blank glyph
+static const u8 Text10x20SolidLevels[] = {
+    // 0x00
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x01
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x02
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x03
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x04
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,X,X,o,o,
+    X,X,o,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x05
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x06
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x07
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x08
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x09
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,X,o,X,X,o,o,o,o,
+    X,X,X,o,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,o,X,X,X,o,o,o,o,
+    X,X,o,X,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0A
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0B
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0C
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0D
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0E
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x0F
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x10
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x11
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x12
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x13
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x14
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x15
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x16
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x17
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x18
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x19
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1A
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1B
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1C
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1D
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1E
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,o,X,X,X,o,o,
+    X,X,X,X,o,X,X,X,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x1F
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x20 ' '
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x21 '!'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x22 '"'
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x23 '#'
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x24 '$'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,X,X,o,X,X,o,o,
+    o,o,o,X,X,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x25 '%'
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,X,o,o,
+    o,X,X,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x26 '&'
+    o,X,X,X,X,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x27 '''
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x28 '('
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x29 ')'
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2A '*'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2B '+'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2C ','
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2D '-'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2E '.'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x2F '/'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x30 '0'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x31 '1'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x32 '2'
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x33 '3'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x34 '4'
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x35 '5'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x36 '6'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x37 '7'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x38 '8'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x39 '9'
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3A ':'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3B ';'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3C '<'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3D '='
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3E '>'
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x3F '?'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x40 '@'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x41 'A'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x42 'B'
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x43 'C'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x44 'D'
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x45 'E'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x46 'F'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x47 'G'
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x48 'H'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x49 'I'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4A 'J'
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4B 'K'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4C 'L'
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4D 'M'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,o,o,X,X,X,o,o,
+    X,X,X,o,o,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4E 'N'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,X,o,o,X,X,o,o,
+    X,X,X,X,o,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x4F 'O'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x50 'P'
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x51 'Q'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x52 'R'
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x53 'S'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x54 'T'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x55 'U'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x56 'V'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x57 'W'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x58 'X'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x59 'Y'
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5A 'Z'
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5B '['
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5C
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5D ']'
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5E '^'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x5F '_'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x60 '`'
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    o,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,o,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,X,X,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    X,X,o,X,X,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,X,X,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    X,X,X,o,o,X,X,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    X,X,o,o,o,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    X,X,o,X,X,X,X,o,o,o,
+    o,X,X,X,o,o,X,X,o,o,
+    o,X,X,X,o,o,X,X,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    X,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    X,X,X,X,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,X,X,o,X,X,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    o,X,X,o,X,X,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    X,X,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,o,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,X,X,X,o,o,X,X,o,o,
+    o,X,X,X,o,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    X,X,o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7F
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+};
+static const u64 Text10x20SolidRowMasks[] = {
+    0x0000000000000000ULL, // 0x00
+    0x0000000000003FFFULL, // 0x01
+    0x0000000000003FFFULL, // 0x02
+    0x000000000003FFFFULL, // 0x03
+    0x000000000003FFFFULL, // 0x04
+    0x000000000003FFFFULL, // 0x05
+    0x000000000003FFFFULL, // 0x06
+    0x00000000000000FFULL, // 0x07
+    0x0000000000003FFCULL, // 0x08
+    0x000000000003FFFFULL, // 0x09
+    0x000000000003FFFFULL, // 0x0A
+    0x00000000000000FFULL, // 0x0B
+    0x000000000003FFC0ULL, // 0x0C
+    0x000000000003FFC0ULL, // 0x0D
+    0x00000000000000FFULL, // 0x0E
+    0x000000000003FFFFULL, // 0x0F
+    0x0000000000000000ULL, // 0x10
+    0x000000000000000CULL, // 0x11
+    0x00000000000000C0ULL, // 0x12
+    0x0000000000000C00ULL, // 0x13
+    0x000000000000C000ULL, // 0x14
+    0x000000000003FFFFULL, // 0x15
+    0x000000000003FFFFULL, // 0x16
+    0x00000000000000FFULL, // 0x17
+    0x000000000003FFC0ULL, // 0x18
+    0x000000000003FFFFULL, // 0x19
+    0x000000000000FFFFULL, // 0x1A
+    0x000000000000FFFFULL, // 0x1B
+    0x0000000000003FF0ULL, // 0x1C
+    0x0000000000003FFFULL, // 0x1D
+    0x000000000000FFFFULL, // 0x1E
+    0x00000000000000C0ULL, // 0x1F
+    0x0000000000000000ULL, // 0x20 ' '
+    0x00000000000033FFULL, // 0x21 '!'
+    0x000000000000003FULL, // 0x22 '"'
+    0x0000000000003FFFULL, // 0x23 '#'
+    0x0000000000003FFFULL, // 0x24 '$'
+    0x0000000000003FFFULL, // 0x25 '%'
+    0x0000000000003FFFULL, // 0x26 '&'
+    0x000000000000003FULL, // 0x27 '''
+    0x0000000000003FFFULL, // 0x28 '('
+    0x0000000000003FFFULL, // 0x29 ')'
+    0x0000000000000FFCULL, // 0x2A '*'
+    0x0000000000000FFCULL, // 0x2B '+'
+    0x000000000000FC00ULL, // 0x2C ','
+    0x00000000000000C0ULL, // 0x2D '-'
+    0x0000000000003C00ULL, // 0x2E '.'
+    0x0000000000003FFFULL, // 0x2F '/'
+    0x0000000000003FFFULL, // 0x30 '0'
+    0x0000000000003FFFULL, // 0x31 '1'
+    0x0000000000003FFFULL, // 0x32 '2'
+    0x0000000000003FFFULL, // 0x33 '3'
+    0x0000000000003FFFULL, // 0x34 '4'
+    0x0000000000003FFFULL, // 0x35 '5'
+    0x0000000000003FFFULL, // 0x36 '6'
+    0x0000000000003FFFULL, // 0x37 '7'
+    0x0000000000003FFFULL, // 0x38 '8'
+    0x0000000000003FFFULL, // 0x39 '9'
+    0x0000000000003C3CULL, // 0x3A ':'
+    0x000000000000FC3CULL, // 0x3B ';'
+    0x0000000000003FFFULL, // 0x3C '<'
+    0x0000000000000330ULL, // 0x3D '='
+    0x0000000000003FFFULL, // 0x3E '>'
+    0x00000000000033FFULL, // 0x3F '?'
+    0x0000000000003FFFULL, // 0x40 '@'
+    0x0000000000003FFFULL, // 0x41 'A'
+    0x0000000000003FFFULL, // 0x42 'B'
+    0x0000000000003FFFULL, // 0x43 'C'
+    0x0000000000003FFFULL, // 0x44 'D'
+    0x0000000000003FFFULL, // 0x45 'E'
+    0x0000000000003FFFULL, // 0x46 'F'
+    0x0000000000003FFFULL, // 0x47 'G'
+    0x0000000000003FFFULL, // 0x48 'H'
+    0x0000000000003FFFULL, // 0x49 'I'
+    0x0000000000003FFFULL, // 0x4A 'J'
+    0x0000000000003FFFULL, // 0x4B 'K'
+    0x0000000000003FFFULL, // 0x4C 'L'
+    0x0000000000003FFFULL, // 0x4D 'M'
+    0x0000000000003FFFULL, // 0x4E 'N'
+    0x0000000000003FFFULL, // 0x4F 'O'
+    0x0000000000003FFFULL, // 0x50 'P'
+    0x0000000000003FFFULL, // 0x51 'Q'
+    0x0000000000003FFFULL, // 0x52 'R'
+    0x0000000000003FFFULL, // 0x53 'S'
+    0x0000000000003FFFULL, // 0x54 'T'
+    0x0000000000003FFFULL, // 0x55 'U'
+    0x0000000000003FFFULL, // 0x56 'V'
+    0x0000000000003FFFULL, // 0x57 'W'
+    0x0000000000003FFFULL, // 0x58 'X'
+    0x0000000000003FFFULL, // 0x59 'Y'
+    0x0000000000003FFFULL, // 0x5A 'Z'
+    0x0000000000003FFFULL, // 0x5B '['
+    0x0000000000003FFFULL, // 0x5C
+    0x0000000000003FFFULL, // 0x5D ']'
+    0x00000000000000FFULL, // 0x5E '^'
+    0x0000000000003000ULL, // 0x5F '_'
+    0x000000000000003FULL, // 0x60 '`'
+    0x0000000000003FF0ULL, // 0x61 'a'
+    0x0000000000003FFFULL, // 0x62 'b'
+    0x0000000000003FF0ULL, // 0x63 'c'
+    0x0000000000003FFFULL, // 0x64 'd'
+    0x0000000000003FF0ULL, // 0x65 'e'
+    0x0000000000003FFFULL, // 0x66 'f'
+    0x000000000003FFFCULL, // 0x67 'g'
+    0x0000000000003FFFULL, // 0x68 'h'
+    0x0000000000003FF3ULL, // 0x69 'i'
+    0x000000000003FFF3ULL, // 0x6A 'j'
+    0x0000000000003FFFULL, // 0x6B 'k'
+    0x0000000000003FFFULL, // 0x6C 'l'
+    0x0000000000003FF0ULL, // 0x6D 'm'
+    0x0000000000003FF0ULL, // 0x6E 'n'
+    0x0000000000003FF0ULL, // 0x6F 'o'
+    0x000000000003FFF0ULL, // 0x70 'p'
+    0x000000000003FFF0ULL, // 0x71 'q'
+    0x0000000000003FF0ULL, // 0x72 'r'
+    0x0000000000003FF0ULL, // 0x73 's'
+    0x0000000000003FFFULL, // 0x74 't'
+    0x0000000000003FF0ULL, // 0x75 'u'
+    0x0000000000003FF0ULL, // 0x76 'v'
+    0x0000000000003FF0ULL, // 0x77 'w'
+    0x0000000000003FF0ULL, // 0x78 'x'
+    0x000000000003FFF0ULL, // 0x79 'y'
+    0x0000000000003FF0ULL, // 0x7A 'z'
+    0x0000000000003FFFULL, // 0x7B '{'
+    0x000000000000FC3FULL, // 0x7C '|'
+    0x0000000000003FFFULL, // 0x7D '}'
+    0x000000000000003FULL, // 0x7E '~'
+    0x0000000000000000ULL, // 0x7F
+    0x0000000000000000ULL, // blank
+};
+
+// VT100Font8x20: 8x22, 0x00..0x7F and the blank glyph
+static const u8 Text8x20Levels[] = {
+    // 0x00
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x01
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x02
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x03
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x04
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x05
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x06
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x07
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x08
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x09
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0A
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0B
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0C
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0D
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0E
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x0F
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x10
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x11
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x12
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x13
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x14
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x15
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x16
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x17
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x18
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x19
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1A
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1B
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1C
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1D
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1E
+    o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x1F
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x20 ' '
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x21 '!'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x22 '"'
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x23 '#'
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x24 '$'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x25 '%'
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x26 '&'
+    o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x27 '''
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x28 '('
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x29 ')'
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2A '*'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2B '+'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2C ','
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2D '-'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2E '.'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x2F '/'
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x30 '0'
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x31 '1'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x32 '2'
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x33 '3'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x34 '4'
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x35 '5'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x36 '6'
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x37 '7'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x38 '8'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x39 '9'
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3A ':'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3B ';'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3C '<'
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3D '='
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3E '>'
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x3F '?'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x40 '@'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x41 'A'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x42 'B'
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x43 'C'
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x44 'D'
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x45 'E'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x46 'F'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x47 'G'
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x48 'H'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x49 'I'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4A 'J'
+    o,o,o,o,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4B 'K'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4C 'L'
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4D 'M'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4E 'N'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x4F 'O'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x50 'P'
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x51 'Q'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x52 'R'
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x53 'S'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x54 'T'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x55 'U'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x56 'V'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x57 'W'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x58 'X'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x59 'Y'
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5A 'Z'
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5B '['
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5C
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5D ']'
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5E '^'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x5F '_'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x60 '`'
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,X,X,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7F
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+};
+static const u64 Text8x20RowMasks[] = {
+    0x0000000000000000ULL, // 0x00
+    0x0000000000001555ULL, // 0x01
+    0x0000000000001555ULL, // 0x02
+    0x0000000000015555ULL, // 0x03
+    0x0000000000015555ULL, // 0x04
+    0x0000000000015555ULL, // 0x05
+    0x0000000000015555ULL, // 0x06
+    0x0000000000000055ULL, // 0x07
+    0x0000000000001554ULL, // 0x08
+    0x0000000000015555ULL, // 0x09
+    0x0000000000015555ULL, // 0x0A
+    0x0000000000000055ULL, // 0x0B
+    0x0000000000015540ULL, // 0x0C
+    0x0000000000015540ULL, // 0x0D
+    0x0000000000000055ULL, // 0x0E
+    0x0000000000015555ULL, // 0x0F
+    0x0000000000000000ULL, // 0x10
+    0x0000000000000004ULL, // 0x11
+    0x0000000000000040ULL, // 0x12
+    0x0000000000000400ULL, // 0x13
+    0x0000000000004000ULL, // 0x14
+    0x0000000000015555ULL, // 0x15
+    0x0000000000015555ULL, // 0x16
+    0x0000000000000055ULL, // 0x17
+    0x0000000000015540ULL, // 0x18
+    0x0000000000015555ULL, // 0x19
+    0x0000000000005555ULL, // 0x1A
+    0x0000000000005555ULL, // 0x1B
+    0x0000000000001550ULL, // 0x1C
+    0x0000000000001555ULL, // 0x1D
+    0x0000000000005555ULL, // 0x1E
+    0x0000000000000040ULL, // 0x1F
+    0x0000000000000000ULL, // 0x20 ' '
+    0x0000000000001155ULL, // 0x21 '!'
+    0x0000000000000015ULL, // 0x22 '"'
+    0x0000000000001555ULL, // 0x23 '#'
+    0x0000000000001555ULL, // 0x24 '$'
+    0x0000000000001555ULL, // 0x25 '%'
+    0x0000000000001555ULL, // 0x26 '&'
+    0x0000000000000015ULL, // 0x27 '''
+    0x0000000000001555ULL, // 0x28 '('
+    0x0000000000001555ULL, // 0x29 ')'
+    0x0000000000000554ULL, // 0x2A '*'
+    0x0000000000000554ULL, // 0x2B '+'
+    0x0000000000005400ULL, // 0x2C ','
+    0x0000000000000040ULL, // 0x2D '-'
+    0x0000000000001400ULL, // 0x2E '.'
+    0x0000000000001555ULL, // 0x2F '/'
+    0x0000000000001555ULL, // 0x30 '0'
+    0x0000000000001555ULL, // 0x31 '1'
+    0x0000000000001555ULL, // 0x32 '2'
+    0x0000000000001555ULL, // 0x33 '3'
+    0x0000000000001555ULL, // 0x34 '4'
+    0x0000000000001555ULL, // 0x35 '5'
+    0x0000000000001555ULL, // 0x36 '6'
+    0x0000000000001555ULL, // 0x37 '7'
+    0x0000000000001555ULL, // 0x38 '8'
+    0x0000000000001555ULL, // 0x39 '9'
+    0x0000000000001414ULL, // 0x3A ':'
+    0x0000000000005414ULL, // 0x3B ';'
+    0x0000000000001555ULL, // 0x3C '<'
+    0x0000000000000110ULL, // 0x3D '='
+    0x0000000000001555ULL, // 0x3E '>'
+    0x0000000000001155ULL, // 0x3F '?'
+    0x0000000000001555ULL, // 0x40 '@'
+    0x0000000000001555ULL, // 0x41 'A'
+    0x0000000000001555ULL, // 0x42 'B'
+    0x0000000000001555ULL, // 0x43 'C'
+    0x0000000000001555ULL, // 0x44 'D'
+    0x0000000000001555ULL, // 0x45 'E'
+    0x0000000000001555ULL, // 0x46 'F'
+    0x0000000000001555ULL, // 0x47 'G'
+    0x0000000000001555ULL, // 0x48 'H'
+    0x0000000000001555ULL, // 0x49 'I'
+    0x0000000000001555ULL, // 0x4A 'J'
+    0x0000000000001555ULL, // 0x4B 'K'
+    0x0000000000001555ULL, // 0x4C 'L'
+    0x0000000000001555ULL, // 0x4D 'M'
+    0x0000000000001555ULL, // 0x4E 'N'
+    0x0000000000001555ULL, // 0x4F 'O'
+    0x0000000000001555ULL, // 0x50 'P'
+    0x0000000000001555ULL, // 0x51 'Q'
+    0x0000000000001555ULL, // 0x52 'R'
+    0x0000000000001555ULL, // 0x53 'S'
+    0x0000000000001555ULL, // 0x54 'T'
+    0x0000000000001555ULL, // 0x55 'U'
+    0x0000000000001555ULL, // 0x56 'V'
+    0x0000000000001555ULL, // 0x57 'W'
+    0x0000000000001555ULL, // 0x58 'X'
+    0x0000000000001555ULL, // 0x59 'Y'
+    0x0000000000001555ULL, // 0x5A 'Z'
+    0x0000000000001555ULL, // 0x5B '['
+    0x0000000000001555ULL, // 0x5C
+    0x0000000000001555ULL, // 0x5D ']'
+    0x0000000000000055ULL, // 0x5E '^'
+    0x0000000000001000ULL, // 0x5F '_'
+    0x0000000000000015ULL, // 0x60 '`'
+    0x0000000000001550ULL, // 0x61 'a'
+    0x0000000000001555ULL, // 0x62 'b'
+    0x0000000000001550ULL, // 0x63 'c'
+    0x0000000000001555ULL, // 0x64 'd'
+    0x0000000000001550ULL, // 0x65 'e'
+    0x0000000000001555ULL, // 0x66 'f'
+    0x0000000000015554ULL, // 0x67 'g'
+    0x0000000000001555ULL, // 0x68 'h'
+    0x0000000000001551ULL, // 0x69 'i'
+    0x0000000000015551ULL, // 0x6A 'j'
+    0x0000000000001555ULL, // 0x6B 'k'
+    0x0000000000001555ULL, // 0x6C 'l'
+    0x0000000000001550ULL, // 0x6D 'm'
+    0x0000000000001550ULL, // 0x6E 'n'
+    0x0000000000001550ULL, // 0x6F 'o'
+    0x0000000000015550ULL, // 0x70 'p'
+    0x0000000000015550ULL, // 0x71 'q'
+    0x0000000000001550ULL, // 0x72 'r'
+    0x0000000000001550ULL, // 0x73 's'
+    0x0000000000001555ULL, // 0x74 't'
+    0x0000000000001550ULL, // 0x75 'u'
+    0x0000000000001550ULL, // 0x76 'v'
+    0x0000000000001550ULL, // 0x77 'w'
+    0x0000000000001550ULL, // 0x78 'x'
+    0x0000000000015550ULL, // 0x79 'y'
+    0x0000000000001550ULL, // 0x7A 'z'
+    0x0000000000001555ULL, // 0x7B '{'
+    0x0000000000005415ULL, // 0x7C '|'
+    0x0000000000001555ULL, // 0x7D '}'
+    0x0000000000000015ULL, // 0x7E '~'
+    0x0000000000000000ULL, // 0x7F
+    0x0000000000000000ULL, // blank
+};
+
+// VT100GraphicsFont10x20: 10x22, 0x60..0x7E and the blank glyph
+static const u8 Graphics10x20Levels[] = {
+    // 0x60 '`'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+};
+static const u64 Graphics10x20RowMasks[] = {
+    0x0000000000005554ULL, // 0x60 '`'
+    0x0000000000055555ULL, // 0x61 'a'
+    0x0000000000005555ULL, // 0x62 'b'
+    0x0000000000005555ULL, // 0x63 'c'
+    0x0000000000005550ULL, // 0x64 'd'
+    0x0000000000001555ULL, // 0x65 'e'
+    0x0000000000000055ULL, // 0x66 'f'
+    0x0000000000004554ULL, // 0x67 'g'
+    0x0000000000000000ULL, // 0x68 'h'
+    0x0000000000001555ULL, // 0x69 'i'
+    0x0000000000000155ULL, // 0x6A 'j'
+    0x0000000000055500ULL, // 0x6B 'k'
+    0x0000000000055500ULL, // 0x6C 'l'
+    0x0000000000000155ULL, // 0x6D 'm'
+    0x0000000000055555ULL, // 0x6E 'n'
+    0x0000000000000001ULL, // 0x6F 'o'
+    0x0000000000000010ULL, // 0x70 'p'
+    0x0000000000000100ULL, // 0x71 'q'
+    0x0000000000001000ULL, // 0x72 'r'
+    0x0000000000010000ULL, // 0x73 's'
+    0x0000000000055555ULL, // 0x74 't'
+    0x0000000000055555ULL, // 0x75 'u'
+    0x0000000000000155ULL, // 0x76 'v'
+    0x0000000000055500ULL, // 0x77 'w'
+    0x0000000000055555ULL, // 0x78 'x'
+    0x0000000000015554ULL, // 0x79 'y'
+    0x0000000000015554ULL, // 0x7A 'z'
+    0x0000000000005550ULL, // 0x7B '{'
+    0x0000000000005554ULL, // 0x7C '|'
+    0x0000000000005555ULL, // 0x7D '}'
+    0x0000000000000500ULL, // 0x7E '~'
+    0x0000000000000000ULL, // blank
+};
+
+// VT100GraphicsFont10x20Solid: 10x22, 0x60..0x7E and the blank glyph
+static const u8 Graphics10x20SolidLevels[] = {
+    // 0x60 '`'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    X,X,o,o,o,o,X,X,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,X,X,X,X,X,X,X,X,X,
+    o,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,X,X,X,X,X,X,X,X,X,
+    o,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,X,X,
+    X,X,X,X,X,X,X,X,X,X,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    X,X,o,X,X,o,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,o,X,X,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,o,o,o,o,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,o,o,o,X,X,o,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,X,X,X,X,X,X,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,o,X,X,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    o,o,X,X,X,X,o,o,o,o,
+    o,o,X,X,X,X,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    X,X,X,X,X,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,o,o,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    o,X,X,o,o,X,X,o,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    X,X,X,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,o,o,
+};
+static const u64 Graphics10x20SolidRowMasks[] = {
+    0x000000000000FFFCULL, // 0x60 '`'
+    0x00000000000FFFFFULL, // 0x61 'a'
+    0x000000000000FFFFULL, // 0x62 'b'
+    0x000000000000FFFFULL, // 0x63 'c'
+    0x000000000000FFF0ULL, // 0x64 'd'
+    0x0000000000003FFFULL, // 0x65 'e'
+    0x00000000000000FFULL, // 0x66 'f'
+    0x000000000000CFFCULL, // 0x67 'g'
+    0x0000000000000000ULL, // 0x68 'h'
+    0x0000000000003FFFULL, // 0x69 'i'
+    0x00000000000003FFULL, // 0x6A 'j'
+    0x00000000000FFF00ULL, // 0x6B 'k'
+    0x00000000000FFF00ULL, // 0x6C 'l'
+    0x00000000000003FFULL, // 0x6D 'm'
+    0x00000000000FFFFFULL, // 0x6E 'n'
+    0x0000000000000003ULL, // 0x6F 'o'
+    0x0000000000000030ULL, // 0x70 'p'
+    0x0000000000000300ULL, // 0x71 'q'
+    0x0000000000003000ULL, // 0x72 'r'
+    0x0000000000030000ULL, // 0x73 's'
+    0x00000000000FFFFFULL, // 0x74 't'
+    0x00000000000FFFFFULL, // 0x75 'u'
+    0x00000000000003FFULL, // 0x76 'v'
+    0x00000000000FFF00ULL, // 0x77 'w'
+    0x00000000000FFFFFULL, // 0x78 'x'
+    0x000000000003FFFCULL, // 0x79 'y'
+    0x000000000003FFFCULL, // 0x7A 'z'
+    0x000000000000FFF0ULL, // 0x7B '{'
+    0x000000000000FFFCULL, // 0x7C '|'
+    0x000000000000FFFFULL, // 0x7D '}'
+    0x0000000000000F00ULL, // 0x7E '~'
+    0x0000000000000000ULL, // blank
+};
+
+// VT100GraphicsFont8x20: 8x22, 0x60..0x7E and the blank glyph
+static const u8 Graphics8x20Levels[] = {
+    // 0x60 '`'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x61 'a'
+    o,X,o,X,o,X,o,X,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,X,o,X,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,X,o,X,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,X,o,X,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,X,o,X,
+    o,o,o,o,o,o,o,o,
+    X,o,X,o,X,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x62 'b'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,X,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x63 'c'
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x64 'd'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x65 'e'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x66 'f'
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x67 'g'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x68 'h'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x69 'i'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6A 'j'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6B 'k'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6C 'l'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6D 'm'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6E 'n'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x6F 'o'
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x70 'p'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x71 'q'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x72 'r'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x73 's'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x74 't'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x75 'u'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x76 'v'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x77 'w'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,X,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x78 'x'
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x79 'y'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7A 'z'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7B '{'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    X,o,o,X,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7C '|'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,X,X,X,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,X,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7D '}'
+    o,o,X,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,X,o,o,o,X,o,o,
+    o,o,o,o,o,o,o,o,
+    X,X,X,X,X,X,X,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // 0x7E '~'
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,X,X,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    // blank
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+    o,o,o,o,o,o,o,o,
+};
+static const u64 Graphics8x20RowMasks[] = {
+    0x0000000000005554ULL, // 0x60 '`'
+    0x0000000000055555ULL, // 0x61 'a'
+    0x0000000000005555ULL, // 0x62 'b'
+    0x0000000000005555ULL, // 0x63 'c'
+    0x0000000000005550ULL, // 0x64 'd'
+    0x0000000000001555ULL, // 0x65 'e'
+    0x0000000000000055ULL, // 0x66 'f'
+    0x0000000000004554ULL, // 0x67 'g'
+    0x0000000000000000ULL, // 0x68 'h'
+    0x0000000000001555ULL, // 0x69 'i'
+    0x0000000000000155ULL, // 0x6A 'j'
+    0x0000000000055500ULL, // 0x6B 'k'
+    0x0000000000055500ULL, // 0x6C 'l'
+    0x0000000000000155ULL, // 0x6D 'm'
+    0x0000000000055555ULL, // 0x6E 'n'
+    0x0000000000000001ULL, // 0x6F 'o'
+    0x0000000000000010ULL, // 0x70 'p'
+    0x0000000000000100ULL, // 0x71 'q'
+    0x0000000000001000ULL, // 0x72 'r'
+    0x0000000000010000ULL, // 0x73 's'
+    0x0000000000055555ULL, // 0x74 't'
+    0x0000000000055555ULL, // 0x75 'u'
+    0x0000000000000155ULL, // 0x76 'v'
+    0x0000000000055500ULL, // 0x77 'w'
+    0x0000000000055555ULL, // 0x78 'x'
+    0x0000000000015554ULL, // 0x79 'y'
+    0x0000000000015554ULL, // 0x7A 'z'
+    0x0000000000005550ULL, // 0x7B '{'
+    0x0000000000005554ULL, // 0x7C '|'
+    0x0000000000005555ULL, // 0x7D '}'
+    0x0000000000000500ULL, // 0x7E '~'
+    0x0000000000000000ULL, // blank
+};
+
+static const TEntry Entries[] = {
+    {EFontSelection::VT100Font10x20, 10, 22, 0x00, 0x7F, Text10x20Levels, Text10x20RowMasks},
+    {EFontSelection::VT100Font10x20Solid, 10, 22, 0x00, 0x7F, Text10x20SolidLevels, Text10x20SolidRowMasks},
+    {EFontSelection::VT100Font8x20, 8, 22, 0x00, 0x7F, Text8x20Levels, Text8x20RowMasks},
+    {EFontSelection::VT100GraphicsFont10x20, 10, 22, 0x60, 0x7E, Graphics10x20Levels, Graphics10x20RowMasks},
+    {EFontSelection::VT100GraphicsFont10x20Solid, 10, 22, 0x60, 0x7E, Graphics10x20SolidLevels, Graphics10x20SolidRowMasks},
+    {EFontSelection::VT100GraphicsFont8x20, 8, 22, 0x60, 0x7E, Graphics8x20Levels, Graphics8x20RowMasks},
+};
+} // namespace VT100GlyphAtlas
@@ -136,6 +136,8 @@ private:
     bool m_bPendingResult = false;
     TTestResult m_pendingResult = ResultPending;
 
+    /// \brief Terminal state parked by Start(), 0 if none.
+    u32 m_nSnapshot = 0;
     bool m_hasSavedTabStops = false;
     bool m_savedTabStops[CTConfig::TabStopsMax]{};
     bool m_hasSavedSmoothScroll = false;
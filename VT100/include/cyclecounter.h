@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// Module:        cyclecounter.h
+// Description:   CPU cycle counter access for on-device microbenchmarks.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <circle/types.h>
+
+/**
+ * @file cyclecounter.h
+ * @brief Free-running 32-bit cycle counter of the CPU.
+ * @details The kernel timer ticks at HZ (10 ms) and the system timer counts
+ * microseconds; a glyph is drawn in a few microseconds. The cycle counter of
+ * the performance monitor unit counts CPU clocks instead:
+ *
+ * - ARM1176 (Pi Zero, Pi 1): CCNT in CP15 c15, enabled through PMNC.
+ * - ARMv7/ARMv8 in AArch32 (Pi 2/3/4): PMCCNTR, enabled through PMCR and
+ *   PMCNTENSET.
+ * - AArch64: PMCCNTR_EL0.
+ * - Host builds (tools/host_renderer): the x86 time stamp counter, or the
+ *   microsecond clock elsewhere.
+ *
+ * The counter wraps after 2^32 counts (about 4 s at 1 GHz); measure spans
+ * well below that and subtract as u32. Use CycleCounterEnable() once before
+ * the first read.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__arm__) && !defined(__aarch64__)
+#include <circle/timer.h>
+#endif
+
+/// \brief Start the cycle counter (no divider, counting from zero).
+static inline void CycleCounterEnable(void)
+{
+#if defined(__arm__) && __ARM_ARCH == 6
+    u32 nPMNC;
+    asm volatile("mrc p15, 0, %0, c15, c12, 0" : "=r"(nPMNC));
+    nPMNC &= ~(1U << 3);                        // D: count every cycle, not every 64th
+    nPMNC |= (1U << 0) | (1U << 2);             // E: enable, C: reset cycle counter
+    asm volatile("mcr p15, 0, %0, c15, c12, 0" : : "r"(nPMNC));
+#elif defined(__arm__)
+    u32 nPMCR;
+    asm volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(nPMCR));
+    nPMCR &= ~(1U << 3);                        // D: count every cycle, not every 64th
+    nPMCR |= (1U << 0) | (1U << 2);             // E: enable, C: reset cycle counter
+    asm volatile("mcr p15, 0, %0, c9, c12, 0" : : "r"(nPMCR));
+    asm volatile("mcr p15, 0, %0, c9, c12, 1" : : "r"(1U << 31));
+#elif defined(__aarch64__)
+    u64 nPMCR;
+    asm volatile("mrs %0, pmcr_el0" : "=r"(nPMCR));
+    nPMCR &= ~(1ULL << 3);
+    nPMCR |= (1ULL << 0) | (1ULL << 2);
+    asm volatile("msr pmcr_el0, %0" : : "r"(nPMCR));
+    asm volatile("msr pmcntenset_el0, %0" : : "r"(1ULL << 31));
+#endif
+}
+
+/// \brief Read the cycle counter.
+static inline u32 CycleCounterRead(void)
+{
+#if defined(__arm__) && __ARM_ARCH == 6
+    u32 nCycles;
+    asm volatile("mrc p15, 0, %0, c15, c12, 1" : "=r"(nCycles));
+    return nCycles;
+#elif defined(__arm__)
+    u32 nCycles;
+    asm volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(nCycles));
+    return nCycles;
+#elif defined(__aarch64__)
+    u64 nCycles;
+    asm volatile("isb; mrs %0, pmccntr_el0" : "=r"(nCycles));
+    return static_cast<u32>(nCycles);
+#elif defined(__x86_64__) || defined(__i386__)
+    return static_cast<u32>(__rdtsc());
+#else
+    return CTimer::GetClockTicks();
+#endif
+}
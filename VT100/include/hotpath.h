@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// Module:        hotpath.h
+// Description:   Code placement markers for the parser and rasterizer hot path.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        No own section for hot code until device numbers exist
+// 2026-10-18     R. Zuehlsdorff        Hot code grouped by hotpath.ld
+//------------------------------------------------------------------------------
+
+#pragma once
+
+/**
+ * @file hotpath.h
+ * @brief Markers for the parser and rasterizer hot path.
+ * @details Every received byte runs through the parser state machine, the glyph
+ * rasterizer and the cell grid.
+ *
+ * - `VT100_HOT` marks functions that run per received byte or per drawn glyph;
+ *   GCC optimizes them more aggressively and places them in `.text.hot`, which
+ *   `hotpath.ld` links as one block ahead of the other code, so they share few
+ *   lines of the 16 KiB instruction cache of the ARM1176 with cold code.
+ * - `VT100_COLD` marks rarely used functions; GCC moves them to
+ *   `.text.unlikely` and optimizes callers for the path that does not call them.
+ */
+
+#if defined(__GNUC__)
+#define VT100_HOT __attribute__((hot))
+#else
+#define VT100_HOT
+#endif
+
+#if defined(__GNUC__)
+#define VT100_COLD __attribute__((cold, noinline))
+#else
+#define VT100_COLD
+#endif
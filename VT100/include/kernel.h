@@ -42,6 +42,13 @@ class CTUART;
 class CTFileLog;
 class CTSetup;
 class CVTTest;
+class CTWarmResume;
+class CTPredictiveEcho;
+class CTPrintCapture;
+class CTLogPane;
+class CTStallWatchdog;
+class CTPerfHud;
+class CTSampleProfiler;
 
 #include "hal.h"
 
@@ -110,7 +117,38 @@ public:
     /// \brief Run periodic VT test tick (if enabled).
     void RunVTTestTick();
 
-    /// \brief Forward keyboard-generated host output to TCP host mode or UART fallback.
+    /// \brief Persist changed screen rows for warm resume (if enabled).
+    void RunWarmResumeTick();
+
+    /// \brief Expire overdue echo predictions and drop them when host mode ends.
+    void RunPredictiveEchoTick();
+
+    /// \brief Show or hide the log pane (F8).
+    void ToggleLogPane();
+    /// \brief Draw pending log pane updates unless SET-UP or VT test own the screen.
+    void RunLogPaneTick();
+
+    /// \brief Show or hide the performance HUD (F7).
+    void TogglePerfHud();
+    /// \brief Update the performance HUD unless SET-UP or VT test own the screen.
+    void RunPerfHudTick();
+
+    /// \brief Write a pending stall report to SD and the log.
+    void RunStallWatchdogTick();
+
+    /// \brief Follow TCP host sessions between the serial and host consoles.
+    void RunConsoleTick();
+    /// \brief Show the next virtual console (F9).
+    void CycleConsole();
+    /// \brief Show a virtual console; refused while SET-UP or VT test own the screen.
+    bool SwitchConsole(unsigned nConsole);
+    /// \brief Send data to the host bound to a virtual console.
+    void SendConsoleOutput(unsigned nConsole, const char *pData, size_t nLength);
+
+    /// \brief Send keyboard output to the host, predicting its echo in TCP host mode.
+    void SendKeyboardOutput(const char *pData, size_t nLength);
+
+    /// \brief Forward keyboard-generated host output to the host of the active console.
     void SendHostOutput(const char *pData, size_t nLength);
     /// \brief Consume bytes received from WLAN host bridge and render them.
     void HandleWlanHostRx(const char *pData, size_t nLength);
@@ -124,6 +162,15 @@ private:
     void EnsureSerialTaskStarted();
     /// \brief Drain the buffered UART input and pass to renderer.
     void ProcessSerial();
+    /// \brief Check whether serial and TCP host have their own consoles.
+    bool IsVirtualConsolesEnabled() const;
+    /// \brief Console rendering output of the given transport.
+    unsigned GetTransportConsole(bool bTcpHost) const;
+    /// \brief Check whether typed keys currently reach the TCP host.
+    bool IsTcpHostOnScreen() const;
+
+    static constexpr unsigned ConsoleSerial = 0;   ///< Console bound to the UART
+    static constexpr unsigned ConsoleHost = 1;     ///< Console bound to the TCP host bridge
 
     // do not change this order - some members depend on others
     CKernelOptions m_Options;
@@ -153,6 +200,13 @@ private:
     CTWlanLog *m_pWlanLog;
     CTSetup *m_pSetup;
     CVTTest *m_pVTTest;
+    CTWarmResume *m_pWarmResume;
+    CTPredictiveEcho *m_pPredictiveEcho;
+    CTPrintCapture *m_pPrintCapture;
+    CTLogPane *m_pLogPane;
+    CTPerfHud *m_pPerfHud;
+    CTSampleProfiler *m_pSampleProfiler;
+    CTStallWatchdog *m_pStallWatchdog;
     CDevice *m_pLogTarget;
     CNullDevice *m_pNullLog;
 
@@ -164,4 +218,6 @@ private:
     bool m_bWaitingMessageShowsIP;
     bool m_bScreenLoggerEnabled;
     bool m_bLocalModeEnabled;
+    bool m_bScreenResumed;
+    bool m_bHostSessionActive;
 };
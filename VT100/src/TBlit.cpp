@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// Module:        CTBlit
+// Description:   Burst copies of pixel rectangles into framebuffer memory.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include "TBlit.h"
+
+#include <circle/util.h>
+
+#include "hotpath.h"
+
+VT100_HOT void CTBlit::Copy(u8 *pDest, unsigned nDestPitch, const u8 *pSource, unsigned nSourcePitch,
+                  unsigned nBytes, unsigned nLines)
+{
+    for (unsigned nLine = 0; nLine < nLines; ++nLine)
+    {
+        CopyLine(pDest, pSource, nBytes);
+        pDest += nDestPitch;
+        pSource += nSourcePitch;
+    }
+}
+
+void CTBlit::CopyReference(u8 *pDest, unsigned nDestPitch, const u8 *pSource, unsigned nSourcePitch,
+                           unsigned nBytes, unsigned nLines)
+{
+    for (unsigned nLine = 0; nLine < nLines; ++nLine)
+    {
+        for (unsigned i = 0; i < nBytes; ++i)
+        {
+            pDest[i] = pSource[i];
+        }
+        pDest += nDestPitch;
+        pSource += nSourcePitch;
+    }
+}
+
+VT100_HOT void CTBlit::CopyLine(u8 *pDest, const u8 *pSource, unsigned nBytes)
+{
+    // Words cannot be both loaded and stored aligned
+    if (((reinterpret_cast<uintptr>(pDest) ^ reinterpret_cast<uintptr>(pSource)) & 3) != 0)
+    {
+        memcpy(pDest, pSource, nBytes);
+        return;
+    }
+
+    while (nBytes > 0 && (reinterpret_cast<uintptr>(pDest) & 3) != 0)
+    {
+        *pDest++ = *pSource++;
+        --nBytes;
+    }
+
+    u32 *pDest32 = reinterpret_cast<u32 *>(pDest);
+    const u32 *pSource32 = reinterpret_cast<const u32 *>(pSource);
+    while (nBytes >= 4 && (reinterpret_cast<uintptr>(pDest32) & (BurstBytes - 1)) != 0)
+    {
+        *pDest32++ = *pSource32++;
+        nBytes -= 4;
+    }
+
+    // All loads first, so the eight stores leave the core back to back
+    for (unsigned nBursts = nBytes / BurstBytes; nBursts > 0; --nBursts)
+    {
+        const u32 w0 = pSource32[0];
+        const u32 w1 = pSource32[1];
+        const u32 w2 = pSource32[2];
+        const u32 w3 = pSource32[3];
+        const u32 w4 = pSource32[4];
+        const u32 w5 = pSource32[5];
+        const u32 w6 = pSource32[6];
+        const u32 w7 = pSource32[7];
+        pDest32[0] = w0;
+        pDest32[1] = w1;
+        pDest32[2] = w2;
+        pDest32[3] = w3;
+        pDest32[4] = w4;
+        pDest32[5] = w5;
+        pDest32[6] = w6;
+        pDest32[7] = w7;
+        pSource32 += 8;
+        pDest32 += 8;
+    }
+    nBytes %= BurstBytes;
+
+    while (nBytes >= 4)
+    {
+        *pDest32++ = *pSource32++;
+        nBytes -= 4;
+    }
+
+    pDest = reinterpret_cast<u8 *>(pDest32);
+    pSource = reinterpret_cast<const u8 *>(pSource32);
+    while (nBytes-- > 0)
+    {
+        *pDest++ = *pSource++;
+    }
+}
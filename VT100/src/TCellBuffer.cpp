@@ -0,0 +1,428 @@
+//------------------------------------------------------------------------------
+// Module:        CTCellBuffer
+// Description:   Character/attribute grid mirroring the renderer's pixel screen.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Per-row checksum trees for DECRQCRA
+// 2026-10-18     R. Zuehlsdorff        Hot/cold code placement
+//------------------------------------------------------------------------------
+
+// Include class header
+#include "TCellBuffer.h"
+#include "hotpath.h"
+
+#include <string.h>
+
+CTCellBuffer::CTCellBuffer(void)
+    : m_pCells(nullptr),
+      m_pRowSums(nullptr),
+      m_pRowGenerations(nullptr),
+      m_nColumns(0),
+      m_nRows(0),
+      m_nGeneration(0)
+{
+}
+
+CTCellBuffer::~CTCellBuffer(void)
+{
+    delete[] m_pCells;
+    m_pCells = nullptr;
+
+    delete[] m_pRowSums;
+    m_pRowSums = nullptr;
+
+    delete[] m_pRowGenerations;
+    m_pRowGenerations = nullptr;
+}
+
+VT100_COLD boolean CTCellBuffer::Resize(unsigned nColumns, unsigned nRows)
+{
+    if (nColumns == m_nColumns && nRows == m_nRows)
+    {
+        return TRUE;
+    }
+
+    TCell *pCells = nullptr;
+    u16 *pRowSums = nullptr;
+    u32 *pRowGenerations = nullptr;
+    if (nColumns > 0 && nRows > 0)
+    {
+        pCells = new TCell[nColumns * nRows];
+        pRowSums = new u16[nColumns * nRows];
+        pRowGenerations = new u32[nRows];
+        if (pCells == nullptr || pRowSums == nullptr || pRowGenerations == nullptr)
+        {
+            delete[] pCells;
+            delete[] pRowSums;
+            delete[] pRowGenerations;
+            return FALSE;
+        }
+
+        Blank(pCells, nColumns * nRows);
+
+        const unsigned copyColumns = nColumns < m_nColumns ? nColumns : m_nColumns;
+        const unsigned copyRows = nRows < m_nRows ? nRows : m_nRows;
+        for (unsigned row = 0; row < copyRows; ++row)
+        {
+            memcpy(pCells + row * nColumns, m_pCells + row * m_nColumns, copyColumns * sizeof(TCell));
+        }
+    }
+
+    delete[] m_pCells;
+    delete[] m_pRowSums;
+    delete[] m_pRowGenerations;
+    m_pCells = pCells;
+    m_pRowSums = pRowSums;
+    m_pRowGenerations = pRowGenerations;
+    m_nColumns = nColumns;
+    m_nRows = nRows;
+
+    RebuildSums(0, m_nRows);
+    Touch(0, m_nRows);
+    return TRUE;
+}
+
+void CTCellBuffer::Clear(void)
+{
+    EraseRows(0, m_nRows);
+}
+
+VT100_COLD void CTCellBuffer::Exchange(CTCellBuffer &rOther)
+{
+    TCell *pCells = m_pCells;
+    u16 *pRowSums = m_pRowSums;
+    u32 *pRowGenerations = m_pRowGenerations;
+    const unsigned columns = m_nColumns;
+    const unsigned rows = m_nRows;
+
+    m_pCells = rOther.m_pCells;
+    m_pRowSums = rOther.m_pRowSums;
+    m_pRowGenerations = rOther.m_pRowGenerations;
+    m_nColumns = rOther.m_nColumns;
+    m_nRows = rOther.m_nRows;
+
+    rOther.m_pCells = pCells;
+    rOther.m_pRowSums = pRowSums;
+    rOther.m_pRowGenerations = pRowGenerations;
+    rOther.m_nColumns = columns;
+    rOther.m_nRows = rows;
+
+    if (rOther.m_nGeneration > m_nGeneration)
+    {
+        m_nGeneration = rOther.m_nGeneration;
+    }
+    rOther.m_nGeneration = m_nGeneration;
+}
+
+void CTCellBuffer::TouchAll(void)
+{
+    Touch(0, m_nRows);
+}
+
+VT100_HOT void CTCellBuffer::PutChar(unsigned nRow, unsigned nColumn, u8 chChar, u8 nAttr)
+{
+    if (nRow >= m_nRows || nColumn >= m_nColumns)
+    {
+        return;
+    }
+
+    TCell &cell = m_pCells[nRow * m_nColumns + nColumn];
+    const u16 oldWeight = GetCellWeight(cell);
+    cell.ch = chChar;
+    cell.attr = nAttr;
+    AddSum(nRow, nColumn, static_cast<u16>(GetCellWeight(cell) - oldWeight));
+    Touch(nRow, nRow + 1);
+}
+
+VT100_HOT void CTCellBuffer::EraseRange(unsigned nRow, unsigned nFirstColumn, unsigned nEndColumn)
+{
+    if (nRow >= m_nRows)
+    {
+        return;
+    }
+
+    if (nEndColumn > m_nColumns)
+    {
+        nEndColumn = m_nColumns;
+    }
+
+    if (nFirstColumn >= nEndColumn)
+    {
+        return;
+    }
+
+    Blank(m_pCells + nRow * m_nColumns + nFirstColumn, nEndColumn - nFirstColumn);
+    RebuildSums(nRow, nRow + 1);
+    Touch(nRow, nRow + 1);
+}
+
+void CTCellBuffer::EraseRows(unsigned nFirstRow, unsigned nEndRow)
+{
+    if (nEndRow > m_nRows)
+    {
+        nEndRow = m_nRows;
+    }
+
+    if (nFirstRow >= nEndRow)
+    {
+        return;
+    }
+
+    Blank(m_pCells + nFirstRow * m_nColumns, (nEndRow - nFirstRow) * m_nColumns);
+    RebuildSums(nFirstRow, nEndRow);
+    Touch(nFirstRow, nEndRow);
+}
+
+VT100_HOT void CTCellBuffer::ScrollUp(unsigned nTopRow, unsigned nEndRow, unsigned nCount)
+{
+    if (nEndRow > m_nRows)
+    {
+        nEndRow = m_nRows;
+    }
+
+    if (nTopRow >= nEndRow || nCount == 0)
+    {
+        return;
+    }
+
+    if (nCount > nEndRow - nTopRow)
+    {
+        nCount = nEndRow - nTopRow;
+    }
+
+    const unsigned moveRows = nEndRow - nTopRow - nCount;
+    if (moveRows > 0)
+    {
+        memmove(m_pCells + nTopRow * m_nColumns,
+                m_pCells + (nTopRow + nCount) * m_nColumns,
+                moveRows * m_nColumns * sizeof(TCell));
+        memmove(m_pRowSums + nTopRow * m_nColumns,
+                m_pRowSums + (nTopRow + nCount) * m_nColumns,
+                moveRows * m_nColumns * sizeof(u16));
+    }
+
+    Blank(m_pCells + (nEndRow - nCount) * m_nColumns, nCount * m_nColumns);
+    RebuildSums(nEndRow - nCount, nEndRow);
+    Touch(nTopRow, nEndRow);
+}
+
+void CTCellBuffer::ScrollDown(unsigned nTopRow, unsigned nEndRow, unsigned nCount)
+{
+    if (nEndRow > m_nRows)
+    {
+        nEndRow = m_nRows;
+    }
+
+    if (nTopRow >= nEndRow || nCount == 0)
+    {
+        return;
+    }
+
+    if (nCount > nEndRow - nTopRow)
+    {
+        nCount = nEndRow - nTopRow;
+    }
+
+    const unsigned moveRows = nEndRow - nTopRow - nCount;
+    if (moveRows > 0)
+    {
+        memmove(m_pCells + (nTopRow + nCount) * m_nColumns,
+                m_pCells + nTopRow * m_nColumns,
+                moveRows * m_nColumns * sizeof(TCell));
+        memmove(m_pRowSums + (nTopRow + nCount) * m_nColumns,
+                m_pRowSums + nTopRow * m_nColumns,
+                moveRows * m_nColumns * sizeof(u16));
+    }
+
+    Blank(m_pCells + nTopRow * m_nColumns, nCount * m_nColumns);
+    RebuildSums(nTopRow, nTopRow + nCount);
+    Touch(nTopRow, nEndRow);
+}
+
+void CTCellBuffer::DeleteChars(unsigned nRow, unsigned nColumn, unsigned nCount)
+{
+    if (nRow >= m_nRows || nColumn >= m_nColumns || nCount == 0)
+    {
+        return;
+    }
+
+    if (nCount > m_nColumns - nColumn)
+    {
+        nCount = m_nColumns - nColumn;
+    }
+
+    TCell *pRow = m_pCells + nRow * m_nColumns;
+    const unsigned moveCells = m_nColumns - nColumn - nCount;
+    if (moveCells > 0)
+    {
+        memmove(pRow + nColumn, pRow + nColumn + nCount, moveCells * sizeof(TCell));
+    }
+
+    Blank(pRow + m_nColumns - nCount, nCount);
+    RebuildSums(nRow, nRow + 1);
+    Touch(nRow, nRow + 1);
+}
+
+void CTCellBuffer::SetRow(unsigned nRow, const TCell *pCells, unsigned nCount)
+{
+    if (nRow >= m_nRows)
+    {
+        return;
+    }
+
+    if (pCells == nullptr)
+    {
+        nCount = 0;
+    }
+
+    if (nCount > m_nColumns)
+    {
+        nCount = m_nColumns;
+    }
+
+    TCell *pRow = m_pCells + nRow * m_nColumns;
+    if (nCount > 0)
+    {
+        memcpy(pRow, pCells, nCount * sizeof(TCell));
+    }
+    Blank(pRow + nCount, m_nColumns - nCount);
+    RebuildSums(nRow, nRow + 1);
+    Touch(nRow, nRow + 1);
+}
+
+const CTCellBuffer::TCell *CTCellBuffer::GetRow(unsigned nRow) const
+{
+    if (nRow >= m_nRows)
+    {
+        return nullptr;
+    }
+
+    return m_pCells + nRow * m_nColumns;
+}
+
+u32 CTCellBuffer::GetRowGeneration(unsigned nRow) const
+{
+    if (nRow >= m_nRows)
+    {
+        return 0;
+    }
+
+    return m_pRowGenerations[nRow];
+}
+
+VT100_COLD u16 CTCellBuffer::GetChecksum(unsigned nFirstRow, unsigned nEndRow, unsigned nFirstColumn, unsigned nEndColumn) const
+{
+    if (nEndRow > m_nRows)
+    {
+        nEndRow = m_nRows;
+    }
+
+    if (nEndColumn > m_nColumns)
+    {
+        nEndColumn = m_nColumns;
+    }
+
+    if (nFirstRow >= nEndRow || nFirstColumn >= nEndColumn)
+    {
+        return 0;
+    }
+
+    u16 sum = 0;
+    for (unsigned row = nFirstRow; row < nEndRow; ++row)
+    {
+        sum = static_cast<u16>(sum + PrefixSum(row, nEndColumn) - PrefixSum(row, nFirstColumn));
+    }
+
+    return sum;
+}
+
+VT100_HOT u16 CTCellBuffer::GetCellWeight(const TCell &rCell)
+{
+    // Rendition weights as reported by the VT420 family for DECRQCRA
+    u16 weight = rCell.ch;
+    if (rCell.attr & AttrBold)
+    {
+        weight += 0x80;
+    }
+    if (rCell.attr & AttrBlink)
+    {
+        weight += 0x40;
+    }
+    if (rCell.attr & AttrReverse)
+    {
+        weight += 0x20;
+    }
+    if (rCell.attr & AttrUnderline)
+    {
+        weight += 0x10;
+    }
+
+    return weight;
+}
+
+void CTCellBuffer::RebuildSums(unsigned nFirstRow, unsigned nEndRow)
+{
+    // Linear-time Fenwick build: node i (1-based) covers the i & -i cells ending at i
+    for (unsigned row = nFirstRow; row < nEndRow; ++row)
+    {
+        const TCell *pRow = m_pCells + row * m_nColumns;
+        u16 *pTree = m_pRowSums + row * m_nColumns;
+        for (unsigned i = 0; i < m_nColumns; ++i)
+        {
+            pTree[i] = GetCellWeight(pRow[i]);
+        }
+
+        for (unsigned i = 1; i <= m_nColumns; ++i)
+        {
+            const unsigned parent = i + (i & (0U - i));
+            if (parent <= m_nColumns)
+            {
+                pTree[parent - 1] = static_cast<u16>(pTree[parent - 1] + pTree[i - 1]);
+            }
+        }
+    }
+}
+
+VT100_HOT void CTCellBuffer::AddSum(unsigned nRow, unsigned nColumn, u16 nDelta)
+{
+    u16 *pTree = m_pRowSums + nRow * m_nColumns;
+    for (unsigned i = nColumn + 1; i <= m_nColumns; i += i & (0U - i))
+    {
+        pTree[i - 1] = static_cast<u16>(pTree[i - 1] + nDelta);
+    }
+}
+
+u16 CTCellBuffer::PrefixSum(unsigned nRow, unsigned nCount) const
+{
+    const u16 *pTree = m_pRowSums + nRow * m_nColumns;
+    u16 sum = 0;
+    for (unsigned i = nCount; i > 0; i -= i & (0U - i))
+    {
+        sum = static_cast<u16>(sum + pTree[i - 1]);
+    }
+
+    return sum;
+}
+
+VT100_HOT void CTCellBuffer::Touch(unsigned nFirstRow, unsigned nEndRow)
+{
+    ++m_nGeneration;
+    for (unsigned row = nFirstRow; row < nEndRow; ++row)
+    {
+        m_pRowGenerations[row] = m_nGeneration;
+    }
+}
+
+VT100_HOT void CTCellBuffer::Blank(TCell *pCell, unsigned nCount)
+{
+    while (nCount--)
+    {
+        pCell->ch = BlankChar;
+        pCell->attr = AttrNone;
+        ++pCell;
+    }
+}
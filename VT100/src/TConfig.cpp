@@ -292,6 +292,17 @@ void CTConfig::logConfig(void) const
             GetSerialParityMode() == 0 ? "none" : (GetSerialParityMode() == 1 ? "even" : "odd"));
     LOGNOTE("Serial flow: software XON/XOFF %s", GetSoftwareFlowControl() ? "enabled" : "disabled");
             LOGNOTE("Margin bell: %s", GetMarginBellEnabled() ? "enabled" : "disabled");
+    LOGNOTE("Warm resume: %s", GetWarmResumeEnabled() ? "enabled" : "disabled");
+    LOGNOTE("Predictive echo: %s", GetPredictiveEcho() == 0 ? "off" : (GetPredictiveEcho() == 1 ? "adaptive" : "always"));
+    LOGNOTE("Virtual consoles: %s", GetVirtualConsolesEnabled() ? "enabled" : "disabled");
+    LOGNOTE("CRT effects: scan lines %u%%, bloom %u%%, glow %u%%", GetCrtScanlines(), GetCrtBloom(), GetCrtGlow());
+    LOGNOTE("Direct render: %s", GetDirectRenderEnabled() ? "enabled" : "disabled");
+    LOGNOTE("Telnet compression: %s", GetTelnetCompressEnabled() ? "offered (MCCP2)" : "disabled");
+    LOGNOTE("Print capture: %s", GetPrintCaptureEnabled() ? "enabled (SD:/PRINTnnn.TXT)" : "disabled");
+    LOGNOTE("Render bench: %s", GetRenderBenchEnabled() ? "at boot" : "disabled");
+    LOGNOTE("Log pane: %s", GetLogPaneEnabled() ? "enabled (F8)" : "disabled");
+    LOGNOTE("Stall watchdog: %u s, reboot %s", GetStallTimeout(), GetStallRebootEnabled() ? "enabled" : "disabled");
+    LOGNOTE("PC sampling: %s", GetProfileRate() != 0 ? "from boot" : "on request");
     LOGNOTE("Line endings: %s", GetLineEndingModeString());
     LOGNOTE("Cursor: %s, %s", GetCursorBlock() ? "block" : "underline", GetCursorBlinking() ? "blinking" : "solid");
     LOGNOTE("VT test: %s", GetVTTestEnabled() ? "enabled" : "disabled");
@@ -354,6 +365,20 @@ CTConfig::CTConfig(void) : CTask()
         {"switch_txrx", &m_SwitchTxRx, 0, "Swap TX/RX wiring using GPIO16 (0=normal, 1=swapped)"},
         {"flow_control", &m_SoftwareFlowControl, 0, "Software flow control (0=off, 1=on XON/XOFF)"},
         {"margin_bell", &m_MarginBellEnabled, 0, "Margin bell (0=off, 1=on; rings 8 columns before right margin)"},
+        {"warm_resume", &m_WarmResumeEnabled, 0, "Restore screen contents after reboot (0=off, 1=on)"},
+        {"predictive_echo", &m_PredictiveEcho, 0, "Predictive local echo in TCP host mode (0=off, 1=adaptive, 2=always)"},
+        {"virtual_consoles", &m_VirtualConsolesEnabled, 0, "Separate consoles for serial and TCP host (0=off, 1=on; F9 switches)"},
+        {"crt_scanlines", &m_CrtScanlines, 0, "CRT scan-line darkening (0-100 percent)"},
+        {"crt_bloom", &m_CrtBloom, 0, "CRT horizontal bloom (0-100 percent)"},
+        {"crt_glow", &m_CrtGlow, 0, "CRT phosphor glow for amber/green text (0-100 percent)"},
+        {"direct_render", &m_DirectRenderEnabled, 0, "Render straight into the framebuffer (0=off, 1=on; no smooth scroll)"},
+        {"telnet_compress", &m_TelnetCompressEnabled, 1, "Offer MCCP2 compression to telnet clients (0=off, 1=on)"},
+        {"print_capture", &m_PrintCaptureEnabled, 1, "Write printer controller data (CSI 5 i) to SD (0=off, 1=on)"},
+        {"render_bench", &m_RenderBenchEnabled, 0, "Benchmark the drawing primitives at boot (0=off, 1=on)"},
+        {"log_pane", &m_LogPaneEnabled, 1, "Screen log in an F8 overlay pane (0=off, 1=on)"},
+        {"stall_timeout", &m_StallTimeout, 0, "Seconds without progress until a stall report (0=off, 1-60)"},
+        {"stall_reboot", &m_StallRebootEnabled, 0, "Reset the board when a stall does not end (0=off, 1=on)"},
+        {"profile_rate", &m_ProfileRate, 0, "PC samples per second from boot (0=off, 10-10000)"},
         {"wlan_host_autostart", &m_WlanHostAutoStart, 0, "WLAN mode policy (0=off, 1=log, 2=host)"},
         {"repeat_delay_ms", &m_KeyRepeatDelayMs, KeyRepeatDelayMinMs, "Key repeat delay in milliseconds (250-1000)"},
         {"repeat_rate_cps", &m_KeyRepeatRateCps, 10, "Key repeat rate in characters per second (2-20)"},
@@ -502,6 +527,20 @@ boolean CTConfig::SaveToFile(void)
         {"wlan_host_autostart", CString(), false},
         {"log_output", CString(), false},
         {"log_filename", CString(), false},
+        {"warm_resume", CString(), false},
+        {"predictive_echo", CString(), false},
+        {"virtual_consoles", CString(), false},
+        {"crt_scanlines", CString(), false},
+        {"crt_bloom", CString(), false},
+        {"crt_glow", CString(), false},
+        {"direct_render", CString(), false},
+        {"telnet_compress", CString(), false},
+        {"print_capture", CString(), false},
+        {"render_bench", CString(), false},
+        {"log_pane", CString(), false},
+        {"stall_timeout", CString(), false},
+        {"stall_reboot", CString(), false},
+        {"profile_rate", CString(), false},
     };
 
     kv[0].value.Format("%u", m_LineEnding);
@@ -528,6 +567,20 @@ boolean CTConfig::SaveToFile(void)
     kv[21].value.Format("%u", m_WlanHostAutoStart);
     kv[22].value.Format("%u", m_LogOutput);
     kv[23].value.Format("%s", m_LogFileName);
+    kv[24].value.Format("%u", m_WarmResumeEnabled);
+    kv[25].value.Format("%u", m_PredictiveEcho);
+    kv[26].value.Format("%u", m_VirtualConsolesEnabled);
+    kv[27].value.Format("%u", m_CrtScanlines);
+    kv[28].value.Format("%u", m_CrtBloom);
+    kv[29].value.Format("%u", m_CrtGlow);
+    kv[30].value.Format("%u", m_DirectRenderEnabled);
+    kv[31].value.Format("%u", m_TelnetCompressEnabled);
+    kv[32].value.Format("%u", m_PrintCaptureEnabled);
+    kv[33].value.Format("%u", m_RenderBenchEnabled);
+    kv[34].value.Format("%u", m_LogPaneEnabled);
+    kv[35].value.Format("%u", m_StallTimeout);
+    kv[36].value.Format("%u", m_StallRebootEnabled);
+    kv[37].value.Format("%u", m_ProfileRate);
 
     // Attempt to load existing content to preserve comments/order
     CString existing;
@@ -979,7 +1032,82 @@ boolean CTConfig::ParseConfigLine(const char *pLine)
                 const char *modeName = (sanitizedValue == 0U) ? "off" : ((sanitizedValue == 1U) ? "log" : "host");
                 LOGNOTE("Config: Parameter %s set to %s (%u)", keyword, modeName, sanitizedValue);
             }
-            else if (param->variable == &m_SoftwareFlowControl || param->variable == &m_MarginBellEnabled)
+            else if (param->variable == &m_PredictiveEcho)
+            {
+                unsigned int sanitizedValue = static_cast<unsigned int>(parsedValue);
+                if (value[0] == '-')
+                {
+                    LOGWARN("Config: Negative predictive_echo %s, using 0", value);
+                    sanitizedValue = 0U;
+                }
+                else if (sanitizedValue > 2U)
+                {
+                    LOGWARN("Config: Invalid predictive_echo %lu, clamping to 2", parsedValue);
+                    sanitizedValue = 2U;
+                }
+                *(param->variable) = sanitizedValue;
+                const char *modeName = (sanitizedValue == 0U) ? "off" : ((sanitizedValue == 1U) ? "adaptive" : "always");
+                LOGNOTE("Config: Parameter %s set to %s (%u)", keyword, modeName, sanitizedValue);
+            }
+            else if (param->variable == &m_CrtScanlines || param->variable == &m_CrtBloom
+                     || param->variable == &m_CrtGlow)
+            {
+                unsigned int sanitizedValue = static_cast<unsigned int>(parsedValue);
+                if (value[0] == '-')
+                {
+                    LOGWARN("Config: Negative %s %s, using 0", keyword, value);
+                    sanitizedValue = 0U;
+                }
+                else if (sanitizedValue > 100U)
+                {
+                    LOGWARN("Config: Invalid %s %lu, clamping to 100", keyword, parsedValue);
+                    sanitizedValue = 100U;
+                }
+                *(param->variable) = sanitizedValue;
+                LOGNOTE("Config: Parameter %s set to %u%%", keyword, *(param->variable));
+            }
+            else if (param->variable == &m_StallTimeout)
+            {
+                unsigned int sanitizedValue = static_cast<unsigned int>(parsedValue);
+                if (value[0] == '-')
+                {
+                    LOGWARN("Config: Negative stall_timeout %s, using 0", value);
+                    sanitizedValue = 0U;
+                }
+                else if (sanitizedValue > 60U)
+                {
+                    LOGWARN("Config: Invalid stall_timeout %lu, clamping to 60", parsedValue);
+                    sanitizedValue = 60U;
+                }
+                *(param->variable) = sanitizedValue;
+                LOGNOTE("Config: Parameter %s set to %u s", keyword, sanitizedValue);
+            }
+            else if (param->variable == &m_ProfileRate)
+            {
+                unsigned int sanitizedValue = static_cast<unsigned int>(parsedValue);
+                if (value[0] == '-')
+                {
+                    LOGWARN("Config: Negative profile_rate %s, using 0", value);
+                    sanitizedValue = 0U;
+                }
+                else if (sanitizedValue > 10000U)
+                {
+                    LOGWARN("Config: Invalid profile_rate %lu, clamping to 10000", parsedValue);
+                    sanitizedValue = 10000U;
+                }
+                else if (sanitizedValue != 0U && sanitizedValue < 10U)
+                {
+                    LOGWARN("Config: Invalid profile_rate %lu, clamping to 10", parsedValue);
+                    sanitizedValue = 10U;
+                }
+                *(param->variable) = sanitizedValue;
+                LOGNOTE("Config: Parameter %s set to %u Hz", keyword, sanitizedValue);
+            }
+            else if (param->variable == &m_SoftwareFlowControl || param->variable == &m_MarginBellEnabled
+                     || param->variable == &m_WarmResumeEnabled || param->variable == &m_VirtualConsolesEnabled
+                     || param->variable == &m_DirectRenderEnabled || param->variable == &m_TelnetCompressEnabled
+                     || param->variable == &m_PrintCaptureEnabled || param->variable == &m_RenderBenchEnabled
+                     || param->variable == &m_LogPaneEnabled || param->variable == &m_StallRebootEnabled)
             {
                 unsigned int sanitizedValue = static_cast<unsigned int>(parsedValue);
                 if (value[0] == '-')
@@ -1321,6 +1449,42 @@ void CTConfig::SetMarginBellEnabled(boolean enabled)
     LOGNOTE("Config: margin_bell %s", m_MarginBellEnabled ? "enabled" : "disabled");
 }
 
+void CTConfig::SetWarmResumeEnabled(boolean enabled)
+{
+    m_WarmResumeEnabled = enabled ? 1U : 0U;
+    LOGNOTE("Config: warm_resume %s", m_WarmResumeEnabled ? "enabled" : "disabled");
+}
+
+void CTConfig::SetPredictiveEcho(unsigned mode)
+{
+    m_PredictiveEcho = mode > 2U ? 2U : mode;
+    LOGNOTE("Config: predictive_echo updated to %u", m_PredictiveEcho);
+}
+
+void CTConfig::SetVirtualConsolesEnabled(boolean enabled)
+{
+    m_VirtualConsolesEnabled = enabled ? 1U : 0U;
+    LOGNOTE("Config: virtual_consoles %s", m_VirtualConsolesEnabled ? "enabled" : "disabled");
+}
+
+void CTConfig::SetCrtScanlines(unsigned percent)
+{
+    m_CrtScanlines = percent > 100U ? 100U : percent;
+    LOGNOTE("Config: crt_scanlines updated to %u", m_CrtScanlines);
+}
+
+void CTConfig::SetCrtBloom(unsigned percent)
+{
+    m_CrtBloom = percent > 100U ? 100U : percent;
+    LOGNOTE("Config: crt_bloom updated to %u", m_CrtBloom);
+}
+
+void CTConfig::SetCrtGlow(unsigned percent)
+{
+    m_CrtGlow = percent > 100U ? 100U : percent;
+    LOGNOTE("Config: crt_glow updated to %u", m_CrtGlow);
+}
+
 void CTConfig::TrimWhitespace(char *pString)
 {
     TrimWhitespaceInPlace(pString);
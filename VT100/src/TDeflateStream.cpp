@@ -0,0 +1,426 @@
+//------------------------------------------------------------------------------
+// Module:        CTDeflateStream
+// Description:   Fixed-memory zlib stream compressor for the telnet console.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        No copy for the empty block of Flush()
+//------------------------------------------------------------------------------
+
+#include "TDeflateStream.h"
+
+#include <circle/util.h>
+
+namespace
+{
+// zlib header for deflate with a 4 KiB window, default level, no dictionary
+static const u8 ZlibHeader[2] = {0x48, 0x0D};
+static const u32 AdlerModulo = 65521;
+static const unsigned AdlerBlock = 5552;
+static const unsigned EndOfBlock = 256;
+
+static const u16 LengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const u8 LengthExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const u16 DistanceBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const u8 DistanceExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Fixed Huffman codes (RFC 1951, 3.2.6), bit-reversed for LSB-first output
+static u16 s_LiteralCode[288];
+static u8 s_LiteralBits[288];
+static u8 s_DistanceCode[30];
+static u8 s_LengthSymbol[256];   // match length - 3 -> length code index
+static u8 s_DistanceSymbol[256]; // distance - 1 (< 256) -> distance code
+static bool s_bTablesBuilt = false;
+
+unsigned ReverseBits(unsigned nCode, unsigned nBits)
+{
+    unsigned nResult = 0;
+    for (unsigned i = 0; i < nBits; ++i)
+    {
+        nResult = (nResult << 1) | (nCode & 1U);
+        nCode >>= 1;
+    }
+    return nResult;
+}
+
+void BuildTables(void)
+{
+    for (unsigned nSymbol = 0; nSymbol < 288; ++nSymbol)
+    {
+        unsigned nCode;
+        unsigned nBits;
+        if (nSymbol < 144)
+        {
+            nCode = 0x30 + nSymbol;
+            nBits = 8;
+        }
+        else if (nSymbol < 256)
+        {
+            nCode = 0x190 + nSymbol - 144;
+            nBits = 9;
+        }
+        else if (nSymbol < 280)
+        {
+            nCode = nSymbol - 256;
+            nBits = 7;
+        }
+        else
+        {
+            nCode = 0xC0 + nSymbol - 280;
+            nBits = 8;
+        }
+        s_LiteralCode[nSymbol] = static_cast<u16>(ReverseBits(nCode, nBits));
+        s_LiteralBits[nSymbol] = static_cast<u8>(nBits);
+    }
+
+    for (unsigned nCode = 0; nCode < 30; ++nCode)
+    {
+        s_DistanceCode[nCode] = static_cast<u8>(ReverseBits(nCode, 5));
+    }
+
+    unsigned nIndex = 0;
+    for (unsigned nLength = 3; nLength <= 258; ++nLength)
+    {
+        while (nIndex < 27 && nLength >= LengthBase[nIndex + 1])
+        {
+            ++nIndex;
+        }
+        s_LengthSymbol[nLength - 3] = static_cast<u8>(nLength == 258 ? 28 : nIndex);
+    }
+
+    nIndex = 0;
+    for (unsigned nDistance = 1; nDistance <= 256; ++nDistance)
+    {
+        while (nDistance >= DistanceBase[nIndex + 1])
+        {
+            ++nIndex;
+        }
+        s_DistanceSymbol[nDistance - 1] = static_cast<u8>(nIndex);
+    }
+
+    s_bTablesBuilt = true;
+}
+
+inline unsigned Hash(const u8 *pData)
+{
+    return ((pData[0] << 6) ^ (pData[1] << 3) ^ pData[2]) & (CTDeflateStream::HashSize - 1);
+}
+}
+
+CTDeflateStream::CTDeflateStream(void)
+{
+    if (!s_bTablesBuilt)
+    {
+        BuildTables();
+    }
+
+    Reset();
+}
+
+void CTDeflateStream::Reset(void)
+{
+    memset(m_Head, 0xFF, sizeof m_Head);
+    m_nWindowEnd = 0;
+    m_nBitBuffer = 0;
+    m_nBitCount = 0;
+    m_pOut = nullptr;
+    m_bStarted = FALSE;
+    m_bInBlock = FALSE;
+    m_nAdler = 1;
+}
+
+size_t CTDeflateStream::Compress(const void *pData, size_t nLength, u8 *pOut)
+{
+    m_pOut = pOut;
+    BeginStream();
+
+    const u8 *pInput = static_cast<const u8 *>(pData);
+    if (nLength > MaxInputChunk)
+    {
+        nLength = MaxInputChunk;
+    }
+    UpdateAdler(pInput, nLength);
+
+    AppendWindow(pInput, nLength);
+    const unsigned nEnd = m_nWindowEnd;
+    unsigned nPos = nEnd - static_cast<unsigned>(nLength);
+
+    if (!m_bInBlock && nLength > 0)
+    {
+        PutBits(2, 3); // BFINAL = 0, BTYPE = 01 (fixed Huffman)
+        m_bInBlock = TRUE;
+    }
+
+    while (nPos < nEnd)
+    {
+        unsigned nDistance = 0;
+        const unsigned nMatch = nPos + MinMatch <= nEnd ? FindMatch(nPos, nEnd, nDistance) : 0;
+        if (nMatch >= MinMatch)
+        {
+            PutMatch(nMatch, nDistance);
+            for (unsigned i = 0; i < nMatch; ++i, ++nPos)
+            {
+                if (nPos + MinMatch <= nEnd)
+                {
+                    InsertString(nPos);
+                }
+            }
+        }
+        else
+        {
+            PutLiteral(m_Window[nPos]);
+            if (nPos + MinMatch <= nEnd)
+            {
+                InsertString(nPos);
+            }
+            ++nPos;
+        }
+    }
+
+    const size_t nWritten = static_cast<size_t>(m_pOut - pOut);
+    m_pOut = nullptr;
+    return nWritten;
+}
+
+size_t CTDeflateStream::Store(const void *pData, size_t nLength, u8 *pOut)
+{
+    m_pOut = pOut;
+    BeginStream();
+    CloseBlock();
+
+    const u8 *pInput = static_cast<const u8 *>(pData);
+    if (nLength > MaxInputChunk)
+    {
+        nLength = MaxInputChunk;
+    }
+    UpdateAdler(pInput, nLength);
+
+    // The data still goes into the window so later matches can refer to it,
+    // but it is not hashed; that is the work the fallback saves
+    AppendWindow(pInput, nLength);
+
+    PutBits(0, 3); // BFINAL = 0, BTYPE = 00 (stored)
+    AlignByte();
+    *m_pOut++ = static_cast<u8>(nLength);
+    *m_pOut++ = static_cast<u8>(nLength >> 8);
+    *m_pOut++ = static_cast<u8>(~nLength);
+    *m_pOut++ = static_cast<u8>(~nLength >> 8);
+    if (nLength > 0)
+    {
+        // Flush() frames an empty block without a source buffer
+        memcpy(m_pOut, pInput, nLength);
+        m_pOut += nLength;
+    }
+
+    const size_t nWritten = static_cast<size_t>(m_pOut - pOut);
+    m_pOut = nullptr;
+    return nWritten;
+}
+
+size_t CTDeflateStream::Flush(u8 *pOut)
+{
+    // After a stored block everything already ends on a byte boundary
+    if (!m_bStarted || (!m_bInBlock && m_nBitCount == 0))
+    {
+        return 0;
+    }
+
+    return Store(nullptr, 0, pOut);
+}
+
+size_t CTDeflateStream::Finish(u8 *pOut)
+{
+    m_pOut = pOut;
+    BeginStream();
+    CloseBlock();
+
+    PutBits(3, 3);          // BFINAL = 1, BTYPE = 01
+    PutBits(s_LiteralCode[EndOfBlock], s_LiteralBits[EndOfBlock]);
+    AlignByte();
+
+    *m_pOut++ = static_cast<u8>(m_nAdler >> 24);
+    *m_pOut++ = static_cast<u8>(m_nAdler >> 16);
+    *m_pOut++ = static_cast<u8>(m_nAdler >> 8);
+    *m_pOut++ = static_cast<u8>(m_nAdler);
+
+    const size_t nWritten = static_cast<size_t>(m_pOut - pOut);
+    m_pOut = nullptr;
+    return nWritten;
+}
+
+void CTDeflateStream::AppendWindow(const u8 *pData, size_t nLength)
+{
+    if (m_nWindowEnd + nLength > sizeof m_Window)
+    {
+        // Keep the newest WindowSize bytes; positions move down by WindowSize
+        memmove(m_Window, m_Window + WindowSize, m_nWindowEnd - WindowSize);
+        m_nWindowEnd -= WindowSize;
+
+        for (unsigned i = 0; i < HashSize; ++i)
+        {
+            m_Head[i] = (m_Head[i] != NoPosition && m_Head[i] >= WindowSize)
+                      ? static_cast<u16>(m_Head[i] - WindowSize) : NoPosition;
+        }
+        for (unsigned i = 0; i < WindowSize; ++i)
+        {
+            m_Prev[i] = (m_Prev[i] != NoPosition && m_Prev[i] >= WindowSize)
+                      ? static_cast<u16>(m_Prev[i] - WindowSize) : NoPosition;
+        }
+    }
+
+    if (nLength > 0)
+    {
+        memcpy(m_Window + m_nWindowEnd, pData, nLength);
+        m_nWindowEnd += static_cast<unsigned>(nLength);
+    }
+}
+
+void CTDeflateStream::InsertString(unsigned nPos)
+{
+    const unsigned nHash = Hash(m_Window + nPos);
+    m_Prev[nPos & (WindowSize - 1)] = m_Head[nHash];
+    m_Head[nHash] = static_cast<u16>(nPos);
+}
+
+unsigned CTDeflateStream::FindMatch(unsigned nPos, unsigned nEnd, unsigned &rDistance) const
+{
+    const unsigned nLimit = nEnd - nPos < MaxMatch ? nEnd - nPos : MaxMatch;
+    const u8 *pCurrent = m_Window + nPos;
+    unsigned nBest = MinMatch - 1;
+    unsigned nCandidate = m_Head[Hash(pCurrent)];
+
+    for (unsigned nChain = 0; nChain < MaxChain && nCandidate != NoPosition; ++nChain)
+    {
+        // Slots older than one window may have been reused by newer positions
+        if (nCandidate >= nPos || nPos - nCandidate >= WindowSize)
+        {
+            break;
+        }
+
+        const u8 *pCandidate = m_Window + nCandidate;
+        if (pCandidate[nBest] == pCurrent[nBest] && pCandidate[0] == pCurrent[0])
+        {
+            unsigned nLength = 0;
+            while (nLength < nLimit && pCandidate[nLength] == pCurrent[nLength])
+            {
+                ++nLength;
+            }
+
+            if (nLength > nBest)
+            {
+                nBest = nLength;
+                rDistance = nPos - nCandidate;
+                if (nLength == nLimit)
+                {
+                    break;
+                }
+            }
+        }
+
+        nCandidate = m_Prev[nCandidate & (WindowSize - 1)];
+    }
+
+    return nBest >= MinMatch ? nBest : 0;
+}
+
+void CTDeflateStream::BeginStream(void)
+{
+    if (!m_bStarted)
+    {
+        *m_pOut++ = ZlibHeader[0];
+        *m_pOut++ = ZlibHeader[1];
+        m_bStarted = TRUE;
+    }
+}
+
+void CTDeflateStream::CloseBlock(void)
+{
+    if (m_bInBlock)
+    {
+        PutBits(s_LiteralCode[EndOfBlock], s_LiteralBits[EndOfBlock]);
+        m_bInBlock = FALSE;
+    }
+}
+
+void CTDeflateStream::PutBits(u32 nValue, unsigned nCount)
+{
+    m_nBitBuffer |= nValue << m_nBitCount;
+    m_nBitCount += nCount;
+    while (m_nBitCount >= 8)
+    {
+        *m_pOut++ = static_cast<u8>(m_nBitBuffer);
+        m_nBitBuffer >>= 8;
+        m_nBitCount -= 8;
+    }
+}
+
+void CTDeflateStream::PutLiteral(unsigned nSymbol)
+{
+    PutBits(s_LiteralCode[nSymbol], s_LiteralBits[nSymbol]);
+}
+
+void CTDeflateStream::PutMatch(unsigned nLength, unsigned nDistance)
+{
+    const unsigned nLengthIndex = s_LengthSymbol[nLength - MinMatch];
+    PutBits(s_LiteralCode[257 + nLengthIndex], s_LiteralBits[257 + nLengthIndex]);
+    PutBits(nLength - LengthBase[nLengthIndex], LengthExtra[nLengthIndex]);
+
+    unsigned nDistanceIndex;
+    if (nDistance <= 256)
+    {
+        nDistanceIndex = s_DistanceSymbol[nDistance - 1];
+    }
+    else
+    {
+        nDistanceIndex = 16;
+        while (nDistanceIndex < 29 && nDistance >= DistanceBase[nDistanceIndex + 1])
+        {
+            ++nDistanceIndex;
+        }
+    }
+    PutBits(s_DistanceCode[nDistanceIndex], 5);
+    PutBits(nDistance - DistanceBase[nDistanceIndex], DistanceExtra[nDistanceIndex]);
+}
+
+void CTDeflateStream::AlignByte(void)
+{
+    if (m_nBitCount > 0)
+    {
+        *m_pOut++ = static_cast<u8>(m_nBitBuffer);
+    }
+    m_nBitBuffer = 0;
+    m_nBitCount = 0;
+}
+
+void CTDeflateStream::UpdateAdler(const u8 *pData, size_t nLength)
+{
+    u32 nSum1 = m_nAdler & 0xFFFF;
+    u32 nSum2 = m_nAdler >> 16;
+
+    while (nLength > 0)
+    {
+        const size_t nBlock = nLength < AdlerBlock ? nLength : AdlerBlock;
+        for (size_t i = 0; i < nBlock; ++i)
+        {
+            nSum1 += pData[i];
+            nSum2 += nSum1;
+        }
+        nSum1 %= AdlerModulo;
+        nSum2 %= AdlerModulo;
+        pData += nBlock;
+        nLength -= nBlock;
+    }
+
+    m_nAdler = (nSum2 << 16) | nSum1;
+}
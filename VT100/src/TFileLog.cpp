@@ -7,9 +7,11 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-24     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        f_sync() traced for the stall watchdog
 //------------------------------------------------------------------------------
 
 #include "TFileLog.h"
+#include "TStallWatchdog.h"
 
 #include <circle/logger.h>
 #include <circle/util.h>
@@ -217,7 +219,10 @@ void CTFileLog::Flush()
         return;
     }
 
-    f_sync(&m_File);
+    CTStallWatchdog *watchdog = CTStallWatchdog::Get();
+    watchdog->Trace(CTStallWatchdog::TraceFileSync, static_cast<u32>(m_PendingFlushBytes));
+    FRESULT result = f_sync(&m_File);
+    watchdog->Trace(CTStallWatchdog::TraceFileSynced, static_cast<u32>(result));
     m_PendingFlushBytes = 0;
     m_PendingFlushLines = 0;
 }
@@ -0,0 +1,348 @@
+//------------------------------------------------------------------------------
+// Module:        CTKeyMap
+// Description:   Table driven translation of USB HID key reports to VT sequences.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include "TKeyMap.h"
+
+#include <circle/util.h>
+
+namespace
+{
+// HID usage codes (USB HID Usage Tables, keyboard page 0x07)
+constexpr unsigned UsageCount = 0x68;
+constexpr u8 UsageEnter = 0x28;
+constexpr u8 UsageEscape = 0x29;
+constexpr u8 UsageBackspace = 0x2A;
+constexpr u8 UsageTab = 0x2B;
+constexpr u8 UsageF1 = 0x3A;
+constexpr u8 UsageF5 = 0x3E;
+constexpr u8 UsageInsert = 0x49;
+constexpr u8 UsageHome = 0x4A;
+constexpr u8 UsagePageUp = 0x4B;
+constexpr u8 UsageDelete = 0x4C;
+constexpr u8 UsageEnd = 0x4D;
+constexpr u8 UsagePageDown = 0x4E;
+constexpr u8 UsageRight = 0x4F;
+constexpr u8 UsageLeft = 0x50;
+constexpr u8 UsageDown = 0x51;
+constexpr u8 UsageUp = 0x52;
+constexpr u8 UsageKeypadEnter = 0x58;
+constexpr u8 UsageKeypad1 = 0x59;
+constexpr u8 UsageKeypadPeriod = 0x63;
+
+enum TPlane
+{
+    PlaneNormal,
+    PlaneShift,
+    PlaneAltGr,
+    PlaneCount
+};
+
+/// Characters of one key; 0 means the plane has no character for it.
+struct TKeyChars
+{
+    u8 usage;
+    u8 normal;
+    u8 shift;
+    u8 altGr;
+};
+
+struct TLayoutTable
+{
+    u8 chars[PlaneCount][UsageCount];
+    u8 capsLock[UsageCount];            ///< 1 if Caps Lock swaps normal and shift
+};
+
+struct TSequence
+{
+    char text[CTKeyMap::MaxSequence + 1];
+    u8 length;
+    u8 repeat;
+};
+
+struct TSequenceTable
+{
+    TSequence keys[CTKeyMap::KeyModeCount][UsageCount];
+};
+
+// US layout; the other layouts are stored as differences to it
+constexpr TKeyChars USKeys[] = {
+    {0x04, 'a', 'A', 0}, {0x05, 'b', 'B', 0}, {0x06, 'c', 'C', 0}, {0x07, 'd', 'D', 0},
+    {0x08, 'e', 'E', 0}, {0x09, 'f', 'F', 0}, {0x0A, 'g', 'G', 0}, {0x0B, 'h', 'H', 0},
+    {0x0C, 'i', 'I', 0}, {0x0D, 'j', 'J', 0}, {0x0E, 'k', 'K', 0}, {0x0F, 'l', 'L', 0},
+    {0x10, 'm', 'M', 0}, {0x11, 'n', 'N', 0}, {0x12, 'o', 'O', 0}, {0x13, 'p', 'P', 0},
+    {0x14, 'q', 'Q', 0}, {0x15, 'r', 'R', 0}, {0x16, 's', 'S', 0}, {0x17, 't', 'T', 0},
+    {0x18, 'u', 'U', 0}, {0x19, 'v', 'V', 0}, {0x1A, 'w', 'W', 0}, {0x1B, 'x', 'X', 0},
+    {0x1C, 'y', 'Y', 0}, {0x1D, 'z', 'Z', 0},
+    {0x1E, '1', '!', 0}, {0x1F, '2', '@', 0}, {0x20, '3', '#', 0}, {0x21, '4', '$', 0},
+    {0x22, '5', '%', 0}, {0x23, '6', '^', 0}, {0x24, '7', '&', 0}, {0x25, '8', '*', 0},
+    {0x26, '9', '(', 0}, {0x27, '0', ')', 0},
+    {0x2C, ' ', ' ', 0}, {0x2D, '-', '_', 0}, {0x2E, '=', '+', 0}, {0x2F, '[', '{', 0},
+    {0x30, ']', '}', 0}, {0x31, '\\', '|', 0}, {0x32, '#', '~', 0}, {0x33, ';', ':', 0},
+    {0x34, '\'', '"', 0}, {0x35, '`', '~', 0}, {0x36, ',', '<', 0}, {0x37, '.', '>', 0},
+    {0x38, '/', '?', 0}, {0x64, '\\', '|', 0},
+    // Keypad with Num Lock on
+    {0x54, '/', '/', 0}, {0x55, '*', '*', 0}, {0x56, '-', '-', 0}, {0x57, '+', '+', 0},
+    {0x59, '1', '1', 0}, {0x5A, '2', '2', 0}, {0x5B, '3', '3', 0}, {0x5C, '4', '4', 0},
+    {0x5D, '5', '5', 0}, {0x5E, '6', '6', 0}, {0x5F, '7', '7', 0}, {0x60, '8', '8', 0},
+    {0x61, '9', '9', 0}, {0x62, '0', '0', 0}, {0x63, '.', '.', 0}, {0x67, '=', '=', 0},
+};
+
+constexpr TKeyChars UKKeys[] = {
+    {0x1F, '2', '"', 0}, {0x20, '3', 0xA3, 0}, {0x32, '#', '~', 0}, {0x34, '\'', '@', 0},
+    {0x35, '`', 0xAC, 0}, {0x64, '\\', '|', 0},
+};
+
+// German layout, ISO-8859-1 for umlauts and symbols
+constexpr TKeyChars DEKeys[] = {
+    {0x1C, 'z', 'Z', 0}, {0x1D, 'y', 'Y', 0}, {0x14, 'q', 'Q', '@'}, {0x10, 'm', 'M', 0xB5},
+    {0x1E, '1', '!', 0}, {0x1F, '2', '"', 0xB2}, {0x20, '3', 0xA7, 0xB3}, {0x21, '4', '$', 0},
+    {0x22, '5', '%', 0}, {0x23, '6', '&', 0}, {0x24, '7', '/', '{'}, {0x25, '8', '(', '['},
+    {0x26, '9', ')', ']'}, {0x27, '0', '=', '}'},
+    {0x2D, 0xDF, '?', '\\'}, {0x2E, 0xB4, '`', 0}, {0x2F, 0xFC, 0xDC, 0}, {0x30, '+', '*', '~'},
+    {0x31, '#', '\'', 0}, {0x32, '#', '\'', 0}, {0x33, 0xF6, 0xD6, 0}, {0x34, 0xE4, 0xC4, 0},
+    {0x35, '^', 0xB0, 0}, {0x36, ',', ';', 0}, {0x37, '.', ':', 0}, {0x38, '-', '_', 0},
+    {0x64, '<', '>', '|'}, {0x63, ',', ',', 0},
+};
+
+// Keypad keys with Num Lock off in numeric mode, indexed from UsageKeypad1
+constexpr u8 KeypadNavigation[] = {
+    UsageEnd, UsageDown, UsagePageDown, UsageLeft, 0, UsageRight,
+    UsageHome, UsageUp, UsagePageUp, UsageInsert, UsageDelete,
+};
+
+// Keypad keys in application mode and the final character of ESC O x
+constexpr TKeyChars KeypadApplication[] = {
+    {0x54, 'o', 0, 0}, {0x55, 'j', 0, 0}, {0x56, 'm', 0, 0}, {0x57, 'l', 0, 0},
+    {0x58, 'M', 0, 0}, {0x59, 'q', 0, 0}, {0x5A, 'r', 0, 0}, {0x5B, 's', 0, 0},
+    {0x5C, 't', 0, 0}, {0x5D, 'u', 0, 0}, {0x5E, 'v', 0, 0}, {0x5F, 'w', 0, 0},
+    {0x60, 'x', 0, 0}, {0x61, 'y', 0, 0}, {0x62, 'p', 0, 0}, {0x63, 'n', 0, 0},
+};
+
+// F5 to F12 (xterm numbering, F11 and F12 skip 22)
+constexpr const char *FunctionKeys[] = {
+    "\x1b[15~", "\x1b[17~", "\x1b[18~", "\x1b[19~", "\x1b[20~", "\x1b[21~", "\x1b[23~", "\x1b[24~",
+};
+
+template <size_t N>
+constexpr void ApplyKeys(TLayoutTable &rTable, const TKeyChars (&Keys)[N])
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        rTable.chars[PlaneNormal][Keys[i].usage] = Keys[i].normal;
+        rTable.chars[PlaneShift][Keys[i].usage] = Keys[i].shift;
+        rTable.chars[PlaneAltGr][Keys[i].usage] = Keys[i].altGr;
+    }
+}
+
+constexpr boolean IsLowerLetter(u8 ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 0xE0 && ch <= 0xFE && ch != 0xF7);
+}
+
+template <size_t N>
+constexpr TLayoutTable MakeLayout(const TKeyChars (&Overrides)[N])
+{
+    TLayoutTable table{};
+    ApplyKeys(table, USKeys);
+    ApplyKeys(table, Overrides);
+    for (unsigned usage = 0; usage < UsageCount; ++usage)
+    {
+        const u8 ch = table.chars[PlaneNormal][usage];
+        table.capsLock[usage] = IsLowerLetter(ch) && table.chars[PlaneShift][usage] == ch - 0x20;
+    }
+    return table;
+}
+
+constexpr TKeyChars NoKeys[] = {{0, 0, 0, 0}};
+
+constexpr void SetSequence(TSequence &rSequence, const char *pText, boolean bRepeat)
+{
+    u8 length = 0;
+    while (pText[length] != '\0' && length < CTKeyMap::MaxSequence)
+    {
+        rSequence.text[length] = pText[length];
+        ++length;
+    }
+    rSequence.text[length] = '\0';
+    rSequence.length = length;
+    rSequence.repeat = bRepeat;
+}
+
+/// ESC, optional intermediate ('[', 'O' or '?'), final character.
+constexpr void SetEscape(TSequence &rSequence, char chIntro, char chFinal, boolean bRepeat)
+{
+    const char text[4] = {'\x1b', chIntro != '\0' ? chIntro : chFinal, chIntro != '\0' ? chFinal : '\0', '\0'};
+    SetSequence(rSequence, text, bRepeat);
+}
+
+constexpr TSequenceTable MakeSequences(void)
+{
+    TSequenceTable table{};
+    for (unsigned mode = 0; mode < CTKeyMap::KeyModeCount; ++mode)
+    {
+        const boolean bCursorApplication = (mode & CTKeyMap::KeyModeCursorApplication) != 0;
+        const boolean bKeypadApplication = (mode & CTKeyMap::KeyModeKeypadApplication) != 0;
+        const boolean bVT52 = (mode & CTKeyMap::KeyModeVT52) != 0;
+        TSequence *keys = table.keys[mode];
+
+        const char chCursor = bVT52 ? '\0' : (bCursorApplication ? 'O' : '[');
+        SetEscape(keys[UsageUp], chCursor, 'A', TRUE);
+        SetEscape(keys[UsageDown], chCursor, 'B', TRUE);
+        SetEscape(keys[UsageRight], chCursor, 'C', TRUE);
+        SetEscape(keys[UsageLeft], chCursor, 'D', TRUE);
+
+        const char chHome = (bCursorApplication && !bVT52) ? 'O' : '[';
+        SetEscape(keys[UsageHome], chHome, 'H', FALSE);
+        SetEscape(keys[UsageEnd], chHome, 'F', FALSE);
+        SetSequence(keys[UsageInsert], "\x1b[2~", FALSE);
+        SetSequence(keys[UsageDelete], "\x1b[3~", TRUE);
+        SetSequence(keys[UsagePageUp], "\x1b[5~", FALSE);
+        SetSequence(keys[UsagePageDown], "\x1b[6~", FALSE);
+
+        // F1 to F4 are the VT100 PF keys
+        for (unsigned i = 0; i < 4; ++i)
+        {
+            SetEscape(keys[UsageF1 + i], bVT52 ? '\0' : 'O', static_cast<char>('P' + i), FALSE);
+        }
+        for (unsigned i = 0; i < sizeof(FunctionKeys) / sizeof(FunctionKeys[0]); ++i)
+        {
+            SetSequence(keys[UsageF5 + i], FunctionKeys[i], FALSE);
+        }
+
+        SetSequence(keys[UsageEnter], "\n", TRUE);
+        SetSequence(keys[UsageEscape], "\x1b", FALSE);
+        SetSequence(keys[UsageBackspace], "\x7f", TRUE);
+        SetSequence(keys[UsageTab], "\t", FALSE);
+
+        if (bKeypadApplication)
+        {
+            for (const TKeyChars &key : KeypadApplication)
+            {
+                SetEscape(keys[key.usage], bVT52 ? '?' : 'O', static_cast<char>(key.normal), FALSE);
+            }
+        }
+        else
+        {
+            SetSequence(keys[UsageKeypadEnter], "\n", TRUE);
+        }
+    }
+    return table;
+}
+
+constexpr TLayoutTable Layouts[CTKeyMap::LayoutCount] = {
+    MakeLayout(NoKeys),
+    MakeLayout(UKKeys),
+    MakeLayout(DEKeys),
+};
+
+constexpr TSequenceTable Sequences = MakeSequences();
+
+constexpr const char *LayoutNames[CTKeyMap::LayoutCount] = {"US", "UK", "DE"};
+
+static_assert(Layouts[CTKeyMap::LayoutDE].chars[PlaneNormal][0x1C] == 'z', "German layout swaps Y and Z");
+static_assert(Layouts[CTKeyMap::LayoutDE].capsLock[0x33] == 1, "Caps Lock applies to umlauts");
+static_assert(Sequences.keys[CTKeyMap::KeyModeCursorApplication][UsageUp].text[1] == 'O', "DECCKM arrow");
+static_assert(Sequences.keys[CTKeyMap::KeyModeKeypadApplication][UsageKeypadEnter].length == 3, "DECKPAM enter");
+}
+
+boolean CTKeyMap::ParseLayout(const char *pName, TLayout &rLayout)
+{
+    if (pName == nullptr)
+    {
+        return FALSE;
+    }
+
+    for (unsigned i = 0; i < LayoutCount; ++i)
+    {
+        if (strcmp(pName, LayoutNames[i]) == 0)
+        {
+            rLayout = static_cast<TLayout>(i);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+const char *CTKeyMap::GetLayoutName(TLayout Layout)
+{
+    return Layout < LayoutCount ? LayoutNames[Layout] : "?";
+}
+
+unsigned CTKeyMap::Translate(TLayout Layout, u8 ucUsage, u8 ucModifiers, u8 ucLocks,
+                             u8 ucModes, char *pBuffer, boolean &rRepeat)
+{
+    rRepeat = FALSE;
+    if (ucUsage >= UsageCount || Layout >= LayoutCount || pBuffer == nullptr)
+    {
+        return 0;
+    }
+    ucModes &= KeyModeCount - 1;
+
+    // Num Lock off turns the numeric keypad into an editing block
+    if (ucUsage >= UsageKeypad1 && ucUsage <= UsageKeypadPeriod
+        && !(ucModes & KeyModeKeypadApplication) && !(ucLocks & LockNum))
+    {
+        ucUsage = KeypadNavigation[ucUsage - UsageKeypad1];
+        if (ucUsage == 0)
+        {
+            return 0;
+        }
+    }
+
+    const TSequence &rSequence = Sequences.keys[ucModes][ucUsage];
+    if (rSequence.length > 0)
+    {
+        memcpy(pBuffer, rSequence.text, rSequence.length + 1U);
+        rRepeat = rSequence.repeat;
+        return rSequence.length;
+    }
+
+    const TLayoutTable &rTable = Layouts[Layout];
+    u8 ch = 0;
+    if (ucModifiers & ModRightAlt)
+    {
+        ch = rTable.chars[PlaneAltGr][ucUsage];
+    }
+    if (ch == 0)
+    {
+        boolean bShift = (ucModifiers & (ModLeftShift | ModRightShift)) != 0;
+        if ((ucLocks & LockCaps) && rTable.capsLock[ucUsage])
+        {
+            bShift = !bShift;
+        }
+        ch = rTable.chars[bShift ? PlaneShift : PlaneNormal][ucUsage];
+    }
+    if (ch == 0)
+    {
+        return 0;
+    }
+
+    if (ucModifiers & (ModLeftCtrl | ModRightCtrl))
+    {
+        if ((ch >= 'A' && ch <= '_') || (ch >= 'a' && ch <= 'z'))
+        {
+            ch &= 0x1F;
+        }
+        else if (ch == '?')
+        {
+            ch = 0x7F;
+        }
+        if (ch == 0)
+        {
+            return 0; // NUL cannot travel in a key string
+        }
+    }
+
+    pBuffer[0] = static_cast<char>(ch);
+    pBuffer[1] = '\0';
+    rRepeat = ch >= 0x20 || ch == '\b' || ch == '\r' || ch == '\n';
+    return 1;
+}
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-21     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Raw HID report path with CTKeyMap tables
+// 2026-10-18     R. Zuehlsdorff        Stall watchdog beats and USB update trace
 //------------------------------------------------------------------------------
 
 // Include class header
@@ -15,6 +17,7 @@
 // Full class definitions for classes used in this module
 // Include Circle core components
 #include "kernel.h"
+#include <circle/koptions.h>
 #include <circle/logger.h>
 #include <circle/usb/usbhcidevice.h>
 #include <circle/usb/usbkeyboard.h>
@@ -26,6 +29,7 @@
 #include <string.h>
 #include "hal.h"
 #include "TConfig.h"
+#include "TStallWatchdog.h"
 
 
 LOGMODULE("TKeyboard");
@@ -128,6 +132,11 @@ CTKeyboard::CTKeyboard(void)
 	  m_PendingAutoRepeatRawKey(0),
 	  m_KeyRepeatDelayMs(KeyRepeatDelayDefaultMs),
 	  m_KeyRepeatRateCps(KeyRepeatRateDefaultCps),
+	  m_bRawKeymap(FALSE),
+	  m_KeyLayout(CTKeyMap::LayoutUS),
+	  m_ucKeyModes(0),
+	  m_ucLocks(CTKeyMap::LockNum),
+	  m_bLEDsPending(FALSE),
 	  m_pKeyPressedHandler(nullptr),
 	  m_pKeyStatusHandlerRaw(nullptr)
 {
@@ -180,6 +189,16 @@ CTKeyboard::TKeyStatusHandlerRaw CTKeyboard::GetKeyStatusHandlerRaw() const
 	return m_pKeyStatusHandlerRaw;
 }
 
+void CTKeyboard::SetKeyModes(unsigned nModes)
+{
+	m_ucKeyModes = static_cast<u8>(nModes & (CTKeyMap::KeyModeCount - 1));
+}
+
+unsigned CTKeyboard::GetKeyModes() const
+{
+	return m_ucKeyModes;
+}
+
 CTKeyboard::~CTKeyboard (void)
 {
 		StopAutoRepeat();
@@ -189,6 +208,17 @@ boolean CTKeyboard::Initialize (void)
 {
     boolean bOK = TRUE;
 
+	const char *pKeymap = CKernelOptions::Get()->GetKeyMap();
+	m_bRawKeymap = CTKeyMap::ParseLayout(pKeymap, m_KeyLayout);
+	if (m_bRawKeymap)
+	{
+		LOGNOTE("Keymap %s: raw HID reports, VT key tables", CTKeyMap::GetLayoutName(m_KeyLayout));
+	}
+	else
+	{
+		LOGNOTE("Keymap %s: no VT key table, using Circle translation", pKeymap);
+	}
+
 	if (m_pUSBHost != nullptr)
 	{
 		m_pUSBHost->UpdatePlugAndPlay();
@@ -213,8 +243,17 @@ bool CTKeyboard::UpdateKeyboard (boolean bDevicesUpdated)
 		if (m_pKeyboardDevice != nullptr)
 		{
 			m_pKeyboardDevice->RegisterRemovedHandler (KeyboardRemovedHandler);
-			m_pKeyboardDevice->RegisterKeyPressedHandler (KeyPressedTrampoline);
-			m_pKeyboardDevice->RegisterKeyStatusHandlerRaw (KeyStatusTrampoline, TRUE);
+			if (m_bRawKeymap)
+			{
+				// Raw mode only: the reports are translated in HandleRawKeyPress()
+				m_pKeyboardDevice->RegisterKeyStatusHandlerRaw (KeyStatusTrampoline, FALSE);
+				m_bLEDsPending = TRUE;
+			}
+			else
+			{
+				m_pKeyboardDevice->RegisterKeyPressedHandler (KeyPressedTrampoline);
+				m_pKeyboardDevice->RegisterKeyStatusHandlerRaw (KeyStatusTrampoline, TRUE);
+			}
 			LOGNOTE("Keyboard connected - Just type something!");
 			connected = TRUE;
 		}
@@ -235,8 +274,13 @@ bool CTKeyboard::UpdateKeyboard (boolean bDevicesUpdated)
 
 void CTKeyboard::Run()
 {
+    CTStallWatchdog *pWatchdog = CTStallWatchdog::Get();
+
     while (!IsSuspended())
     {
+		pWatchdog->Beat(CTStallWatchdog::WatchKeyboard);
+		pWatchdog->Trace(CTStallWatchdog::TraceUsbBegin, 0);
+
 		boolean devicesUpdated = FALSE;
 		if (m_pUSBHost != nullptr)
 		{
@@ -246,8 +290,11 @@ void CTKeyboard::Run()
 		UpdateKeyboard(devicesUpdated);
         UpdateLEDs();
 
+		pWatchdog->Trace(CTStallWatchdog::TraceUsbEnd, devicesUpdated ? 1 : 0);
         CScheduler::Get()->MsSleep(20);
     }
+
+	pWatchdog->Disarm(CTStallWatchdog::WatchKeyboard);
 }
 
 void CTKeyboard::UpdateLEDs (void)
@@ -256,7 +303,16 @@ void CTKeyboard::UpdateLEDs (void)
 	{
 		// CUSBKeyboardDevice::UpdateLEDs() must not be called in interrupt context,
 		// that's why this must be done here. This does nothing in raw mode.
-		m_pKeyboardDevice->UpdateLEDs ();
+		if (!m_bRawKeymap)
+		{
+			m_pKeyboardDevice->UpdateLEDs ();
+		}
+		else if (m_bLEDsPending)
+		{
+			// In raw mode the lock state is ours; same restriction for SetLEDs()
+			m_bLEDsPending = FALSE;
+			m_pKeyboardDevice->SetLEDs (m_ucLocks);
+		}
 	}
 }
 
@@ -315,18 +371,23 @@ void CTKeyboard::HandleKeyPressed(const char *pString, boolean fromAutoRepeat)
 		return;
 	}
 
+	boolean queueRepeat = FALSE;
 	if (!fromAutoRepeat)
 	{
-		if (m_AutoRepeat.active || m_AutoRepeat.pendingStart)
-		{
-			StopAutoRepeat();
-		}
+		queueRepeat = ShouldQueueAutoRepeat(pString);
 	}
 
-	boolean queueRepeat = FALSE;
+	DispatchKey(pString, fromAutoRepeat, queueRepeat);
+}
+
+void CTKeyboard::DispatchKey(const char *pString, boolean fromAutoRepeat, boolean queueRepeat)
+{
 	if (!fromAutoRepeat)
 	{
-		queueRepeat = ShouldQueueAutoRepeat(pString);
+		if (m_AutoRepeat.active || m_AutoRepeat.pendingStart)
+		{
+			StopAutoRepeat();
+		}
 	}
 
 	CString convertedLine;
@@ -352,6 +413,37 @@ void CTKeyboard::HandleKeyPressed(const char *pString, boolean fromAutoRepeat)
 	}
 }
 
+void CTKeyboard::HandleRawKeyPress(unsigned char ucModifiers, unsigned char ucUsage)
+{
+	if (ucUsage == CTKeyMap::UsageCapsLock || ucUsage == CTKeyMap::UsageNumLock)
+	{
+		m_ucLocks ^= (ucUsage == CTKeyMap::UsageCapsLock) ? CTKeyMap::LockCaps : CTKeyMap::LockNum;
+		m_bLEDsPending = TRUE;
+		return;
+	}
+
+	char sequence[CTKeyMap::MaxSequence + 1];
+	boolean repeat = FALSE;
+	if (CTKeyMap::Translate(m_KeyLayout, ucUsage, ucModifiers, m_ucLocks, m_ucKeyModes, sequence, repeat) == 0)
+	{
+		return;
+	}
+
+	CTConfig *config = CTConfig::Get();
+	if (config != nullptr && !config->GetKeyAutoRepeatEnabled())
+	{
+		repeat = FALSE;
+	}
+
+	DispatchKey(sequence, FALSE, repeat);
+	if (repeat)
+	{
+		// The usage code is known here, no need to wait for the next report
+		m_PendingAutoRepeatRawKey = ucUsage;
+		TryActivateAutoRepeat();
+	}
+}
+
 boolean CTKeyboard::ShouldQueueAutoRepeat(const char *pString) const
 {
 	CTConfig *config = CTConfig::Get();
@@ -555,13 +647,22 @@ void CTKeyboard::HandleRawKeyStatus(unsigned char ucModifiers, const unsigned ch
 		if (!wasPresent)
 		{
 			newKey = code;
-			break;
+			if (!m_bRawKeymap)
+			{
+				break;
+			}
+			// Several keys may go down within one report; send them in report order
+			HandleRawKeyPress(ucModifiers, code);
 		}
 	}
 
 	if (newKey != 0)
 	{
-		m_PendingAutoRepeatRawKey = newKey;
+		// Raw keymap presses armed their repeat in HandleRawKeyPress()
+		if (!m_bRawKeymap)
+		{
+			m_PendingAutoRepeatRawKey = newKey;
+		}
 	}
 	else
 	{
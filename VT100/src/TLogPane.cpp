@@ -0,0 +1,256 @@
+//------------------------------------------------------------------------------
+// Module:        CTLogPane
+// Description:   Rate-limited overlay pane for screen log output.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include "TLogPane.h"
+#include "TRenderer.h"
+
+#include <circle/timer.h>
+#include <circle/util.h>
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTLogPane *s_pThis = nullptr;
+CTLogPane *CTLogPane::Get(void)
+{
+    if (s_pThis == nullptr)
+    {
+        s_pThis = new CTLogPane();
+    }
+    return s_pThis;
+}
+
+CTLogPane::CTLogPane(void)
+    : CDevice(),
+      m_pRenderer(nullptr),
+      m_pPassThrough(nullptr),
+      m_bInitialized(FALSE),
+      m_ParseState(ParseText),
+      m_nSgrParam(0),
+      m_nLines(0),
+      m_bVisible(FALSE),
+      m_bShown(FALSE),
+      m_nFirstRow(0),
+      m_nRows(0),
+      m_nConsole(0),
+      m_nShownLines(0),
+      m_nLastUpdateTicks(0),
+      m_nUpdates(0)
+{
+    m_Current.length = 0;
+    m_Current.highlight = FALSE;
+    memset(m_RowGenerations, 0, sizeof(m_RowGenerations));
+}
+
+CTLogPane::~CTLogPane(void)
+{
+}
+
+void CTLogPane::Initialize(CDevice *pPassThrough)
+{
+    m_pPassThrough = pPassThrough;
+    m_bInitialized = TRUE;
+}
+
+void CTLogPane::Attach(CTRenderer *pRenderer)
+{
+    m_SpinLock.Acquire();
+    m_pRenderer = pRenderer;
+    m_SpinLock.Release();
+}
+
+int CTLogPane::Write(const void *pBuffer, size_t nCount)
+{
+    if (m_pRenderer == nullptr)
+    {
+        return m_pPassThrough != nullptr ? m_pPassThrough->Write(pBuffer, nCount) : static_cast<int>(nCount);
+    }
+
+    const char *pChar = static_cast<const char *>(pBuffer);
+    m_SpinLock.Acquire();
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        Parse(pChar[i]);
+    }
+    m_SpinLock.Release();
+
+    return static_cast<int>(nCount);
+}
+
+void CTLogPane::Parse(char chChar)
+{
+    switch (m_ParseState)
+    {
+    case ParseText:
+        if (chChar == '\x1B')
+        {
+            m_ParseState = ParseEscape;
+        }
+        else if (chChar == '\n')
+        {
+            EndLine();
+        }
+        else if ((chChar >= ' ' && chChar < '\x7F') || chChar == '\t')
+        {
+            if (m_Current.length < LineLength)
+            {
+                m_Current.text[m_Current.length++] = chChar == '\t' ? ' ' : chChar;
+            }
+        }
+        break;
+
+    case ParseEscape:
+        m_ParseState = chChar == '[' ? ParseCsi : ParseText;
+        m_nSgrParam = 0;
+        break;
+
+    case ParseCsi:
+        // CLogger marks warnings and errors with SGR attributes; any non-zero one highlights
+        if (chChar >= '0' && chChar <= '9')
+        {
+            m_nSgrParam = m_nSgrParam < 1000 ? m_nSgrParam * 10 + static_cast<unsigned>(chChar - '0') : m_nSgrParam;
+        }
+        else if (chChar == ';' || (chChar >= '\x40' && chChar <= '\x7E'))
+        {
+            if (chChar != ';' && chChar != 'm')
+            {
+                m_ParseState = ParseText;
+                break;
+            }
+            if (m_nSgrParam != 0)
+            {
+                m_Current.highlight = TRUE;
+            }
+            m_nSgrParam = 0;
+            m_ParseState = chChar == ';' ? ParseCsi : ParseText;
+        }
+        break;
+    }
+}
+
+void CTLogPane::EndLine(void)
+{
+    TLine &rLine = m_Lines[m_nLines % MaxLines];
+    memcpy(rLine.text, m_Current.text, m_Current.length);
+    rLine.length = m_Current.length;
+    rLine.highlight = m_Current.highlight;
+    ++m_nLines;
+
+    m_Current.length = 0;
+    m_Current.highlight = FALSE;
+}
+
+void CTLogPane::Toggle(void)
+{
+    if (m_pRenderer != nullptr)
+    {
+        m_bVisible = !m_bVisible;
+    }
+}
+
+void CTLogPane::Tick(boolean bScreenFree)
+{
+    if (m_pRenderer == nullptr || !bScreenFree)
+    {
+        return;
+    }
+
+    if (!m_bVisible)
+    {
+        if (m_bShown)
+        {
+            Hide();
+        }
+        return;
+    }
+
+    // Coalesce: whatever arrived since the last update is drawn in one pass
+    const unsigned nNow = CTimer::GetClockTicks();
+    if (m_bShown && nNow - m_nLastUpdateTicks < 1000000U / MaxUpdatesPerSecond)
+    {
+        return;
+    }
+
+    const unsigned screenRows = m_pRenderer->GetRows();
+    const unsigned rows = screenRows / 2 < PaneRows ? screenRows / 2 : PaneRows;
+    if (rows == 0)
+    {
+        return;
+    }
+    const unsigned firstRow = screenRows - rows;
+    const unsigned console = m_pRenderer->GetActiveConsole();
+    const boolean bAll = !m_bShown || firstRow != m_nFirstRow || rows != m_nRows || console != m_nConsole;
+
+    // The newest line goes to the bottom row
+    TLine lines[PaneRows];
+    m_SpinLock.Acquire();
+    const u32 nLines = m_nLines;
+    for (unsigned i = 0; i < rows; ++i)
+    {
+        const u32 age = rows - 1 - i;
+        if (age < nLines && age < MaxLines)
+        {
+            lines[i] = m_Lines[(nLines - 1 - age) % MaxLines];
+        }
+        else
+        {
+            lines[i].length = 0;
+            lines[i].highlight = FALSE;
+        }
+    }
+    m_SpinLock.Release();
+
+    // Rows with a new line, and rows the host has written over since the last update
+    const boolean bNewLines = nLines != m_nShownLines;
+    u32 generations[PaneRows];
+    unsigned first = rows;
+    unsigned end = 0;
+    for (unsigned i = 0; i < rows; ++i)
+    {
+        generations[i] = m_pRenderer->GetCellRowGeneration(firstRow + i);
+        if (bAll || bNewLines || generations[i] != m_RowGenerations[i])
+        {
+            first = i < first ? i : first;
+            end = i + 1;
+        }
+    }
+
+    if (first >= end)
+    {
+        return;
+    }
+
+    CTRenderer::TOverlayLine overlay[PaneRows];
+    for (unsigned i = first; i < end; ++i)
+    {
+        overlay[i - first].pText = lines[i].text;
+        overlay[i - first].nLength = lines[i].length;
+        overlay[i - first].bHighlight = lines[i].highlight;
+    }
+
+    // Generations are taken before drawing, so host output in between is seen next time
+    memcpy(m_RowGenerations, generations, sizeof(generations));
+    m_pRenderer->DrawOverlayLines(firstRow + first, overlay, end - first);
+
+    m_bShown = TRUE;
+    m_nFirstRow = firstRow;
+    m_nRows = rows;
+    m_nConsole = console;
+    m_nShownLines = nLines;
+    m_nLastUpdateTicks = nNow;
+    ++m_nUpdates;
+}
+
+void CTLogPane::Hide(void)
+{
+    m_pRenderer->RefreshRows(m_nFirstRow, m_nFirstRow + m_nRows);
+    m_bShown = FALSE;
+}
@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+// Module:        CTPerfHud
+// Description:   Hotkey-toggled status line with throughput and health counters.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include "TPerfHud.h"
+
+#include <circle/timer.h>
+#include <circle/util.h>
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTPerfHud *s_pThis = nullptr;
+CTPerfHud *CTPerfHud::Get(void)
+{
+    if (s_pThis == nullptr)
+    {
+        s_pThis = new CTPerfHud();
+    }
+    return s_pThis;
+}
+
+CTPerfHud::CTPerfHud(void)
+    : m_pRenderer(nullptr),
+      m_pSampler(nullptr),
+      m_bVisible(FALSE),
+      m_bShown(FALSE),
+      m_nConsole(0),
+      m_nRowGeneration(0),
+      m_bSampled(FALSE),
+      m_nSampleTicks(0),
+      m_nLastCostUs(0),
+      m_nUpdates(0)
+{
+    memset(&m_Counters, 0, sizeof(m_Counters));
+    memset(&m_Sample, 0, sizeof(m_Sample));
+    m_Text[0] = '\0';
+    m_ShownText[0] = '\0';
+}
+
+CTPerfHud::~CTPerfHud(void)
+{
+}
+
+void CTPerfHud::Initialize(CTRenderer *pRenderer, TSampler *pSampler)
+{
+    m_pRenderer = pRenderer;
+    m_pSampler = pSampler;
+}
+
+void CTPerfHud::Toggle(void)
+{
+    if (m_pRenderer != nullptr)
+    {
+        m_bVisible = !m_bVisible;
+    }
+}
+
+void CTPerfHud::Tick(boolean bScreenFree)
+{
+    if (m_pRenderer == nullptr || !bScreenFree)
+    {
+        return;
+    }
+
+    if (!m_bVisible)
+    {
+        if (m_bShown)
+        {
+            Hide();
+        }
+        // Rates start over when shown again, not averaged across the hidden time
+        m_bSampled = FALSE;
+        return;
+    }
+
+    const unsigned nNow = CTimer::GetClockTicks();
+    if (m_bSampled && nNow - m_nSampleTicks < 1000000U / UpdatesPerSecond)
+    {
+        return;
+    }
+
+    CTRenderer::TPerfCounters counters;
+    m_pRenderer->GetPerfCounters(counters);
+    TSample sample;
+    memset(&sample, 0, sizeof(sample));
+    if (m_pSampler != nullptr)
+    {
+        (*m_pSampler)(sample);
+    }
+
+    const boolean bFirst = !m_bSampled;
+    if (!bFirst)
+    {
+        Format(counters, sample, nNow - m_nSampleTicks);
+    }
+    m_Counters = counters;
+    m_Sample = sample;
+    m_nSampleTicks = nNow;
+    m_bSampled = TRUE;
+    if (bFirst)
+    {
+        // Nothing to take a rate from yet; the line appears with the next sample
+        return;
+    }
+
+    // Row 0 is redrawn when the text changed or the host wrote over it
+    const unsigned console = m_pRenderer->GetActiveConsole();
+    const u32 generation = m_pRenderer->GetCellRowGeneration(0);
+    if (!m_bShown || console != m_nConsole || generation != m_nRowGeneration
+        || strcmp(m_Text, m_ShownText) != 0)
+    {
+        CTRenderer::TOverlayLine line;
+        line.pText = m_Text;
+        line.nLength = strlen(m_Text);
+        line.bHighlight = FALSE;
+        m_pRenderer->DrawOverlayLines(0, &line, 1);
+
+        strcpy(m_ShownText, m_Text);
+        m_nRowGeneration = generation;
+        m_nConsole = console;
+        m_bShown = TRUE;
+        ++m_nUpdates;
+    }
+
+    m_nLastCostUs = CTimer::GetClockTicks() - nNow;
+}
+
+void CTPerfHud::Format(const CTRenderer::TPerfCounters &rCounters, const TSample &rSample, unsigned nElapsedUs)
+{
+    if (nElapsedUs == 0)
+    {
+        nElapsedUs = 1;
+    }
+
+    const u64 bytes = rCounters.nBytes - m_Counters.nBytes;
+    const u64 busyUs = rCounters.nBusyUs - m_Counters.nBusyUs;
+    const u64 blits = rCounters.nBlits - m_Counters.nBlits;
+    const u64 netRx = rSample.nNetRxBytes - m_Sample.nNetRxBytes;
+    const u64 netTx = rSample.nNetTxBytes - m_Sample.nNetTxBytes;
+    unsigned busyPercent = static_cast<unsigned>(busyUs * 100 / nElapsedUs);
+    busyPercent = busyPercent > 100 ? 100 : busyPercent;
+
+    // Cost of the previous update against this interval, in 1/100 percent
+    const unsigned hudHundredths = static_cast<unsigned>(static_cast<u64>(m_nLastCostUs) * 10000 / nElapsedUs);
+
+    CString text("IN ");
+    AppendScaled(text, bytes * 1000000 / nElapsedUs);
+
+    CString part;
+    part.Format("/s RDR %u%% BLT ", busyPercent);
+    text.Append(part);
+    AppendScaled(text, blits * 1000000 / nElapsedUs);
+
+    part.Format("/s OVR %u %s RX ", rSample.nUartOverruns,
+                !rSample.bFlowControl ? "-" : rSample.bXoff ? "XOFF" : "XON");
+    text.Append(part);
+    AppendScaled(text, netRx * 1000000 / nElapsedUs);
+    text.Append("/s TX ");
+    AppendScaled(text, netTx * 1000000 / nElapsedUs);
+    text.Append("/s HEAP ");
+    AppendScaled(text, rSample.nFreeHeap);
+
+    part.Format(" HUD %u.%02u%%", hudHundredths / 100, hudHundredths % 100);
+    text.Append(part);
+
+    strncpy(m_Text, text, LineLength);
+    m_Text[LineLength] = '\0';
+}
+
+void CTPerfHud::AppendScaled(CString &rText, u64 nValue)
+{
+    CString part;
+    if (nValue < 1000)
+    {
+        part.Format("%u", static_cast<unsigned>(nValue));
+    }
+    else if (nValue < 1000000)
+    {
+        part.Format("%u.%uK", static_cast<unsigned>(nValue / 1000), static_cast<unsigned>(nValue / 100 % 10));
+    }
+    else
+    {
+        part.Format("%u.%uM", static_cast<unsigned>(nValue / 1000000), static_cast<unsigned>(nValue / 100000 % 10));
+    }
+    rText.Append(part);
+}
+
+void CTPerfHud::Hide(void)
+{
+    m_pRenderer->RefreshRows(0, 1);
+    m_bShown = FALSE;
+}
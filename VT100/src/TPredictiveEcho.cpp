@@ -0,0 +1,389 @@
+//------------------------------------------------------------------------------
+// Module:        CTPredictiveEcho
+// Description:   Speculative local echo for high-latency TCP host sessions.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Confirm only cells the host wrote and moved past
+//------------------------------------------------------------------------------
+
+// Include class header
+#include "TPredictiveEcho.h"
+
+// Include Circle core components
+#include <circle/logger.h>
+#include <circle/timer.h>
+#include <string.h>
+
+// Include application components
+#include "TRenderer.h"
+
+LOGMODULE("PredictiveEcho");
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTPredictiveEcho *s_pThis = 0;
+CTPredictiveEcho *CTPredictiveEcho::Get(void)
+{
+    if (s_pThis == 0)
+    {
+        s_pThis = new CTPredictiveEcho();
+    }
+    return s_pThis;
+}
+
+CTPredictiveEcho::CTPredictiveEcho(void)
+    : m_pRenderer(nullptr),
+      m_nMode(ModeOff),
+      m_nCount(0),
+      m_bAnchored(FALSE),
+      m_nRow(0),
+      m_nColumn(0),
+      m_bConfident(FALSE),
+      m_bHighLatency(FALSE),
+      m_nSmoothedRttUs(0),
+      m_nConfirmed(0),
+      m_nMispredicted(0)
+{
+}
+
+CTPredictiveEcho::~CTPredictiveEcho(void)
+{
+    m_pRenderer = nullptr;
+}
+
+void CTPredictiveEcho::Initialize(CTRenderer *pRenderer, unsigned nMode)
+{
+    m_pRenderer = pRenderer;
+    SetMode(nMode);
+}
+
+void CTPredictiveEcho::SetMode(unsigned nMode)
+{
+    if (nMode > ModeAlways)
+    {
+        nMode = ModeAlways;
+    }
+
+    if (nMode == ModeOff)
+    {
+        Rollback();
+    }
+
+    m_nMode = nMode;
+    SyncOverlays();
+}
+
+void CTPredictiveEcho::OnHostInput(const char *pData, size_t nLength)
+{
+    if (m_nMode == ModeOff || m_pRenderer == nullptr || pData == nullptr || nLength == 0)
+    {
+        return;
+    }
+
+    if (nLength == 1 && pData[0] >= 0x20 && pData[0] <= 0x7E)
+    {
+        PredictChar(pData[0]);
+        return;
+    }
+
+    if (nLength == 1 && (pData[0] == 0x7F || pData[0] == '\b'))
+    {
+        PredictBackspace();
+        return;
+    }
+
+    // Cursor keys in normal (CSI) and application (SS3) mode
+    if (nLength == 3 && pData[0] == '\x1B' && (pData[1] == '[' || pData[1] == 'O'))
+    {
+        if (pData[2] == 'C' && Anchor())
+        {
+            if (m_nColumn + 1 < m_pRenderer->GetColumns())
+            {
+                ++m_nColumn;
+            }
+            return;
+        }
+
+        if (pData[2] == 'D' && Anchor())
+        {
+            if (m_nColumn > 0)
+            {
+                --m_nColumn;
+            }
+            return;
+        }
+    }
+
+    // Anything else (Enter, function keys, control codes) has an unknown
+    // effect on the host; wait for the outstanding echo before predicting again
+    m_bAnchored = FALSE;
+}
+
+void CTPredictiveEcho::BeginHostOutput(void)
+{
+    if (m_pRenderer == nullptr)
+    {
+        return;
+    }
+
+    // Overlays would be moved by scrolls; take them off before the host draws
+    for (unsigned i = 0; i < m_nCount; ++i)
+    {
+        TPrediction &prediction = m_Predictions[i];
+        if (prediction.shown)
+        {
+            m_pRenderer->RefreshCell(prediction.row, prediction.column);
+            prediction.shown = FALSE;
+        }
+    }
+}
+
+void CTPredictiveEcho::EndHostOutput(void)
+{
+    if (m_pRenderer == nullptr || m_nCount == 0)
+    {
+        return;
+    }
+
+    const u64 nowUs = CTimer::GetClockTicks64();
+    const unsigned cursorRow = m_pRenderer->GetCursorRow();
+    const unsigned cursorColumn = m_pRenderer->GetCursorColumn();
+    const unsigned columns = m_pRenderer->GetColumns();
+
+    unsigned kept = 0;
+    for (unsigned i = 0; i < m_nCount; ++i)
+    {
+        const TPrediction &prediction = m_Predictions[i];
+
+        // A matching cell alone proves nothing: it may hold the character from
+        // before (overtyping) or be written later. The host must have written
+        // the row since the key was sent and moved the cursor past the cell; in
+        // the last column the cursor stays on it with the wrap pending.
+        const boolean bPassed = cursorRow > prediction.row
+                                || (cursorRow == prediction.row && cursorColumn > prediction.column);
+        const boolean bLastColumn = prediction.column + 1 >= columns
+                                    && cursorRow == prediction.row && cursorColumn == prediction.column;
+        const boolean bWritten = m_pRenderer->GetCellRowGeneration(prediction.row) != prediction.rowGeneration;
+
+        CTCellBuffer::TCell cell;
+        const boolean bHaveCell = m_pRenderer->GetCell(prediction.row, prediction.column, cell);
+        if (bHaveCell && bWritten && (bPassed || bLastColumn) && cell.ch == static_cast<u8>(prediction.ch))
+        {
+            AddRttSample(nowUs - prediction.sentUs);
+            m_bConfident = TRUE;
+            ++m_nConfirmed;
+            continue;
+        }
+
+        // The host cursor moved past the cell without writing our character
+        if (!bHaveCell || bPassed || nowUs - prediction.sentUs > GetTimeoutUs())
+        {
+            Mispredict();
+            return;
+        }
+
+        m_Predictions[kept++] = prediction;
+    }
+
+    m_nCount = kept;
+    SyncOverlays();
+}
+
+void CTPredictiveEcho::Tick(void)
+{
+    if (m_nCount == 0)
+    {
+        return;
+    }
+
+    // Predictions are queued in send order, the oldest one expires first
+    const u64 nowUs = CTimer::GetClockTicks64();
+    if (nowUs - m_Predictions[0].sentUs > GetTimeoutUs())
+    {
+        Mispredict();
+    }
+}
+
+void CTPredictiveEcho::Reset(void)
+{
+    Rollback();
+    m_bConfident = FALSE;
+    m_bHighLatency = FALSE;
+    m_nSmoothedRttUs = 0;
+}
+
+unsigned CTPredictiveEcho::GetSmoothedRttMs(void) const
+{
+    return static_cast<unsigned>(m_nSmoothedRttUs / 1000);
+}
+
+boolean CTPredictiveEcho::Anchor(void)
+{
+    if (m_bAnchored)
+    {
+        return TRUE;
+    }
+
+    // With echo outstanding the host cursor does not tell where the next key lands
+    if (m_nCount != 0)
+    {
+        return FALSE;
+    }
+
+    m_nRow = m_pRenderer->GetCursorRow();
+    m_nColumn = m_pRenderer->GetCursorColumn();
+    m_bAnchored = TRUE;
+    return TRUE;
+}
+
+void CTPredictiveEcho::PredictChar(char chChar)
+{
+    if (!Anchor())
+    {
+        return;
+    }
+
+    // Wrapping depends on host and terminal modes; stop at the right margin
+    if (m_nColumn >= m_pRenderer->GetColumns() || m_nCount >= MaxPredictions)
+    {
+        m_bAnchored = FALSE;
+        return;
+    }
+
+    TPrediction &prediction = m_Predictions[m_nCount++];
+    prediction.row = m_nRow;
+    prediction.column = m_nColumn;
+    prediction.ch = chChar;
+    prediction.rowGeneration = m_pRenderer->GetCellRowGeneration(m_nRow);
+    prediction.sentUs = CTimer::GetClockTicks64();
+    prediction.shown = FALSE;
+    ++m_nColumn;
+
+    if (IsShowing())
+    {
+        m_pRenderer->DrawPredictedChar(prediction.row, prediction.column, chChar);
+        prediction.shown = TRUE;
+    }
+}
+
+void CTPredictiveEcho::PredictBackspace(void)
+{
+    if (!Anchor() || m_nColumn == 0)
+    {
+        return;
+    }
+
+    --m_nColumn;
+
+    if (m_nCount > 0)
+    {
+        const TPrediction &last = m_Predictions[m_nCount - 1];
+        if (last.row == m_nRow && last.column == m_nColumn)
+        {
+            if (last.shown)
+            {
+                m_pRenderer->RefreshCell(last.row, last.column);
+            }
+            --m_nCount;
+        }
+    }
+}
+
+boolean CTPredictiveEcho::IsShowing(void) const
+{
+    switch (m_nMode)
+    {
+    case ModeAlways:
+        return TRUE;
+
+    case ModeAdaptive:
+        return m_bConfident && m_bHighLatency;
+
+    default:
+        return FALSE;
+    }
+}
+
+void CTPredictiveEcho::SyncOverlays(void)
+{
+    if (m_pRenderer == nullptr)
+    {
+        return;
+    }
+
+    const boolean bShow = IsShowing();
+    for (unsigned i = 0; i < m_nCount; ++i)
+    {
+        TPrediction &prediction = m_Predictions[i];
+        if (bShow && !prediction.shown)
+        {
+            m_pRenderer->DrawPredictedChar(prediction.row, prediction.column, prediction.ch);
+            prediction.shown = TRUE;
+        }
+        else if (!bShow && prediction.shown)
+        {
+            m_pRenderer->RefreshCell(prediction.row, prediction.column);
+            prediction.shown = FALSE;
+        }
+    }
+}
+
+void CTPredictiveEcho::Mispredict(void)
+{
+    ++m_nMispredicted;
+    LOGDBG("Rolled back %u predictions (%u confirmed, %u mispredicted, RTT %u ms)",
+           m_nCount, m_nConfirmed, m_nMispredicted, GetSmoothedRttMs());
+
+    Rollback();
+}
+
+void CTPredictiveEcho::Rollback(void)
+{
+    for (unsigned i = 0; i < m_nCount; ++i)
+    {
+        const TPrediction &prediction = m_Predictions[i];
+        if (prediction.shown && m_pRenderer != nullptr)
+        {
+            m_pRenderer->RefreshCell(prediction.row, prediction.column);
+        }
+    }
+
+    m_nCount = 0;
+    m_bAnchored = FALSE;
+    m_bConfident = FALSE;
+}
+
+void CTPredictiveEcho::AddRttSample(u64 nSampleUs)
+{
+    // Same smoothing as TCP's SRTT (RFC 6298, alpha = 1/8)
+    if (m_nSmoothedRttUs == 0)
+    {
+        m_nSmoothedRttUs = nSampleUs;
+    }
+    else
+    {
+        m_nSmoothedRttUs = m_nSmoothedRttUs - m_nSmoothedRttUs / 8 + nSampleUs / 8;
+    }
+
+    const unsigned rttMs = GetSmoothedRttMs();
+    if (!m_bHighLatency && rttMs > ShowRttMs)
+    {
+        m_bHighLatency = TRUE;
+    }
+    else if (m_bHighLatency && rttMs < HideRttMs)
+    {
+        m_bHighLatency = FALSE;
+    }
+}
+
+u64 CTPredictiveEcho::GetTimeoutUs(void) const
+{
+    const u64 timeoutUs = m_nSmoothedRttUs * TimeoutRttFactor;
+    const u64 minimumUs = static_cast<u64>(TimeoutMinMs) * 1000;
+    return timeoutUs > minimumUs ? timeoutUs : minimumUs;
+}
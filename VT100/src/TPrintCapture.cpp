@@ -0,0 +1,329 @@
+//------------------------------------------------------------------------------
+// Module:        CTPrintCapture
+// Description:   Writes printer-controller data from the host to SD card files.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Jobs beyond the queue reopen and extend the last job
+//------------------------------------------------------------------------------
+
+#include "TPrintCapture.h"
+
+#include <circle/logger.h>
+#include <circle/sched/scheduler.h>
+#include <circle/string.h>
+#include <circle/timer.h>
+#include <circle/util.h>
+
+LOGMODULE("TPrintCapture");
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTPrintCapture *s_pThis = nullptr;
+CTPrintCapture *CTPrintCapture::Get(void)
+{
+    if (s_pThis == nullptr)
+    {
+        s_pThis = new CTPrintCapture();
+    }
+    return s_pThis;
+}
+
+CTPrintCapture::CTPrintCapture(void)
+    : CTask(),
+      m_nHead(0),
+      m_nJobsBegun(0),
+      m_nJobsEnded(0),
+      m_nJobsMerged(0),
+      m_nDroppedBytes(0),
+      m_nTail(0),
+      m_nJobsClosed(0),
+      m_bFileOpen(FALSE),
+      m_bJobFailed(FALSE),
+      m_bInitialized(FALSE),
+      m_nNextFileNumber(1),
+      m_nJobStartTail(0),
+      m_nJobDroppedStart(0),
+      m_nJobStartTicks(0),
+      m_nLastHead(0),
+      m_nLastDataTicks(0),
+      m_nMergedReported(0)
+{
+    SetName("PrintCapture");
+    Suspend();
+    m_FileName[0] = '\0';
+}
+
+CTPrintCapture::~CTPrintCapture(void)
+{
+    if (m_bFileOpen)
+    {
+        f_close(&m_File);
+        m_bFileOpen = FALSE;
+    }
+}
+
+boolean CTPrintCapture::Initialize(void)
+{
+    if (m_bInitialized)
+    {
+        return TRUE;
+    }
+
+    // Continue after the files of earlier sessions
+    FIL probe;
+    while (m_nNextFileNumber <= MaxFileNumber)
+    {
+        CString name;
+        name.Format("SD:/PRINT%03u.TXT", m_nNextFileNumber);
+        if (f_open(&probe, name, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+        {
+            break;
+        }
+        f_close(&probe);
+        ++m_nNextFileNumber;
+    }
+
+    if (m_nNextFileNumber > MaxFileNumber)
+    {
+        LOGWARN("PRINT001-%03u.TXT all exist, printer controller mode disabled", MaxFileNumber);
+        return FALSE;
+    }
+
+    m_bInitialized = TRUE;
+    Start();
+    LOGNOTE("Printer controller capture ready, next job SD:/PRINT%03u.TXT", m_nNextFileNumber);
+    return TRUE;
+}
+
+void CTPrintCapture::BeginJob(void)
+{
+    // Completed jobs still waiting for the writer are limited; beyond that the
+    // last job is reopened, so its end follows the head again until EndJob().
+    // The writer is at least MaxPendingJobs - 1 jobs behind and not on it.
+    if (m_nJobsBegun - m_nJobsClosed >= MaxPendingJobs)
+    {
+        if (m_nJobsEnded == m_nJobsBegun)
+        {
+            --m_nJobsEnded;
+        }
+        ++m_nJobsMerged;
+        return;
+    }
+
+    ++m_nJobsBegun;
+}
+
+void CTPrintCapture::Write(const char *pData, size_t nLength)
+{
+    const u32 nFree = RingSize - (m_nHead - m_nTail);
+    if (nLength > nFree)
+    {
+        m_nDroppedBytes += static_cast<u32>(nLength - nFree);
+        nLength = nFree;
+    }
+
+    const u32 nOffset = m_nHead % RingSize;
+    const size_t nFirst = (nLength < RingSize - nOffset) ? nLength : RingSize - nOffset;
+    memcpy(m_Ring + nOffset, pData, nFirst);
+    memcpy(m_Ring, pData + nFirst, nLength - nFirst);
+    m_nHead += static_cast<u32>(nLength);
+}
+
+void CTPrintCapture::EndJob(void)
+{
+    if (m_nJobsEnded == m_nJobsBegun)
+    {
+        return;
+    }
+
+    m_JobEnd[m_nJobsEnded % MaxPendingJobs] = m_nHead;
+    ++m_nJobsEnded;
+}
+
+boolean CTPrintCapture::IsIdle(void) const
+{
+    return m_nJobsClosed == m_nJobsBegun && m_nTail == m_nHead;
+}
+
+void CTPrintCapture::Run(void)
+{
+    while (!IsSuspended())
+    {
+        // Keep up with the host while a job runs, poll slowly otherwise
+        if (Service())
+        {
+            CScheduler::Get()->Yield();
+        }
+        else
+        {
+            CScheduler::Get()->MsSleep(m_bFileOpen ? BusySleepMs : IdleSleepMs);
+        }
+    }
+}
+
+boolean CTPrintCapture::Service(void)
+{
+    if (m_nJobsClosed == m_nJobsBegun)
+    {
+        return FALSE;
+    }
+
+    if (!m_bFileOpen && !m_bJobFailed && !OpenJobFile())
+    {
+        m_bJobFailed = TRUE;
+    }
+
+    const boolean bEndKnown = m_nJobsClosed != m_nJobsEnded;
+    const u32 nLimit = bEndKnown ? m_JobEnd[m_nJobsClosed % MaxPendingJobs] : m_nHead;
+    const unsigned nNow = CTimer::GetClockTicks();
+
+    if (m_bJobFailed)
+    {
+        m_nTail = nLimit;
+    }
+
+    // Every write ends on a sector boundary of the file, so FatFs can pass
+    // whole sectors to the card without its read-modify-write window
+    for (unsigned nPass = 0; nPass < MaxChunksPerPass && !m_bJobFailed; ++nPass)
+    {
+        const u32 nReady = nLimit - m_nTail;
+        u32 nChunk = nReady < WriteChunk ? nReady : WriteChunk;
+        const u32 nCut = ((m_nTail - m_nJobStartTail) + nChunk) % SectorSize;
+        if (nChunk <= nCut)
+        {
+            break;
+        }
+        nChunk -= nCut;
+        if (!WriteOut(nChunk))
+        {
+            m_bJobFailed = TRUE;
+        }
+    }
+
+    if (m_nHead != m_nLastHead)
+    {
+        m_nLastHead = m_nHead;
+        m_nLastDataTicks = nNow;
+    }
+
+    const u32 nRest = nLimit - m_nTail;
+    if (bEndKnown && nRest < SectorSize)
+    {
+        if (nRest > 0 && !m_bJobFailed)
+        {
+            WriteOut(nRest);
+        }
+        m_nTail = nLimit;
+        CloseJobFile();
+        return m_nJobsClosed != m_nJobsBegun;
+    }
+
+    // A host that stops without CSI 4 i still gets its data onto the card
+    if (!bEndKnown && nRest > 0 && nRest < SectorSize && m_bFileOpen && !m_bJobFailed
+        && nNow - m_nLastDataTicks >= IdleFlushMs * 1000U)
+    {
+        if (WriteOut(nRest))
+        {
+            f_sync(&m_File);
+        }
+        else
+        {
+            m_bJobFailed = TRUE;
+        }
+    }
+
+    return !m_bJobFailed && nLimit - m_nTail >= SectorSize;
+}
+
+boolean CTPrintCapture::OpenJobFile(void)
+{
+    m_nJobStartTail = m_nTail;
+    m_nJobDroppedStart = m_nDroppedBytes;
+    m_nJobStartTicks = CTimer::GetClockTicks();
+
+    // Skip names created since Initialize() (e.g. copied onto the card via USB)
+    FIL probe;
+    while (m_nNextFileNumber <= MaxFileNumber)
+    {
+        CString name;
+        name.Format("SD:/PRINT%03u.TXT", m_nNextFileNumber++);
+        if (f_open(&probe, name, FA_READ | FA_OPEN_EXISTING) == FR_OK)
+        {
+            f_close(&probe);
+            continue;
+        }
+
+        FRESULT result = f_open(&m_File, name, FA_WRITE | FA_CREATE_ALWAYS);
+        if (result != FR_OK)
+        {
+            LOGERR("Cannot create %s (err=%d), job discarded", (const char *)name, (int)result);
+            return FALSE;
+        }
+        strncpy(m_FileName, name, sizeof(m_FileName) - 1);
+        m_FileName[sizeof(m_FileName) - 1] = '\0';
+        m_bFileOpen = TRUE;
+        return TRUE;
+    }
+
+    LOGERR("No free print file name, job discarded");
+    return FALSE;
+}
+
+void CTPrintCapture::CloseJobFile(void)
+{
+    const u32 nBytes = m_nTail - m_nJobStartTail;
+    const u32 nDropped = m_nDroppedBytes - m_nJobDroppedStart;
+    const unsigned nMs = (CTimer::GetClockTicks() - m_nJobStartTicks) / 1000U;
+
+    if (m_bFileOpen)
+    {
+        f_close(&m_File);
+        m_bFileOpen = FALSE;
+    }
+
+    if (m_bJobFailed)
+    {
+        LOGERR("Print job %s failed, %u bytes discarded", m_FileName, nBytes);
+    }
+    else
+    {
+        LOGNOTE("Print job %s: %u bytes in %u ms (%u KB/s), %u bytes dropped",
+                m_FileName, nBytes, nMs, nMs > 0 ? nBytes / nMs : 0U, nDropped);
+    }
+
+    // Merges are counted under the renderer lock, where no logging is allowed
+    const unsigned nMerged = m_nJobsMerged;
+    if (nMerged != m_nMergedReported)
+    {
+        LOGWARN("%u print jobs appended to the previous file, %u jobs were waiting",
+                nMerged - m_nMergedReported, MaxPendingJobs);
+        m_nMergedReported = nMerged;
+    }
+
+    m_bJobFailed = FALSE;
+    ++m_nJobsClosed;
+}
+
+boolean CTPrintCapture::WriteOut(unsigned nLength)
+{
+    const u32 nOffset = m_nTail % RingSize;
+    const unsigned nFirst = (nLength < RingSize - nOffset) ? nLength : RingSize - nOffset;
+    memcpy(m_Staging, m_Ring + nOffset, nFirst);
+    memcpy(m_Staging + nFirst, m_Ring, nLength - nFirst);
+
+    UINT nWritten = 0;
+    FRESULT result = f_write(&m_File, m_Staging, nLength, &nWritten);
+    if (result != FR_OK || nWritten != nLength)
+    {
+        LOGERR("SD write to %s failed (err=%d), rest of the job discarded", m_FileName, (int)result);
+        return FALSE;
+    }
+
+    m_nTail += nLength;
+    return TRUE;
+}
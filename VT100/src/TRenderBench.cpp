@@ -0,0 +1,371 @@
+//------------------------------------------------------------------------------
+// Module:        CTRenderBench
+// Description:   Cycle counter microbenchmarks of the renderer drawing primitives.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Forget blank framebuffer lines after the SetArea cases
+// 2026-10-18     R. Zuehlsdorff        Burst blit cases through PresentLines()
+//------------------------------------------------------------------------------
+
+#include "TRenderBench.h"
+
+#include <circle/logger.h>
+#include <circle/timer.h>
+
+#include "TRenderer.h"
+#include "cyclecounter.h"
+
+LOGMODULE("TRenderBench");
+
+namespace
+{
+    struct TBenchFont
+    {
+        EFontSelection selection;
+        CCharGenerator::TFontFlags flags;
+        const char *pName;
+    };
+
+    const TBenchFont s_Fonts[] = {
+        {EFontSelection::VT100Font8x20, CCharGenerator::FontFlagsNone, "8x20"},
+        {EFontSelection::VT100Font10x20, CCharGenerator::FontFlagsNone, "10x20"},
+        {EFontSelection::VT100Font10x20Solid, CCharGenerator::FontFlagsNone, "10x20s"},
+        {EFontSelection::VT100Font10x20, CCharGenerator::FontFlagsDoubleBoth, "10x20dd"},
+    };
+
+    constexpr unsigned FontCount = sizeof(s_Fonts) / sizeof(s_Fonts[0]);
+}
+
+boolean CTRenderBench::Run(CTRenderer *pRenderer)
+{
+    if (pRenderer == nullptr || pRenderer->m_pCharGen == nullptr)
+    {
+        LOGWARN("Renderer not ready, benchmark skipped");
+        return FALSE;
+    }
+    CTRenderer &rRenderer = *pRenderer;
+
+    CycleCounterEnable();
+    const unsigned nMHz = CalibrateMHz();
+
+    const EFontSelection savedSelection = rRenderer.m_CurrentFontSelection;
+    const CCharGenerator::TFontFlags savedFlags = rRenderer.m_FontFlags;
+    const boolean bCursorShown = rRenderer.m_bCursorVisible;
+
+    TResult results[FontCount][PrimCount] = {};
+    boolean fontDone[FontCount] = {};
+
+    for (unsigned nFont = 0; nFont < FontCount; ++nFont)
+    {
+        if (!rRenderer.SetFont(s_Fonts[nFont].selection, s_Fonts[nFont].flags))
+        {
+            continue;
+        }
+
+        rRenderer.m_SpinLock.Acquire();
+
+        // InvertCursor() is timed in pairs starting from a hidden cursor
+        if (rRenderer.m_bCursorVisible)
+        {
+            rRenderer.InvertCursor();
+        }
+
+        // Pin the governor to instant pixel moves so Scroll() does what it does under load
+        const boolean bSmooth = rRenderer.m_bSmoothScrollEnabled;
+        const boolean bCursorOn = rRenderer.m_bCursorOn;
+        const unsigned long long normalTicks = rRenderer.m_ScrollNormalTicksAccum;
+        const unsigned normalCount = rRenderer.m_ScrollNormalCount;
+        rRenderer.m_bSmoothScrollEnabled = FALSE;
+        rRenderer.m_bCursorOn = TRUE;
+        rRenderer.m_nScrollStart = 0;
+        rRenderer.m_nScrollEnd = rRenderer.m_nUsedHeight;
+
+        for (unsigned nPrimitive = 0; nPrimitive < PrimCount; ++nPrimitive)
+        {
+            rRenderer.m_ScrollMode = CTRenderer::ScrollModeInstant;
+            rRenderer.m_nScrollCalmSince = rRenderer.m_nLastWriteTicks;
+            rRenderer.m_nIngestBacklog = 0;
+            rRenderer.m_nInputRate = 0;
+            results[nFont][nPrimitive] = Measure(rRenderer, static_cast<TPrimitive>(nPrimitive));
+        }
+
+        rRenderer.m_bSmoothScrollEnabled = bSmooth;
+        rRenderer.m_bCursorOn = bCursorOn;
+        rRenderer.m_ScrollNormalTicksAccum = normalTicks;
+        rRenderer.m_ScrollNormalCount = normalCount;
+        fontDone[nFont] = TRUE;
+
+        rRenderer.m_SpinLock.Release();
+    }
+
+    // Leave a clean screen in the font the user configured
+    rRenderer.SetFont(savedSelection, savedFlags);
+    rRenderer.m_SpinLock.Acquire();
+    // The SetArea and Blit cases copied stale shadow lines over lines presented as blank
+    rRenderer.ForgetShownLines(0, rRenderer.m_nHeight - 1);
+    rRenderer.m_nScrollStart = 0;
+    rRenderer.m_nScrollEnd = rRenderer.m_nUsedHeight;
+    rRenderer.ClearDisplay();
+    if (bCursorShown && !rRenderer.m_bCursorVisible)
+    {
+        rRenderer.InvertCursor();
+    }
+    rRenderer.FlushUpdateArea();
+    rRenderer.m_SpinLock.Release();
+
+    LOGNOTE("Render bench: %ux%u, %u bpp%s, cycle counter %u MHz, fastest of %u batches",
+            rRenderer.m_nWidth, rRenderer.m_nHeight, rRenderer.m_nDepth,
+            rRenderer.m_bDirectRender ? " (direct)" : "", nMHz, Repeats);
+
+    for (unsigned nFont = 0; nFont < FontCount; ++nFont)
+    {
+        if (!fontDone[nFont])
+        {
+            LOGWARN("Render bench: font %s not available", s_Fonts[nFont].pName);
+            continue;
+        }
+
+        for (unsigned nPrimitive = 0; nPrimitive < PrimCount; ++nPrimitive)
+        {
+            const TResult &rResult = results[nFont][nPrimitive];
+            if (rResult.nCalls == 0)
+            {
+                LOGNOTE("%-7s %-18s n/a", s_Fonts[nFont].pName, GetName(static_cast<TPrimitive>(nPrimitive)));
+                continue;
+            }
+
+            // Hundredths, without floating point in the log path
+            const u64 perCall = static_cast<u64>(rResult.nCycles) * 100U / rResult.nCalls;
+            const u64 perPixel = rResult.nPixels ? perCall / rResult.nPixels : 0;
+            const u64 nsPerCall = nMHz ? perCall * 10U / nMHz : 0;
+            LOGNOTE("%-7s %-18s %9u.%02u cyc/call %6u.%02u cyc/px %9u ns/call (%u px)",
+                    s_Fonts[nFont].pName, GetName(static_cast<TPrimitive>(nPrimitive)),
+                    static_cast<unsigned>(perCall / 100), static_cast<unsigned>(perCall % 100),
+                    static_cast<unsigned>(perPixel / 100), static_cast<unsigned>(perPixel % 100),
+                    static_cast<unsigned>(nsPerCall), rResult.nPixels);
+        }
+    }
+
+    return TRUE;
+}
+
+CTRenderBench::TResult CTRenderBench::Measure(CTRenderer &rRenderer, TPrimitive Primitive)
+{
+    TResult result;
+    result.nCycles = 0;
+    result.nCalls = GetCalls(Primitive);
+    result.nPixels = GetPixels(rRenderer, Primitive);
+
+    // SetArea() is not used in direct mode
+    if (rRenderer.m_bDirectRender && (Primitive == PrimSetAreaRow || Primitive == PrimSetAreaScreen))
+    {
+        result.nCalls = 0;
+        return result;
+    }
+
+    // The blit needs an addressable framebuffer, and stored lines to copy
+    const boolean bBlit = Primitive == PrimBlitCell || Primitive == PrimBlitRow || Primitive == PrimBlitScreen;
+    if (bBlit && rRenderer.m_pFramePixels == nullptr)
+    {
+        result.nCalls = 0;
+        return result;
+    }
+    if (bBlit)
+    {
+        rRenderer.MaterialiseLines(0, rRenderer.m_nHeight - 1);
+    }
+
+    rRenderer.m_bBoldAttribute = Primitive == PrimDisplayCharBold ? TRUE : FALSE;
+    rRenderer.m_bUnderlineAttribute = Primitive == PrimDisplayCharUnderline ? TRUE : FALSE;
+
+    // The first batch also loads caches and atlases; only the fastest one counts
+    Call(rRenderer, Primitive, result.nCalls);
+    result.nCycles = 0xFFFFFFFFU;
+    for (unsigned nRepeat = 0; nRepeat < Repeats; ++nRepeat)
+    {
+        const u32 nStart = CycleCounterRead();
+        Call(rRenderer, Primitive, result.nCalls);
+        const u32 nElapsed = CycleCounterRead() - nStart;
+        if (nElapsed < result.nCycles)
+        {
+            result.nCycles = nElapsed;
+        }
+    }
+
+    rRenderer.m_bBoldAttribute = FALSE;
+    rRenderer.m_bUnderlineAttribute = FALSE;
+    return result;
+}
+
+void CTRenderBench::Call(CTRenderer &rRenderer, TPrimitive Primitive, unsigned nCalls)
+{
+    const unsigned nCharWidth = rRenderer.m_pCharGen->GetCharWidth();
+    const unsigned nCharHeight = rRenderer.m_pCharGen->GetCharHeight();
+    const unsigned nColumns = rRenderer.m_nWidth / nCharWidth;
+    const unsigned nRows = rRenderer.m_nUsedHeight / nCharHeight;
+
+    CDisplay::TArea area;
+    area.x1 = 0;
+    area.x2 = rRenderer.m_nWidth - 1;
+    area.y1 = 0;
+    area.y2 = (Primitive == PrimSetAreaRow ? nCharHeight : rRenderer.m_nHeight) - 1;
+
+    for (unsigned i = 0; i < nCalls; ++i)
+    {
+        // Walk over the screen so the glyph stores do not hit the same cache lines
+        const unsigned nPosX = (i % nColumns) * nCharWidth;
+        const unsigned nPosY = ((i / nColumns) % nRows) * nCharHeight;
+
+        switch (Primitive)
+        {
+        case PrimDisplayChar:
+        case PrimDisplayCharBold:
+        case PrimDisplayCharUnderline:
+            rRenderer.DisplayChar(static_cast<char>('A' + i % 26), nPosX, nPosY, rRenderer.m_ForegroundColor);
+            break;
+
+        case PrimEraseChar:
+            rRenderer.EraseChar(nPosX, nPosY);
+            break;
+
+        case PrimInvertCursor:
+            rRenderer.InvertCursor();
+            break;
+
+        case PrimScroll:
+            rRenderer.Scroll();
+            break;
+
+        case PrimDeleteLines:
+            rRenderer.m_nCursorY = 0;
+            rRenderer.DeleteLines(1);
+            break;
+
+        case PrimInsertLines:
+            rRenderer.m_nCursorY = 0;
+            rRenderer.InsertLines(1);
+            break;
+
+        case PrimClearDisplayEnd:
+            rRenderer.m_nCursorX = 0;
+            rRenderer.m_nCursorY = 0;
+            rRenderer.ClearDisplayEnd();
+            break;
+
+        case PrimSetAreaRow:
+        case PrimSetAreaScreen:
+            rRenderer.m_pFrameBuffer->SetArea(area, rRenderer.m_pBuffer8);
+            break;
+
+        case PrimBlitCell:
+            rRenderer.PresentLines(nPosY, nPosY + nCharHeight - 1, nPosX, nPosX + nCharWidth - 1);
+            break;
+
+        case PrimBlitRow:
+            rRenderer.PresentLines(0, nCharHeight - 1, 0, rRenderer.m_nWidth - 1);
+            break;
+
+        case PrimBlitScreen:
+            rRenderer.PresentLines(0, rRenderer.m_nHeight - 1, 0, rRenderer.m_nWidth - 1);
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+unsigned CTRenderBench::GetCalls(TPrimitive Primitive)
+{
+    switch (Primitive)
+    {
+    case PrimDisplayChar:
+    case PrimDisplayCharBold:
+    case PrimDisplayCharUnderline:
+    case PrimEraseChar:
+    case PrimInvertCursor:
+    case PrimBlitCell:
+        return 2000;    // even, so the cursor ends hidden
+
+    case PrimSetAreaRow:
+    case PrimBlitRow:
+        return 64;
+
+    case PrimScroll:
+    case PrimDeleteLines:
+    case PrimInsertLines:
+        return 16;
+
+    default:
+        return 8;
+    }
+}
+
+unsigned CTRenderBench::GetPixels(const CTRenderer &rRenderer, TPrimitive Primitive)
+{
+    const unsigned nCharWidth = rRenderer.m_pCharGen->GetCharWidth();
+    const unsigned nCharHeight = rRenderer.m_pCharGen->GetCharHeight();
+
+    switch (Primitive)
+    {
+    case PrimInvertCursor:
+        return nCharWidth * (rRenderer.m_bCursorBlock ? nCharHeight : nCharHeight - rRenderer.m_pCharGen->GetUnderline());
+
+    case PrimScroll:
+    case PrimDeleteLines:
+    case PrimInsertLines:
+        return rRenderer.m_nWidth * (rRenderer.m_nScrollEnd - rRenderer.m_nScrollStart);
+
+    case PrimClearDisplayEnd:
+    case PrimSetAreaScreen:
+    case PrimBlitScreen:
+        return rRenderer.m_nWidth * rRenderer.m_nHeight;
+
+    case PrimSetAreaRow:
+    case PrimBlitRow:
+        return rRenderer.m_nWidth * nCharHeight;
+
+    default:
+        return nCharWidth * nCharHeight;
+    }
+}
+
+unsigned CTRenderBench::CalibrateMHz(void)
+{
+    const unsigned nStartUs = CTimer::GetClockTicks();
+    const u32 nStartCycles = CycleCounterRead();
+    unsigned nElapsedUs;
+    do
+    {
+        nElapsedUs = CTimer::GetClockTicks() - nStartUs;
+    } while (nElapsedUs < CalibrationMs * 1000U);
+    const u32 nCycles = CycleCounterRead() - nStartCycles;
+
+    return (nCycles + nElapsedUs / 2) / nElapsedUs;
+}
+
+const char *CTRenderBench::GetName(TPrimitive Primitive)
+{
+    static const char *const s_Names[PrimCount] = {
+        "DisplayChar",
+        "DisplayChar bold",
+        "DisplayChar underl",
+        "EraseChar",
+        "InvertCursor",
+        "Scroll",
+        "DeleteLines(1)",
+        "InsertLines(1)",
+        "ClearDisplayEnd",
+        "SetArea row",
+        "SetArea screen",
+        "Blit cell",
+        "Blit row",
+        "Blit screen",
+    };
+
+    return Primitive < PrimCount ? s_Names[Primitive] : "?";
+}
@@ -7,6 +7,25 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Mirror drawing into the cell grid, warm resume
+// 2026-10-18     R. Zuehlsdorff        DECRQCRA rectangle checksums from the cell grid
+// 2026-10-18     R. Zuehlsdorff        Virtual consoles parsed without rasterising
+// 2026-10-18     R. Zuehlsdorff        Sixel graphics decoded into the shadow buffer
+// 2026-10-18     R. Zuehlsdorff        Glyphs drawn from pre-shaded CRT atlases
+// 2026-10-18     R. Zuehlsdorff        Hot/cold code placement for the byte path
+// 2026-10-18     R. Zuehlsdorff        Direct-to-framebuffer rendering mode
+// 2026-10-18     R. Zuehlsdorff        Adaptive scroll governor with coalesced jump scroll
+// 2026-10-18     R. Zuehlsdorff        DECCKM/DECKPAM modes reported to the keyboard
+// 2026-10-18     R. Zuehlsdorff        Printer controller mode (CSI 5 i / CSI 4 i)
+// 2026-10-18     R. Zuehlsdorff        Copy-on-write blank pixel lines, filled in place when presented
+// 2026-10-18     R. Zuehlsdorff        Dirty column spans presented with a burst blit
+// 2026-10-18     R. Zuehlsdorff        Task loop counter for the stall watchdog
+// 2026-10-18     R. Zuehlsdorff        Throughput counters for the performance HUD
+// 2026-10-18     R. Zuehlsdorff        Generated glyph atlases, blank glyph lines without lookups
+// 2026-10-18     R. Zuehlsdorff        Printable span front end with SWAR scanning
+// 2026-10-18     R. Zuehlsdorff        Versioned terminal state snapshots replace screen buffer copies
+// 2026-10-18     R. Zuehlsdorff        Scrolls repair rows that received log pane overlay pixels
+// 2026-10-18     R. Zuehlsdorff        Snapshots only mark the screen for the next update
 //------------------------------------------------------------------------------
 
 // Include class header
@@ -22,12 +41,15 @@
 #include <circle/sysconfig.h>
 #include <circle/timer.h>
 #include <circle/util.h>
+#include <circle/string.h>
 #include <string.h>
 
 // Include application components
 #include "TFontConverter.h"
+#include "TBlit.h"
 #include "TConfig.h"
 #include "hal.h"
+#include "hotpath.h"
 
 LOGMODULE("TRenderer");
 
@@ -36,6 +58,14 @@ LOGMODULE("TRenderer");
 // default screen device name prefix
 static const char DevicePrefix[] = "tty";
 
+template <typename T>
+static inline void ExchangeValue(T &rLeft, T &rRight)
+{
+    T temp = rLeft;
+    rLeft = rRight;
+    rRight = temp;
+}
+
 // Singleton instance creation and access
 // teardown handled by runtime
 // CAUTION: Only possible if constructor does not need parameters
@@ -51,6 +81,7 @@ CTRenderer *CTRenderer::Get(void)
 
 CTRenderer::CTRenderer(void)
     : m_pFont(nullptr),
+      m_pGraphicsFont(nullptr),
       m_FontFlags(CCharGenerator::FontFlagsNone),
       m_pCharGen(nullptr),
       m_pGraphicsCharGen(nullptr),
@@ -59,6 +90,20 @@ CTRenderer::CTRenderer(void)
       m_G1CharSet(CharSetGraphics),
       m_bUseG1(FALSE),
       m_pCursorPixels(nullptr),
+      m_bDirectRender(FALSE),
+      m_pCellRowCache(nullptr),
+      m_bBlankLines(FALSE),
+      m_pFramePixels(nullptr),
+      m_nFramePitch(0),
+      m_nInPlaceCount(0),
+      m_nLoopCount(0),
+      m_nPerfBytes(0),
+      m_nPerfBusyUs(0),
+      m_nPerfBlits(0),
+      m_pBlankLines(nullptr),
+      m_pShownLines(nullptr),
+      m_nGraphicsY1(1),
+      m_nGraphicsY2(0),
       m_pBuffer8(nullptr),
       m_pFrameBuffer(nullptr),
       m_nDisplayIndex(0),
@@ -95,6 +140,20 @@ CTRenderer::CTRenderer(void)
       m_bBlinkAttribute(FALSE),
       m_bInsertOn(FALSE),
     m_bVT52Mode(FALSE),
+      m_nParam1(0),
+      m_nParam2(0),
+      m_nParamCount(0),
+      m_bCursorKeyApplication(FALSE),
+      m_bKeypadApplication(FALSE),
+      m_pReplyHandler(nullptr),
+      m_pKeyModeHandler(nullptr),
+      m_nReportedKeyModes(0),
+      m_pPrintHandler(nullptr),
+      m_bPrinterController(FALSE),
+      m_nPrinterMatch(0),
+      m_bPrintJobOpen(FALSE),
+      m_bPrintableSpans(TRUE),
+      m_nReplyLength(0),
       m_bAutoPage(FALSE),
       m_bDelayedUpdate(FALSE),
     m_bSmoothScrollEnabled(TRUE),
@@ -110,12 +169,42 @@ CTRenderer::CTRenderer(void)
     m_pSmoothScrollCompose(nullptr),
         m_nSmoothScrollBufferSize(0),
         m_nSmoothScrollStartTick(0),
-                m_nSmoothScrollDebounceUntil(0),
         m_nScrollStatsLastLogTick(0),
         m_ScrollNormalTicksAccum(0),
         m_ScrollSmoothTicksAccum(0),
         m_ScrollNormalCount(0),
         m_ScrollSmoothCount(0),
+        m_ScrollMode(ScrollModeInstant),
+        m_nScrollModeSince(0),
+        m_nScrollCalmSince(0),
+        m_nIngestBacklogHint(0),
+        m_nIngestBacklog(0),
+        m_nRateWindowStart(0),
+        m_nRateWindowBytes(0),
+        m_nRateWindowScrolls(0),
+        m_nInputRate(0),
+        m_nScrollRate(0),
+        m_bJumpPending(FALSE),
+        m_nJumpTopRow(0),
+        m_nJumpEndRow(0),
+        m_nJumpLines(0),
+        m_nJumpColumns(0),
+        m_nJumpRows(0),
+        m_pJumpShown(nullptr),
+        m_nJumpShownSize(0),
+        m_ScrollModeDecisions(),
+        m_ScrollModeTicks(),
+        m_nScrollModeChanges(0),
+        m_nJumpResolves(0),
+        m_nJumpResolvedLines(0),
+      m_nLastWriteTicks(0),
+      m_bOverlayCursorVisible(FALSE),
+      m_OverlayAttributes(0),
+      m_nOverlayTopRow(0),
+      m_nOverlayEndRow(0),
+      m_nActiveConsole(0),
+      m_bRasterise(TRUE),
+      m_pSixel(&m_SixelDecoders[0]),
       // Initialize spinlock with TASK_LEVEL so acquiring it does NOT disable interrupts.
       // This is crucial to prevent UART FIFO overflows during heavy render ops.
       m_SpinLock(TASK_LEVEL)
@@ -123,6 +212,29 @@ CTRenderer::CTRenderer(void)
     // Initialize saved state with safe defaults
     memset(&m_SavedState, 0, sizeof(m_SavedState));
 
+    // Parked consoles start blank; FitConsoleGeometry() sizes them on first use
+    for (unsigned i = 0; i < MaxConsoles; ++i)
+    {
+        ResetConsoleState(m_Consoles[i], 0);
+        m_Consoles[i].sixel = &m_SixelDecoders[i];
+    }
+
+    m_Snapshot.id = 0;
+    ResetConsoleState(m_Snapshot.console, 0);
+    m_Snapshot.console.sixel = &m_SnapshotSixel;
+    m_Snapshot.pixels = nullptr;
+    m_Snapshot.blankLines = nullptr;
+    m_nSnapshotSerial = 0;
+
+    memset(m_GlyphAtlases, 0, sizeof(m_GlyphAtlases));
+    m_nNextGlyphAtlasSlot = 0;
+    memset(&m_CrtEffects, 0, sizeof(m_CrtEffects));
+    m_pGlyphAtlas = nullptr;
+    m_pGraphicsGlyphAtlas = nullptr;
+    m_nShadeRampForeground = 0;
+    m_nShadeRampBackground = 0;
+    m_bShadeRampValid = FALSE;
+
     SetName("Renderer");
     Suspend();
 }
@@ -131,12 +243,33 @@ CTRenderer::~CTRenderer(void)
 {
     CDeviceNameService::Get()->RemoveDevice(DevicePrefix, m_nDisplayIndex + 1, FALSE);
 
-    delete[] m_pBuffer8;
+    if (!m_bDirectRender)
+    {
+        delete[] m_pBuffer8;
+    }
     m_pBuffer8 = nullptr;
 
     delete[] m_pCursorPixels;
     m_pCursorPixels = nullptr;
 
+    delete[] m_pCellRowCache;
+    m_pCellRowCache = nullptr;
+
+    delete[] m_pBlankLines;
+    m_pBlankLines = nullptr;
+
+    delete[] m_pShownLines;
+    m_pShownLines = nullptr;
+
+    delete[] m_Snapshot.pixels;
+    m_Snapshot.pixels = nullptr;
+
+    delete[] m_Snapshot.blankLines;
+    m_Snapshot.blankLines = nullptr;
+
+    delete[] m_pJumpShown;
+    m_pJumpShown = nullptr;
+
     delete[] m_pSmoothScrollSnapshot;
     m_pSmoothScrollSnapshot = nullptr;
 
@@ -149,11 +282,13 @@ CTRenderer::~CTRenderer(void)
     delete m_pGraphicsCharGen;
     m_pGraphicsCharGen = nullptr;
 
+    FreeGlyphAtlases();
+
     delete m_pFrameBuffer;
     m_pFrameBuffer = nullptr;
 }
 
-boolean CTRenderer::Initialize(void)
+VT100_COLD boolean CTRenderer::Initialize(void)
 {
     m_pFrameBuffer = new CBcmFrameBuffer(0, 0, DEPTH, 0, 0, m_nDisplayIndex);
     if (!m_pFrameBuffer)
@@ -177,24 +312,67 @@ boolean CTRenderer::Initialize(void)
         return FALSE;
     }
 
-    m_pBuffer8 = new u8[m_nSize];
-    if (!m_pBuffer8)
+    // Direct mode draws into the framebuffer with the shadow buffer's addressing,
+    // so it needs a framebuffer without padding at the end of the pixel lines
+    CTConfig *config = CTConfig::Get();
+    if (config != nullptr && config->GetDirectRenderEnabled())
     {
-        return FALSE;
+        if (m_pFrameBuffer->GetPitch() == m_nPitch && m_pFrameBuffer->GetBuffer())
+        {
+            m_bDirectRender = TRUE;
+        }
+        else
+        {
+            LOGWARN("Direct render needs an unpadded framebuffer (pitch %u), using shadow buffer",
+                    m_pFrameBuffer->GetPitch());
+        }
     }
 
-    m_nSmoothScrollBufferSize = m_nSize;
-    m_pSmoothScrollSnapshot = new u8[m_nSmoothScrollBufferSize];
-    if (!m_pSmoothScrollSnapshot)
+    if (m_bDirectRender)
     {
-        return FALSE;
+        // No shadow and no smooth scroll snapshots: BeginSmoothScrollAnimation() declines
+        m_pBuffer8 = reinterpret_cast<u8 *>(m_pFrameBuffer->GetBuffer());
+        m_bSmoothScrollEnabled = FALSE;
+        LOGNOTE("Rendering directly into the framebuffer");
+    }
+    else
+    {
+        m_pBuffer8 = new u8[m_nSize];
+        if (!m_pBuffer8)
+        {
+            return FALSE;
+        }
+
+        m_nSmoothScrollBufferSize = m_nSize;
+        m_pSmoothScrollSnapshot = new u8[m_nSmoothScrollBufferSize];
+        if (!m_pSmoothScrollSnapshot)
+        {
+            return FALSE;
+        }
+
+        m_pSmoothScrollCompose = new u8[m_nSmoothScrollBufferSize];
+        if (!m_pSmoothScrollCompose)
+        {
+            return FALSE;
+        }
     }
 
-    m_pSmoothScrollCompose = new u8[m_nSmoothScrollBufferSize];
-    if (!m_pSmoothScrollCompose)
+    // Clears only record the color of blank lines; presenting them fills the
+    // framebuffer in place, so it must be addressable. Direct mode fills at once.
+    m_pBlankLines = new TBlankLine[m_nHeight];
+    m_pShownLines = new TBlankLine[m_nHeight];
+    if (!m_pBlankLines || !m_pShownLines)
     {
         return FALSE;
     }
+    memset(m_pBlankLines, 0, m_nHeight * sizeof(TBlankLine));
+    memset(m_pShownLines, 0, m_nHeight * sizeof(TBlankLine));
+    if (!m_bDirectRender && m_pFrameBuffer->GetBuffer() != 0)
+    {
+        m_pFramePixels = reinterpret_cast<u8 *>(m_pFrameBuffer->GetBuffer());
+        m_nFramePitch = m_pFrameBuffer->GetPitch();
+    }
+    m_bBlankLines = m_pFramePixels != nullptr;
 
     if (!SetFont(EFontSelection::VT100Font10x20, m_FontFlags))
     {
@@ -216,10 +394,7 @@ boolean CTRenderer::Initialize(void)
     m_UpdateArea.x2 = m_nWidth - 1;
     m_UpdateArea.y1 = 0;
     m_UpdateArea.y2 = m_nHeight - 1;
-    m_pFrameBuffer->SetArea(m_UpdateArea, m_pBuffer8);
-
-    m_UpdateArea.y1 = m_nHeight;
-    m_UpdateArea.y2 = 0;
+    FlushUpdateArea();
 
     if (!CDeviceNameService::Get()->GetDevice(DevicePrefix, m_nDisplayIndex + 1, FALSE))
     {
@@ -229,11 +404,16 @@ boolean CTRenderer::Initialize(void)
     LOGNOTE("Renderer initialized");
 
     m_nScrollStatsLastLogTick = CTimer::Get()->GetTicks();
+    m_nScrollModeSince = m_nScrollStatsLastLogTick;
 
     // Set initial font and colors from config (if available)
-    CTConfig *config = CTConfig::Get();
     if (config != nullptr)
     {
+        TCrtEffects effects;
+        effects.scanlines = config->GetCrtScanlines();
+        effects.bloom = config->GetCrtBloom();
+        effects.glow = config->GetCrtGlowForTextColor();
+        SetCrtEffects(effects);
         SetFont(config->GetFontSelection(), CCharGenerator::FontFlagsNone);
         TRendererColor fg = MapColor(config->GetTextColor());
         TRendererColor bg = MapColor(config->GetBackgroundColor());
@@ -246,14 +426,14 @@ boolean CTRenderer::Initialize(void)
     return TRUE;
 }
 
-bool CTRenderer::SetFont(EFontSelection selection, CCharGenerator::TFontFlags FontFlags)
+VT100_COLD bool CTRenderer::SetFont(EFontSelection selection, CCharGenerator::TFontFlags FontFlags)
 {
     m_CurrentFontSelection = selection;
     const TFont &font = CTFontConverter::Get()->GetFont(selection);
     return SetFont(font, FontFlags);
 }
 
-bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlags)
+VT100_COLD bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlags)
 {
     m_SpinLock.Acquire();
 
@@ -283,6 +463,12 @@ bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlag
         InvertCursor();
     }
 
+    // Blank lines are kept per character row of the old font
+    if (m_pCharGen)
+    {
+        MaterialiseLines(0, m_nHeight - 1);
+    }
+
     delete m_pCharGen;
     m_pCharGen = nullptr;
 
@@ -321,6 +507,10 @@ bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlag
 
     const TFont &gfxFont = CTFontConverter::Get()->GetFont(gfxSelection);
     m_pGraphicsCharGen = new CCharGenerator(gfxFont, FontFlags);
+    m_pGraphicsFont = &gfxFont;
+
+    m_pGlyphAtlas = GetGlyphAtlas(rFont, FontFlags);
+    m_pGraphicsGlyphAtlas = GetGlyphAtlas(gfxFont, FontFlags);
 
     delete[] m_pCursorPixels;
     m_pCursorPixels = nullptr;
@@ -345,6 +535,14 @@ bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlag
         m_pCursorPixels[i] = 0;
     }
 
+    if (m_bDirectRender)
+    {
+        // Cursor cells are composed here, never read back from the framebuffer;
+        // without it InvertCursor() falls back to framebuffer reads
+        delete[] m_pCellRowCache;
+        m_pCellRowCache = new u8[m_nPitch * m_pCharGen->GetCharHeight()];
+    }
+
     m_pFont = &rFont;
     m_FontFlags = FontFlags;
 
@@ -354,6 +552,10 @@ bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlag
 
     const unsigned newColumns = GetColumns();
     const unsigned newRows = GetRows();
+    if (!m_Cells.Resize(newColumns, newRows))
+    {
+        LOGWARN("Cell grid resize to %ux%u failed", newColumns, newRows);
+    }
     if (newColumns > 0)
     {
         if (cursorColumn >= newColumns)
@@ -398,7 +600,7 @@ bool CTRenderer::SetFont(const TFont &rFont, CCharGenerator::TFontFlags FontFlag
     return true;
 }
 
-TRendererColor CTRenderer::MapColor(EColorSelection color)
+VT100_COLD TRendererColor CTRenderer::MapColor(EColorSelection color)
 {
     switch (color)
     {
@@ -489,6 +691,7 @@ void CTRenderer::Run()
 {
     while (!IsSuspended())
     {
+        ++m_nLoopCount;
         m_SpinLock.Acquire();
 
         if (m_bCursorOn && m_bBlinkingCursor)
@@ -520,6 +723,7 @@ void CTRenderer::Run()
             m_ScrollSmoothTicksAccum = 0;
             m_ScrollNormalCount = 0;
             m_ScrollSmoothCount = 0;
+            LogScrollGovernor(now);
             m_nScrollStatsLastLogTick = now;
         }
 
@@ -601,6 +805,119 @@ CBcmFrameBuffer *CTRenderer::GetDisplay(void)
     return m_pFrameBuffer;
 }
 
+VT100_COLD void CTRenderer::SetCrtEffects(const TCrtEffects &rEffects)
+{
+    m_SpinLock.Acquire();
+
+    if (rEffects.scanlines == m_CrtEffects.scanlines && rEffects.bloom == m_CrtEffects.bloom
+        && rEffects.glow == m_CrtEffects.glow)
+    {
+        m_SpinLock.Release();
+        return;
+    }
+
+    m_CrtEffects = rEffects;
+    FreeGlyphAtlases();
+
+    if (m_pFont != nullptr)
+    {
+        m_pGlyphAtlas = GetGlyphAtlas(*m_pFont, m_FontFlags);
+    }
+    if (m_pGraphicsFont != nullptr)
+    {
+        m_pGraphicsGlyphAtlas = GetGlyphAtlas(*m_pGraphicsFont, m_FontFlags);
+    }
+
+    m_SpinLock.Release();
+
+    LOGNOTE("CRT effects: scan lines %u%%, bloom %u%%, glow %u%%", rEffects.scanlines, rEffects.bloom,
+            rEffects.glow);
+}
+
+VT100_COLD const TCrtGlyphAtlas *CTRenderer::GetGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags)
+{
+    for (unsigned i = 0; i < GlyphAtlasSlots; ++i)
+    {
+        const TGlyphAtlasSlot &rSlot = m_GlyphAtlases[i];
+        if (rSlot.atlas.levels != nullptr && rSlot.font == &rFont && rSlot.flags == FontFlags)
+        {
+            return &rSlot.atlas;
+        }
+    }
+
+    // Round robin: the slots hold every size of the current fonts, older fonts go first
+    TGlyphAtlasSlot &rSlot = m_GlyphAtlases[m_nNextGlyphAtlasSlot];
+    m_nNextGlyphAtlasSlot = (m_nNextGlyphAtlasSlot + 1) % GlyphAtlasSlots;
+
+    FreeCrtGlyphAtlas(rSlot.atlas);
+    // Without effects the glyphs were shaded at build time (VT100_GlyphAtlas.h)
+    const boolean bGenerated = m_CrtEffects.scanlines == 0 && m_CrtEffects.bloom == 0 && m_CrtEffects.glow == 0 &&
+                               GetGeneratedGlyphAtlas(rFont, FontFlags, rSlot.atlas);
+    if (!bGenerated && !BuildCrtGlyphAtlas(rFont, FontFlags, m_CrtEffects, rSlot.atlas))
+    {
+        LOGWARN("Glyph atlas allocation failed, drawing plain glyphs");
+        return nullptr;
+    }
+
+    rSlot.font = &rFont;
+    rSlot.flags = FontFlags;
+    return &rSlot.atlas;
+}
+
+VT100_COLD void CTRenderer::FreeGlyphAtlases(void)
+{
+    for (unsigned i = 0; i < GlyphAtlasSlots; ++i)
+    {
+        FreeCrtGlyphAtlas(m_GlyphAtlases[i].atlas);
+        m_GlyphAtlases[i].font = nullptr;
+    }
+    m_nNextGlyphAtlasSlot = 0;
+    m_pGlyphAtlas = nullptr;
+    m_pGraphicsGlyphAtlas = nullptr;
+}
+
+VT100_HOT const CDisplay::TRawColor *CTRenderer::GetShadeRamp(CDisplay::TRawColor nForeground,
+                                                    CDisplay::TRawColor nBackground)
+{
+    if (!m_bShadeRampValid || nForeground != m_nShadeRampForeground || nBackground != m_nShadeRampBackground)
+    {
+        BuildShadeRamp(nForeground, nBackground);
+    }
+    return m_ShadeRamp;
+}
+
+VT100_COLD void CTRenderer::BuildShadeRamp(CDisplay::TRawColor nForeground, CDisplay::TRawColor nBackground)
+{
+    const int fullLevel = static_cast<int>(CrtShadeLevels - 1);
+    for (unsigned level = 0; level < CrtShadeLevels; ++level)
+    {
+        if (m_nDepth != 16)
+        {
+            m_ShadeRamp[level] = level * 2 >= CrtShadeLevels ? nForeground : nBackground;
+            continue;
+        }
+
+        // Blend the RGB565 channels from background to foreground
+        const int fgRed = (nForeground >> 11) & 0x1F;
+        const int fgGreen = (nForeground >> 5) & 0x3F;
+        const int fgBlue = nForeground & 0x1F;
+        const int bgRed = (nBackground >> 11) & 0x1F;
+        const int bgGreen = (nBackground >> 5) & 0x3F;
+        const int bgBlue = nBackground & 0x1F;
+        const int weight = static_cast<int>(level);
+        const int inverse = fullLevel - weight;
+
+        const int red = (fgRed * weight + bgRed * inverse + fullLevel / 2) / fullLevel;
+        const int green = (fgGreen * weight + bgGreen * inverse + fullLevel / 2) / fullLevel;
+        const int blue = (fgBlue * weight + bgBlue * inverse + fullLevel / 2) / fullLevel;
+        m_ShadeRamp[level] = static_cast<CDisplay::TRawColor>((red << 11) | (green << 5) | blue);
+    }
+
+    m_nShadeRampForeground = nForeground;
+    m_nShadeRampBackground = nBackground;
+    m_bShadeRampValid = TRUE;
+}
+
 void CTRenderer::SetColors(TRendererColor Foreground, TRendererColor Background)
 {
     if (m_pFrameBuffer == nullptr)
@@ -621,7 +938,7 @@ void CTRenderer::SetColors(TRendererColor Foreground, TRendererColor Background)
     m_SpinLock.Release();
 }
 
-int CTRenderer::Write(const void *pBuffer, size_t nCount)
+VT100_HOT int CTRenderer::Write(const void *pBuffer, size_t nCount)
 {
 #ifdef REALTIME
     // cannot write from IRQ_LEVEL to prevent deadlock, just ignore it
@@ -632,6 +949,10 @@ int CTRenderer::Write(const void *pBuffer, size_t nCount)
 #endif
 
     m_SpinLock.Acquire();
+    const unsigned nStartUs = CTimer::GetClockTicks();
+
+    m_nLastWriteTicks = CTimer::Get()->GetTicks();
+    NoteIngest(nCount, m_nLastWriteTicks);
 
     const bool cursorWasVisible = m_bCursorVisible;
     if (cursorWasVisible)
@@ -639,14 +960,15 @@ int CTRenderer::Write(const void *pBuffer, size_t nCount)
         InvertCursor();
     }
 
-    const char *pChar = (const char *)pBuffer;
-    int nResult = 0;
+    const int nResult = static_cast<int>(nCount);
+    WriteBytes(static_cast<const char *>(pBuffer), nCount);
 
-    while (nCount--)
-    {
-        Write(*pChar++);
+    ResolveJumpScroll();
 
-        nResult++;
+    // Present the bands of an image that continues in the next chunk
+    if (m_pSixel->IsActive())
+    {
+        FlushSixelDamage();
     }
 
     if (cursorWasVisible && m_bCursorOn)
@@ -661,164 +983,461 @@ int CTRenderer::Write(const void *pBuffer, size_t nCount)
     // Update display
     if (!m_bDelayedUpdate && !m_bSmoothScrollActive && m_UpdateArea.y1 <= m_UpdateArea.y2)
     {
-        m_pFrameBuffer->SetArea(m_UpdateArea, m_pBuffer8 + m_UpdateArea.y1 * m_nPitch);
-
-        m_UpdateArea.y1 = m_nHeight;
-        m_UpdateArea.y2 = 0;
+        FlushUpdateArea();
     }
 
-    m_SpinLock.Release();
+    m_nPerfBytes += static_cast<u32>(nCount);
+    m_nPerfBusyUs += CTimer::GetClockTicks() - nStartUs;
+    ReleaseAndDeliverReplies(m_nActiveConsole);
 
     return nResult;
 }
 
-void CTRenderer::ResetParserState(void)
-{
-    m_SpinLock.Acquire();
-    m_State = StateStart;
-    m_nParam1 = 0;
-    m_nParam2 = 0;
-    m_SpinLock.Release();
-}
-
-inline void CTRenderer::SetRawPixel(unsigned nPosX, unsigned nPosY, CDisplay::TRawColor nColor)
+VT100_HOT void CTRenderer::WriteBytes(const char *pChar, size_t nCount)
 {
-    switch (m_nDepth)
-    {
-    case 1:
+    while (nCount > 0)
     {
-        u8 *pBuffer = &m_pBuffer8[(m_nWidth * nPosY + nPosX) / 8];
-        u8 uchMask = 0x80 >> (nPosX & 7);
-        if (nColor)
+        if (m_bPrinterController)
         {
-            *pBuffer |= uchMask;
+            const size_t nUsed = WritePrinterData(pChar, nCount);
+            pChar += nUsed;
+            nCount -= nUsed;
+            continue;
         }
-        else
+
+        // Text between control sequences skips the state machine
+        if (m_State == StateStart && m_bPrintableSpans)
         {
-            *pBuffer &= ~uchMask;
+            const size_t nSpan = ScanPrintable(pChar, nCount);
+            if (nSpan > 0)
+            {
+                WritePrintable(pChar, nSpan);
+                pChar += nSpan;
+                nCount -= nSpan;
+                continue;
+            }
         }
-    }
-    break;
 
-    case 8:
-        m_pBuffer8[m_nWidth * nPosY + nPosX] = (u8)nColor;
-        break;
-    case 16:
-        m_pBuffer16[m_nWidth * nPosY + nPosX] = (u16)nColor;
-        break;
-    case 32:
-        m_pBuffer32[m_nWidth * nPosY + nPosX] = nColor;
-        break;
+        Write(*pChar++);
+        --nCount;
     }
 }
 
-inline CDisplay::TRawColor CTRenderer::GetRawPixel(unsigned nPosX, unsigned nPosY)
+VT100_HOT size_t CTRenderer::ScanPrintable(const char *pChar, size_t nCount)
 {
-    switch (m_nDepth)
-    {
-    case 1:
-    {
-        u8 *pBuffer = &m_pBuffer8[(m_nWidth * nPosY + nPosX) / 8];
-        u8 uchMask = 0x80 >> (nPosX & 7);
-        return !!(*pBuffer & uchMask);
+    // One word per step (4 bytes on the Pi Zero): a byte below 0x20 sets its
+    // top bit in (x - 0x20..) & ~x, a DEL byte is a zero byte of x ^ 0x7F..;
+    // bytes from 0x80 up are printable and never flagged
+    typedef uintptr TWord;
+    static const TWord Ones = static_cast<TWord>(-1) / 0xFF;
+    static const TWord TopBits = Ones * 0x80;
+
+    size_t i = 0;
+    while (nCount - i >= sizeof(TWord))
+    {
+        TWord word;
+        memcpy(&word, pChar + i, sizeof(word));
+        const TWord del = word ^ (Ones * 0x7F);
+        if ((((word - Ones * 0x20) & ~word) | ((del - Ones) & ~del)) & TopBits)
+        {
+            break;
+        }
+        i += sizeof(TWord);
     }
-    break;
 
-    case 8:
-        return m_pBuffer8[m_nWidth * nPosY + nPosX];
-    case 16:
-        return m_pBuffer16[m_nWidth * nPosY + nPosX];
-    case 32:
-        return m_pBuffer32[m_nWidth * nPosY + nPosX];
+    while (i < nCount)
+    {
+        const unsigned char byte = static_cast<unsigned char>(pChar[i]);
+        if (byte < 0x20U || byte == 0x7FU)
+        {
+            break;
+        }
+        ++i;
     }
 
-    return 0;
+    return i;
 }
 
-CDisplay::TColor CTRenderer::AdjustBrightness(CDisplay::TColor color, float factor)
+VT100_HOT void CTRenderer::WritePrintable(const char *pChar, size_t nCount)
 {
-    auto clamp = [](int v)
-    { return static_cast<u32>(v < 0 ? 0 : (v > 255 ? 255 : v)); };
-
-    u32 r = (color >> 16) & 0xFF;
-    u32 g = (color >> 8) & 0xFF;
-    u32 b = color & 0xFF;
-
-    r = clamp(static_cast<int>(r * factor));
-    g = clamp(static_cast<int>(g * factor));
-    b = clamp(static_cast<int>(b * factor));
+    // Same as the default branch of Write(char) in StateStart, with the
+    // margin bell setting read once per span
+    CTConfig *config = CTConfig::Get();
+    const boolean bMarginBell = config != nullptr && config->GetMarginBellEnabled();
 
-    return DISPLAY_COLOR(r, g, b);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        if (bMarginBell)
+        {
+            CheckMarginBell();
+        }
+        DisplayChar(pChar[i]);
+    }
 }
 
-CDisplay::TRawColor CTRenderer::AdjustBrightness565(CDisplay::TRawColor color, float factor)
+size_t CTRenderer::WritePrinterData(const char *pChar, size_t nCount)
 {
-    auto clampComponent = [](float value, u32 maxValue) -> u32
+    static const char Terminator[] = "\x1B[4i";
+    static const unsigned TerminatorLength = sizeof(Terminator) - 1;
+
+    size_t i = 0;
+    while (i < nCount)
     {
-        if (value < 0.0f)
+        if (m_nPrinterMatch == 0)
         {
-            return 0;
+            // Everything up to the next ESC is data
+            const char *pEscape = static_cast<const char *>(memchr(pChar + i, '\x1B', nCount - i));
+            const size_t nRun = pEscape != nullptr ? static_cast<size_t>(pEscape - (pChar + i)) : nCount - i;
+            if (nRun > 0)
+            {
+                m_pPrintHandler(PrintJobData, pChar + i, nRun);
+                i += nRun;
+            }
+            if (pEscape == nullptr)
+            {
+                break;
+            }
+            m_nPrinterMatch = 1;
+            ++i;
+            continue;
         }
 
-        if (value > static_cast<float>(maxValue))
+        if (pChar[i] == Terminator[m_nPrinterMatch])
         {
-            return maxValue;
+            ++i;
+            if (++m_nPrinterMatch == TerminatorLength)
+            {
+                m_nPrinterMatch = 0;
+                m_bPrinterController = FALSE;
+                m_bPrintJobOpen = FALSE;
+                m_pPrintHandler(PrintJobEnd, nullptr, 0);
+                return i;
+            }
+            continue;
         }
 
-        return static_cast<u32>(value + 0.5f);
-    };
+        // The withheld prefix was data after all; look at this byte again
+        m_pPrintHandler(PrintJobData, Terminator, m_nPrinterMatch);
+        m_nPrinterMatch = 0;
+    }
 
-    const float r = static_cast<float>((color >> 11) & 0x1F);
-    const float g = static_cast<float>((color >> 5) & 0x3F);
-    const float b = static_cast<float>(color & 0x1F);
+    return nCount;
+}
 
-    float scaledFactor = factor;
-    if (scaledFactor < 0.0f)
+VT100_COLD void CTRenderer::BeginPrinterController(void)
+{
+    if (m_pPrintHandler == nullptr || m_bPrintJobOpen)
     {
-        scaledFactor = 0.0f;
+        return;
     }
 
-    if (scaledFactor > 2.0f)
+    m_bPrinterController = TRUE;
+    m_bPrintJobOpen = TRUE;
+    m_nPrinterMatch = 0;
+    m_pPrintHandler(PrintJobStart, nullptr, 0);
+}
+
+VT100_HOT int CTRenderer::WriteConsole(unsigned nConsole, const void *pBuffer, size_t nCount)
+{
+    if (nConsole >= MaxConsoles || pBuffer == nullptr)
     {
-        scaledFactor = 2.0f;
+        return 0;
     }
 
-    float newR;
-    float newG;
-    float newB;
+    if (nConsole == m_nActiveConsole)
+    {
+        return Write(pBuffer, nCount);
+    }
 
-    if (scaledFactor <= 1.0f)
+#ifdef REALTIME
+    if (CurrentExecutionLevel() > TASK_LEVEL)
     {
-        newR = r * scaledFactor;
-        newG = g * scaledFactor;
-        newB = b * scaledFactor;
+        return nCount;
     }
-    else
+#endif
+
+    m_SpinLock.Acquire();
+    const unsigned nStartUs = CTimer::GetClockTicks();
+
+    if (m_pCharGen == nullptr)
     {
-        // First scale the colour vector and clamp to the 5:6:5 limits to keep the hue dominant
-        newR = r * scaledFactor;
-        newG = g * scaledFactor;
-        newB = b * scaledFactor;
+        m_SpinLock.Release();
+        return 0;
+    }
 
-        const float redClamp = (newR > 31.0f) ? (31.0f / newR) : 1.0f;
-        const float greenClamp = (newG > 63.0f) ? (63.0f / newG) : 1.0f;
-        const float blueClamp = (newB > 31.0f) ? (31.0f / newB) : 1.0f;
+    // Run the parser on the parked state; every pixel path checks m_bRasterise
+    ExchangeConsole(m_Consoles[nConsole]);
+    FitConsoleGeometry();
+    m_bRasterise = FALSE;
 
-        float clampScale = redClamp;
-        if (greenClamp < clampScale)
-        {
-            clampScale = greenClamp;
-        }
-        if (blueClamp < clampScale)
-        {
-            clampScale = blueClamp;
-        }
+    const int nResult = static_cast<int>(nCount);
+    WriteBytes(static_cast<const char *>(pBuffer), nCount);
 
-        if (clampScale < 1.0f)
-        {
-            newR *= clampScale;
-            newG *= clampScale;
-            newB *= clampScale;
+    m_bRasterise = TRUE;
+    ExchangeConsole(m_Consoles[nConsole]);
+
+    m_nPerfBytes += static_cast<u32>(nCount);
+    m_nPerfBusyUs += CTimer::GetClockTicks() - nStartUs;
+    ReleaseAndDeliverReplies(nConsole);
+
+    return nResult;
+}
+
+VT100_COLD boolean CTRenderer::SwitchConsole(unsigned nConsole)
+{
+    if (nConsole >= MaxConsoles)
+    {
+        return FALSE;
+    }
+
+    m_SpinLock.Acquire();
+
+    if (m_pCharGen == nullptr || m_pFrameBuffer == nullptr)
+    {
+        m_SpinLock.Release();
+        return FALSE;
+    }
+
+    if (nConsole == m_nActiveConsole)
+    {
+        m_SpinLock.Release();
+        return TRUE;
+    }
+
+    // The screen belongs to SET-UP or VTTest until RestoreSnapshot()
+    if (m_Snapshot.id != 0)
+    {
+        m_SpinLock.Release();
+        return FALSE;
+    }
+
+    BeginOverlay();
+
+    // The pixel snapshot of a running animation belongs to the old console
+    m_bSmoothScrollActive = FALSE;
+
+    const unsigned previous = m_nActiveConsole;
+    ExchangeConsole(m_Consoles[previous]);
+    ExchangeConsole(m_Consoles[nConsole]);
+    m_nActiveConsole = nConsole;
+    FitConsoleGeometry();
+
+    // An image still arriving for the hidden console is parsed but not drawn
+    m_Consoles[previous].sixel->DetachTarget();
+
+    // EndOverlay() restores the rendition of the console now on screen
+    m_OverlayAttributes = GetCellAttributes();
+
+    ClearPixels();
+    RenderCells();
+    m_Cells.TouchAll();
+    SetUpdateArea(0, m_nHeight - 1);
+
+    EndOverlay();
+
+    // The keyboard follows the cursor and keypad modes of the new console
+    ReleaseAndDeliverReplies(nConsole);
+
+    LOGNOTE("Console %u active", nConsole + 1);
+    return TRUE;
+}
+
+void CTRenderer::ResetParserState(void)
+{
+    m_SpinLock.Acquire();
+    m_pSixel->End();
+    m_State = StateStart;
+    m_nParam1 = 0;
+    m_nParam2 = 0;
+    m_nParamCount = 0;
+    m_SpinLock.Release();
+}
+
+void CTRenderer::RegisterReplyHandler(ReplyHandler pHandler)
+{
+    m_SpinLock.Acquire();
+    m_pReplyHandler = pHandler;
+    m_SpinLock.Release();
+}
+
+void CTRenderer::RegisterKeyModeHandler(KeyModeHandler pHandler)
+{
+    m_SpinLock.Acquire();
+    m_pKeyModeHandler = pHandler;
+    m_nReportedKeyModes = GetKeyModes();
+    m_SpinLock.Release();
+
+    if (pHandler != nullptr)
+    {
+        pHandler(m_nReportedKeyModes);
+    }
+}
+
+void CTRenderer::RegisterPrintHandler(PrintHandler pHandler)
+{
+    m_SpinLock.Acquire();
+    // A job in progress ends with the handler that started it
+    if (m_bPrintJobOpen)
+    {
+        m_pPrintHandler(PrintJobEnd, nullptr, 0);
+        m_bPrintJobOpen = FALSE;
+    }
+    m_bPrinterController = FALSE;
+    m_nPrinterMatch = 0;
+    for (unsigned i = 0; i < MaxConsoles; ++i)
+    {
+        m_Consoles[i].printerController = FALSE;
+        m_Consoles[i].printerMatch = 0;
+    }
+    m_pPrintHandler = pHandler;
+    m_SpinLock.Release();
+}
+
+unsigned CTRenderer::GetKeyModes(void) const
+{
+    return (m_bCursorKeyApplication ? CTKeyMap::KeyModeCursorApplication : 0)
+         | (m_bKeypadApplication ? CTKeyMap::KeyModeKeypadApplication : 0)
+         | (m_bVT52Mode ? CTKeyMap::KeyModeVT52 : 0);
+}
+
+inline void CTRenderer::SetRawPixel(unsigned nPosX, unsigned nPosY, CDisplay::TRawColor nColor)
+{
+    switch (m_nDepth)
+    {
+    case 1:
+    {
+        u8 *pBuffer = &m_pBuffer8[(m_nWidth * nPosY + nPosX) / 8];
+        u8 uchMask = 0x80 >> (nPosX & 7);
+        if (nColor)
+        {
+            *pBuffer |= uchMask;
+        }
+        else
+        {
+            *pBuffer &= ~uchMask;
+        }
+    }
+    break;
+
+    case 8:
+        m_pBuffer8[m_nWidth * nPosY + nPosX] = (u8)nColor;
+        break;
+    case 16:
+        m_pBuffer16[m_nWidth * nPosY + nPosX] = (u16)nColor;
+        break;
+    case 32:
+        m_pBuffer32[m_nWidth * nPosY + nPosX] = nColor;
+        break;
+    }
+}
+
+inline CDisplay::TRawColor CTRenderer::GetRawPixel(unsigned nPosX, unsigned nPosY)
+{
+    switch (m_nDepth)
+    {
+    case 1:
+    {
+        u8 *pBuffer = &m_pBuffer8[(m_nWidth * nPosY + nPosX) / 8];
+        u8 uchMask = 0x80 >> (nPosX & 7);
+        return !!(*pBuffer & uchMask);
+    }
+    break;
+
+    case 8:
+        return m_pBuffer8[m_nWidth * nPosY + nPosX];
+    case 16:
+        return m_pBuffer16[m_nWidth * nPosY + nPosX];
+    case 32:
+        return m_pBuffer32[m_nWidth * nPosY + nPosX];
+    }
+
+    return 0;
+}
+
+CDisplay::TColor CTRenderer::AdjustBrightness(CDisplay::TColor color, float factor)
+{
+    auto clamp = [](int v)
+    { return static_cast<u32>(v < 0 ? 0 : (v > 255 ? 255 : v)); };
+
+    u32 r = (color >> 16) & 0xFF;
+    u32 g = (color >> 8) & 0xFF;
+    u32 b = color & 0xFF;
+
+    r = clamp(static_cast<int>(r * factor));
+    g = clamp(static_cast<int>(g * factor));
+    b = clamp(static_cast<int>(b * factor));
+
+    return DISPLAY_COLOR(r, g, b);
+}
+
+VT100_HOT CDisplay::TRawColor CTRenderer::AdjustBrightness565(CDisplay::TRawColor color, float factor)
+{
+    auto clampComponent = [](float value, u32 maxValue) -> u32
+    {
+        if (value < 0.0f)
+        {
+            return 0;
+        }
+
+        if (value > static_cast<float>(maxValue))
+        {
+            return maxValue;
+        }
+
+        return static_cast<u32>(value + 0.5f);
+    };
+
+    const float r = static_cast<float>((color >> 11) & 0x1F);
+    const float g = static_cast<float>((color >> 5) & 0x3F);
+    const float b = static_cast<float>(color & 0x1F);
+
+    float scaledFactor = factor;
+    if (scaledFactor < 0.0f)
+    {
+        scaledFactor = 0.0f;
+    }
+
+    if (scaledFactor > 2.0f)
+    {
+        scaledFactor = 2.0f;
+    }
+
+    float newR;
+    float newG;
+    float newB;
+
+    if (scaledFactor <= 1.0f)
+    {
+        newR = r * scaledFactor;
+        newG = g * scaledFactor;
+        newB = b * scaledFactor;
+    }
+    else
+    {
+        // First scale the colour vector and clamp to the 5:6:5 limits to keep the hue dominant
+        newR = r * scaledFactor;
+        newG = g * scaledFactor;
+        newB = b * scaledFactor;
+
+        const float redClamp = (newR > 31.0f) ? (31.0f / newR) : 1.0f;
+        const float greenClamp = (newG > 63.0f) ? (63.0f / newG) : 1.0f;
+        const float blueClamp = (newB > 31.0f) ? (31.0f / newB) : 1.0f;
+
+        float clampScale = redClamp;
+        if (greenClamp < clampScale)
+        {
+            clampScale = greenClamp;
+        }
+        if (blueClamp < clampScale)
+        {
+            clampScale = blueClamp;
+        }
+
+        if (clampScale < 1.0f)
+        {
+            newR *= clampScale;
+            newG *= clampScale;
+            newB *= clampScale;
         }
 
         // Add a controlled bias towards a warmer highlight to boost perceived brightness
@@ -857,11 +1476,7 @@ void CTRenderer::SetPixel(unsigned nPosX, unsigned nPosY, TRendererColor Color)
         return;
     }
 
-    CDisplay::TRawColor nColor = m_pFrameBuffer->GetColor(Color);
-
-    SetRawPixel(nPosX, nPosY, nColor);
-
-    m_pFrameBuffer->SetPixel(nPosX, nPosY, nColor);
+    SetPixel(nPosX, nPosY, m_pFrameBuffer->GetColor(Color));
 }
 
 void CTRenderer::SetPixel(unsigned nPosX, unsigned nPosY, CDisplay::TRawColor nColor)
@@ -871,9 +1486,11 @@ void CTRenderer::SetPixel(unsigned nPosX, unsigned nPosY, CDisplay::TRawColor nC
         return;
     }
 
+    TouchLines(nPosY, nPosY);
     SetRawPixel(nPosX, nPosY, nColor);
 
     m_pFrameBuffer->SetPixel(nPosX, nPosY, nColor);
+    m_pShownLines[nPosY].blank = FALSE;
 }
 
 TRendererColor CTRenderer::GetPixel(unsigned nPosX, unsigned nPosY)
@@ -883,6 +1500,7 @@ TRendererColor CTRenderer::GetPixel(unsigned nPosX, unsigned nPosY)
         return CDisplay::Black;
     }
 
+    TouchLines(nPosY, nPosY);
     return m_pFrameBuffer->GetColor(GetRawPixel(nPosX, nPosY));
 }
 
@@ -921,6 +1539,7 @@ void CTRenderer::SetBlinkingCursor(boolean bBlinkingCursor, unsigned nPeriodMill
 void CTRenderer::Update()
 {
     m_SpinLock.Acquire();
+    const unsigned nStartUs = CTimer::GetClockTicks();
 
     if (m_bSmoothScrollActive)
     {
@@ -936,12 +1555,7 @@ void CTRenderer::Update()
             }
             else
             {
-                CDisplay::TArea area;
-                area.x1 = 0;
-                area.x2 = m_nWidth - 1;
-                area.y1 = m_nSmoothScrollStartY;
-                area.y2 = m_nSmoothScrollEndY;
-                m_pFrameBuffer->SetArea(area, m_pBuffer8 + area.y1 * m_nPitch);
+                PresentLines(m_nSmoothScrollStartY, m_nSmoothScrollEndY, 0, m_nWidth - 1);
                 if (m_nSmoothScrollStartTick != 0)
                 {
                     m_ScrollSmoothTicksAccum += static_cast<unsigned>(now - m_nSmoothScrollStartTick);
@@ -954,12 +1568,10 @@ void CTRenderer::Update()
 
     if (!m_bSmoothScrollActive && m_UpdateArea.y1 <= m_UpdateArea.y2)
     {
-        m_pFrameBuffer->SetArea(m_UpdateArea, m_pBuffer8 + m_UpdateArea.y1 * m_nPitch);
-
-        m_UpdateArea.y1 = m_nHeight;
-        m_UpdateArea.y2 = 0;
+        FlushUpdateArea();
     }
 
+    m_nPerfBusyUs += CTimer::GetClockTicks() - nStartUs;
     m_SpinLock.Release();
 }
 
@@ -970,10 +1582,9 @@ boolean CTRenderer::BeginSmoothScrollAnimation(unsigned nStartY, unsigned nEndY,
         return FALSE;
     }
 
-    const unsigned now = CTimer::Get()->GetTicks();
-
-    // Debounce: if an animation is active or we recently animated, skip smooth and let caller fall back to instant
-    if (m_bSmoothScrollActive || (int)(m_nSmoothScrollDebounceUntil - now) > 0)
+    // The governor leaves smooth mode once lines arrive faster than one animation each;
+    // until then a scroll during a running animation is shown instantly
+    if (m_ScrollMode != ScrollModeSmooth || m_bSmoothScrollActive)
     {
         return FALSE;
     }
@@ -996,7 +1607,7 @@ boolean CTRenderer::BeginSmoothScrollAnimation(unsigned nStartY, unsigned nEndY,
         return FALSE;
     }
 
-    memcpy(m_pSmoothScrollSnapshot, m_pBuffer8 + nStartY * m_nPitch, regionBytes);
+    CopyLines(m_pSmoothScrollSnapshot, nStartY, regionHeight);
     m_nSmoothScrollStartY = nStartY;
     m_nSmoothScrollEndY = nEndY;
     m_bSmoothScrollDown = bScrollDown;
@@ -1017,8 +1628,6 @@ boolean CTRenderer::BeginSmoothScrollAnimation(unsigned nStartY, unsigned nEndY,
     m_nSmoothScrollOffset = m_nSmoothScrollStep;
     m_nSmoothScrollLastTick = CTimer::Get()->GetTicks();
     m_nSmoothScrollStartTick = m_nSmoothScrollLastTick;
-    const unsigned debounceMs = 50;
-    m_nSmoothScrollDebounceUntil = m_nSmoothScrollLastTick + MSEC2HZ(debounceMs);
     m_bSmoothScrollActive = TRUE;
     return TRUE;
 }
@@ -1070,8 +1679,7 @@ void CTRenderer::RenderSmoothScrollFrame(void)
         }
 
         // Show live buffer content (including newly drawn bottom lines) as soon as it scrolls into view
-        const u8 *pLive = m_pBuffer8 + (m_nSmoothScrollStartY + y) * m_nPitch;
-        memcpy(pDst, pLive, m_nPitch);
+        CopyLines(pDst, m_nSmoothScrollStartY + y, 1);
     }
 
     CDisplay::TArea area;
@@ -1080,41 +1688,243 @@ void CTRenderer::RenderSmoothScrollFrame(void)
     area.y1 = m_nSmoothScrollStartY;
     area.y2 = m_nSmoothScrollEndY;
     m_pFrameBuffer->SetArea(area, m_pSmoothScrollCompose);
+    ForgetShownLines(area.y1, area.y2);
 }
 
-void CTRenderer::Write(char chChar)
+VT100_HOT void CTRenderer::NoteIngest(size_t nCount, unsigned nNow)
 {
-    switch (m_State)
+    m_nIngestBacklog = static_cast<unsigned>(nCount) + m_nIngestBacklogHint;
+    m_nIngestBacklogHint = 0;
+    m_nRateWindowBytes += static_cast<unsigned>(nCount);
+
+    const unsigned elapsed = nNow - m_nRateWindowStart;
+    if (elapsed >= MSEC2HZ(GovernorWindowMs))
     {
-    case StateSkipTillCRLF: // skip processing of second double height line
-        if (chChar == '\n' || chChar == '\r')
-        {
-            m_State = StateStart;
-        }
-        break;
+        // Half the last window, half the history: follows a change within a few windows
+        m_nInputRate = (m_nInputRate + m_nRateWindowBytes * HZ / elapsed) / 2;
+        m_nScrollRate = (m_nScrollRate + m_nRateWindowScrolls * HZ / elapsed) / 2;
+        m_nRateWindowBytes = 0;
+        m_nRateWindowScrolls = 0;
+        m_nRateWindowStart = nNow;
+    }
+}
 
-    case StateStart:
-        switch (chChar)
-        {
-        case '\b':
-            CursorLeft();
-            break;
+VT100_HOT CTRenderer::TScrollMode CTRenderer::ChooseScrollMode(void)
+{
+    const unsigned now = m_nLastWriteTicks;
+    const boolean smoothAvailable = m_bSmoothScrollEnabled && m_pSmoothScrollSnapshot != nullptr;
 
-        case '\t':
-            Tabulator();
-            break;
+    const boolean jumpLoad = m_nIngestBacklog >= JumpEnterBacklog || m_nInputRate >= JumpEnterRate;
+    const boolean jumpCalm = m_nIngestBacklog < JumpLeaveBacklog && m_nInputRate < JumpLeaveRate;
+    const boolean smoothBusy = !smoothAvailable || m_nIngestBacklog > SmoothMaxBacklog
+                            || m_nScrollRate > SmoothMaxScrollRate;
+    const boolean smoothCalm = smoothAvailable && m_nIngestBacklog <= SmoothEnterBacklog
+                            && m_nScrollRate <= SmoothEnterScrollRate;
 
-        case '\f':
-            ClearDisplay();
-            break;
+    // Only load that stays low for the dwell time lets the next better mode in
+    if ((m_ScrollMode == ScrollModeJump && !jumpCalm) || (m_ScrollMode == ScrollModeInstant && !smoothCalm))
+    {
+        m_nScrollCalmSince = now;
+    }
+    const boolean settled = now - m_nScrollCalmSince >= MSEC2HZ(GovernorDwellMs);
 
-        case '\n':
-            NewLine();
-            break;
+    TScrollMode mode = m_ScrollMode;
+    if (jumpLoad)
+    {
+        mode = ScrollModeJump;
+    }
+    else if (m_ScrollMode == ScrollModeJump && settled)
+    {
+        mode = ScrollModeInstant;
+    }
+    else if (m_ScrollMode == ScrollModeSmooth && smoothBusy)
+    {
+        mode = ScrollModeInstant;
+    }
+    else if (m_ScrollMode == ScrollModeInstant && settled)
+    {
+        mode = ScrollModeSmooth;
+    }
 
-        case '\r':
-            CarriageReturn();
-            break;
+    if (mode != m_ScrollMode)
+    {
+        m_ScrollModeTicks[m_ScrollMode] += now - m_nScrollModeSince;
+        m_nScrollModeSince = now;
+        m_nScrollCalmSince = now;
+        m_ScrollMode = mode;
+        ++m_nScrollModeChanges;
+    }
+
+    ++m_ScrollModeDecisions[mode];
+    return mode;
+}
+
+boolean CTRenderer::BeginJumpScroll(void)
+{
+    // Sixel pixels are not in the cell grid and would be lost by the redraw
+    if (m_pSixel->IsActive() || m_nGraphicsY1 <= m_nGraphicsY2)
+    {
+        return FALSE;
+    }
+
+    const unsigned columns = m_Cells.GetColumns();
+    const unsigned rows = m_Cells.GetRows();
+    const size_t cells = static_cast<size_t>(columns) * rows;
+    if (cells == 0)
+    {
+        return FALSE;
+    }
+
+    if (cells > m_nJumpShownSize)
+    {
+        delete[] m_pJumpShown;
+        m_pJumpShown = new CTCellBuffer::TCell[cells];
+        m_nJumpShownSize = m_pJumpShown != nullptr ? cells : 0;
+        if (m_pJumpShown == nullptr)
+        {
+            return FALSE;
+        }
+    }
+
+    for (unsigned row = 0; row < rows; ++row)
+    {
+        memcpy(m_pJumpShown + row * columns, m_Cells.GetRow(row), columns * sizeof(CTCellBuffer::TCell));
+    }
+
+    const unsigned charHeight = m_pCharGen->GetCharHeight();
+    m_nJumpTopRow = m_nScrollStart / charHeight;
+    m_nJumpEndRow = m_nScrollEnd / charHeight;
+    m_nJumpLines = 0;
+    m_nJumpColumns = columns;
+    m_nJumpRows = rows;
+
+    // Every pixel path checks m_bRasterise, as for a background console
+    m_bJumpPending = TRUE;
+    m_bRasterise = FALSE;
+    return TRUE;
+}
+
+VT100_HOT void CTRenderer::ResolveJumpScroll(void)
+{
+    if (!m_bJumpPending)
+    {
+        return;
+    }
+
+    m_bJumpPending = FALSE;
+    m_bRasterise = TRUE;
+
+    const unsigned charHeight = m_pCharGen->GetCharHeight();
+    const unsigned columns = m_Cells.GetColumns();
+    const unsigned rows = m_Cells.GetRows();
+    const boolean geometryKept = columns == m_nJumpColumns && rows == m_nJumpRows;
+
+    // The pixels still show the grid as of BeginJumpScroll(). Move the region
+    // once by all coalesced lines; the framebuffer in direct mode is not read back.
+    unsigned shift = 0;
+    const unsigned regionRows = m_nJumpEndRow - m_nJumpTopRow;
+    if (!m_bDirectRender && geometryKept && m_nJumpLines > 0 && m_nJumpLines < regionRows)
+    {
+        shift = m_nJumpLines;
+        MoveLines(m_nJumpTopRow * charHeight, (m_nJumpTopRow + shift) * charHeight, (regionRows - shift) * charHeight);
+    }
+
+    const u8 attributes = GetCellAttributes();
+    for (unsigned row = 0; row < rows; ++row)
+    {
+        // Rows moved in from below the region show stale pixels and are drawn in full
+        const boolean inRegion = row >= m_nJumpTopRow && row < m_nJumpEndRow;
+        const unsigned shown = inRegion ? row + shift : row;
+        const CTCellBuffer::TCell *pShown = nullptr;
+        if (geometryKept && (!inRegion || shown < m_nJumpEndRow) && (!IsOverlayRow(shown) || IsOverlayRow(row)))
+        {
+            pShown = m_pJumpShown + shown * columns;
+        }
+
+        const CTCellBuffer::TCell *pRow = m_Cells.GetRow(row);
+        if (pShown == nullptr)
+        {
+            // Start from a blank row and draw only what is not blank, as RenderCells() does
+            FillLines(row * charHeight, (row + 1) * charHeight - 1, m_BackgroundColor);
+        }
+
+        for (unsigned column = 0; column < columns; ++column)
+        {
+            if (pShown != nullptr && pShown[column].ch == pRow[column].ch && pShown[column].attr == pRow[column].attr)
+            {
+                continue;
+            }
+            if (pShown == nullptr && pRow[column].ch == CTCellBuffer::BlankChar
+                && (pRow[column].attr & (CTCellBuffer::AttrReverse | CTCellBuffer::AttrUnderline)) == 0)
+            {
+                continue;
+            }
+
+            RenderCell(row, column);
+        }
+    }
+    ApplyCellAttributes(attributes);
+
+    SetUpdateArea(0, m_nHeight - 1);
+    ++m_nJumpResolves;
+    m_nJumpResolvedLines += m_nJumpLines;
+}
+
+void CTRenderer::LogScrollGovernor(unsigned nNow)
+{
+    m_ScrollModeTicks[m_ScrollMode] += nNow - m_nScrollModeSince;
+    m_nScrollModeSince = nNow;
+
+    LOGNOTE("Scroll governor: smooth %u/%llums, instant %u/%llums, jump %u/%llums (%u redraws, %u lines), "
+            "%u mode changes, input %u B/s",
+            m_ScrollModeDecisions[ScrollModeSmooth], m_ScrollModeTicks[ScrollModeSmooth] * 1000ULL / HZ,
+            m_ScrollModeDecisions[ScrollModeInstant], m_ScrollModeTicks[ScrollModeInstant] * 1000ULL / HZ,
+            m_ScrollModeDecisions[ScrollModeJump], m_ScrollModeTicks[ScrollModeJump] * 1000ULL / HZ,
+            m_nJumpResolves, m_nJumpResolvedLines, m_nScrollModeChanges, m_nInputRate);
+
+    for (unsigned mode = 0; mode < ScrollModeCount; ++mode)
+    {
+        m_ScrollModeDecisions[mode] = 0;
+        m_ScrollModeTicks[mode] = 0;
+    }
+    m_nScrollModeChanges = 0;
+    m_nJumpResolves = 0;
+    m_nJumpResolvedLines = 0;
+}
+
+VT100_HOT void CTRenderer::Write(char chChar)
+{
+    switch (m_State)
+    {
+    case StateSkipTillCRLF: // skip processing of second double height line
+        if (chChar == '\n' || chChar == '\r')
+        {
+            m_State = StateStart;
+        }
+        break;
+
+    case StateStart:
+        switch (chChar)
+        {
+        case '\b':
+            CursorLeft();
+            break;
+
+        case '\t':
+            Tabulator();
+            break;
+
+        case '\f':
+            ClearDisplay();
+            break;
+
+        case '\n':
+            NewLine();
+            break;
+
+        case '\r':
+            CarriageReturn();
+            break;
 
         case '\x0E': // Shift Out (Ctrl-N) -> Switch to G1
             m_bUseG1 = TRUE;
@@ -1134,18 +1944,9 @@ void CTRenderer::Write(char chChar)
             if (printable >= 0x20U && printable != 0x7FU)
             {
                 CTConfig *config = CTConfig::Get();
-                if (config != nullptr && config->GetMarginBellEnabled() && config->GetBuzzerVolume() > 0U)
+                if (config != nullptr && config->GetMarginBellEnabled())
                 {
-                    const unsigned cols = GetColumns();
-                    if (cols > 8U && m_pCharGen != nullptr)
-                    {
-                        const unsigned currentCol = m_nCursorX / m_pCharGen->GetCharWidth();
-                        const unsigned bellCol = cols - 9U;
-                        if (currentCol == bellCol)
-                        {
-                            CHAL::Get()->BEEP();
-                        }
-                    }
+                    CheckMarginBell();
                 }
             }
             DisplayChar(chChar);
@@ -1157,64 +1958,7 @@ void CTRenderer::Write(char chChar)
     case StateEscape:
         if (m_bVT52Mode)
         {
-            switch (chChar)
-            {
-            case 'A':
-                CursorUp();
-                m_State = StateStart;
-                break;
-
-            case 'B':
-                CursorDown();
-                m_State = StateStart;
-                break;
-
-            case 'C':
-                CursorRight();
-                m_State = StateStart;
-                break;
-
-            case 'D':
-                CursorLeft();
-                m_State = StateStart;
-                break;
-
-            case 'H':
-                // VT52 cursor home
-                m_nCursorX = 0;
-                m_nCursorY = 0;
-                m_State = StateStart;
-                break;
-
-            case 'I':
-                ReverseScroll();
-                m_State = StateStart;
-                break;
-
-            case 'J':
-                ClearDisplayEnd();
-                m_State = StateStart;
-                break;
-
-            case 'K':
-                ClearLineEnd();
-                m_State = StateStart;
-                break;
-
-            case 'Y':
-                m_State = StateVT52Row;
-                break;
-
-            case '<':
-                // switch to ANSI mode
-                m_bVT52Mode = FALSE;
-                m_State = StateStart;
-                break;
-
-            default:
-                m_State = StateStart;
-                break;
-            }
+            WriteVT52Escape(chChar);
         }
         else
         {
@@ -1247,19 +1991,7 @@ void CTRenderer::Write(char chChar)
 
             case 'H':
                 // HTS
-                if (m_pCharGen != nullptr)
-                {
-                    CTConfig *config = CTConfig::Get();
-                    if (config != nullptr)
-                    {
-                        const unsigned charWidth = m_pCharGen->GetCharWidth();
-                        if (charWidth != 0)
-                        {
-                            const unsigned currentCol = m_nCursorX / charWidth;
-                            config->SetTabStop(currentCol, true);
-                        }
-                    }
-                }
+                SetTabStopAtCursor(TRUE);
                 m_State = StateStart;
                 break;
 
@@ -1294,6 +2026,25 @@ void CTRenderer::Write(char chChar)
                 m_State = StateAutoPage;
                 break;
 
+            case '=':
+                // DECKPAM
+                m_bKeypadApplication = TRUE;
+                m_State = StateStart;
+                break;
+
+            case '>':
+                // DECKPNM
+                m_bKeypadApplication = FALSE;
+                m_State = StateStart;
+                break;
+
+            case 'P':
+                // DCS, only Sixel (q) is interpreted
+                m_State = StateDcs;
+                m_Params[0] = 0;
+                m_nParamCount = 1;
+                break;
+
             default:
                 m_State = StateStart;
                 break;
@@ -1326,35 +2077,7 @@ void CTRenderer::Write(char chChar)
         break;
 
     case StateFontChange:
-        switch (chChar)
-        {
-        case '3':
-            // Double Width double Height top half -> ignore, as we do not support double height
-            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsDoubleBoth);
-            m_State = StateStart;
-            break;
-        case '4':
-            // Double Width double Height bottom half -> ignore, as we do not support double height
-            m_State = StateSkipTillCRLF;
-            break;
-        case '5':
-            // Standard DEC font mode using currently selected VT100 font family
-            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsNone);
-            m_State = StateStart;
-            break;
-        case '6':
-            // Double width mode using currently selected VT100 font family
-            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsDoubleWidth);
-            m_State = StateStart;
-            break;
-        case '8':
-            // Screen test pattern -> ignore
-            m_State = StateStart;
-            break;
-        default:
-            m_State = StateStart;
-            break;
-        }
+        SetLineSize(chChar);
         break;
 
     case StateVT52Row:
@@ -1386,27 +2109,18 @@ void CTRenderer::Write(char chChar)
             m_State = StateStart;
             break;
         case 'g':
-        {
-            if (m_pCharGen != nullptr)
-            {
-                CTConfig *config = CTConfig::Get();
-                if (config != nullptr)
-                {
-                    const unsigned charWidth = m_pCharGen->GetCharWidth();
-                    if (charWidth != 0)
-                    {
-                        const unsigned currentCol = m_nCursorX / charWidth;
-                        config->SetTabStop(currentCol, false);
-                    }
-                }
-            }
+            SetTabStopAtCursor(FALSE);
             m_State = StateStart;
             break;
-        }
         case '?':
             m_State = StateQuestionMark;
             break;
 
+        case '*':
+            m_nParamCount = 0;
+            m_State = StateAsterisk;
+            break;
+
         case 'A':
             CursorUp();
             m_State = StateStart;
@@ -1526,6 +2240,12 @@ void CTRenderer::Write(char chChar)
             m_State = StateSemicolon;
             break;
 
+        case '*':
+            m_Params[0] = m_nParam1;
+            m_nParamCount = 1;
+            m_State = StateAsterisk;
+            break;
+
         case 'L':
             InsertLines(m_nParam1);
             m_State = StateStart;
@@ -1583,34 +2303,26 @@ void CTRenderer::Write(char chChar)
             m_State = StateStart;
             break;
 
+        case 'i':
+            // MC: only printer controller on; CSI 4 i is matched in WritePrinterData()
+            if (m_nParam1 == 5)
+            {
+                BeginPrinterController();
+            }
+            m_State = StateStart;
+            break;
+
         case 'g':
-        {
-            CTConfig *config = CTConfig::Get();
-            if (config != nullptr)
+            if (m_nParam1 == 0)
             {
-                if (m_nParam1 == 0)
-                {
-                    if (m_pCharGen != nullptr)
-                    {
-                        const unsigned charWidth = m_pCharGen->GetCharWidth();
-                        if (charWidth != 0)
-                        {
-                            const unsigned currentCol = m_nCursorX / charWidth;
-                            config->SetTabStop(currentCol, false);
-                        }
-                    }
-                }
-                else if (m_nParam1 == 3)
-                {
-                    for (unsigned col = 0; col < CTConfig::TabStopsMax; ++col)
-                    {
-                        config->SetTabStop(col, false);
-                    }
-                }
+                SetTabStopAtCursor(FALSE);
+            }
+            else if (m_nParam1 == 3)
+            {
+                ClearTabStops();
             }
             m_State = StateStart;
             break;
-        }
 
         default:
             if ('0' <= chChar && chChar <= '9')
@@ -1674,6 +2386,23 @@ void CTRenderer::Write(char chChar)
             m_State = StateStart;
             break;
 
+        case ';':
+        case '*':
+            // Longer parameter lists (DECRQCRA) continue in StateParams
+            m_Params[0] = m_nParam1;
+            m_Params[1] = m_nParam2;
+            m_nParamCount = 2;
+            if (chChar == ';')
+            {
+                m_Params[m_nParamCount++] = 0;
+                m_State = StateParams;
+            }
+            else
+            {
+                m_State = StateAsterisk;
+            }
+            break;
+
         default:
             if ('0' <= chChar && chChar <= '9')
             {
@@ -1701,6 +2430,10 @@ void CTRenderer::Write(char chChar)
             {
                 SetCursorMode(TRUE);
             }
+            else if (m_nParam1 == 1)
+            {
+                m_bCursorKeyApplication = TRUE;
+            }
             m_State = StateStart;
             break;
 
@@ -1709,6 +2442,10 @@ void CTRenderer::Write(char chChar)
             {
                 SetCursorMode(FALSE);
             }
+            else if (m_nParam1 == 1)
+            {
+                m_bCursorKeyApplication = FALSE;
+            }
             else if (m_nParam1 == 2)
             {
                 m_bVT52Mode = TRUE;
@@ -1735,104 +2472,367 @@ void CTRenderer::Write(char chChar)
         }
         break;
 
-    case StateAutoPage:
-        switch (chChar)
+    case StateParams:
+        if ('0' <= chChar && chChar <= '9')
         {
-        case '+':
-            SetAutoPageMode(TRUE);
-            m_State = StateStart;
-            break;
-
-        case '*':
-            SetAutoPageMode(FALSE);
-            m_State = StateStart;
-            break;
+            unsigned &param = m_Params[m_nParamCount - 1];
+            param *= 10;
+            param += chChar - '0';
 
-        default:
+            if (param > MaxParamValue)
+            {
+                m_State = StateStart;
+            }
+        }
+        else if (chChar == ';' && m_nParamCount < MaxParams)
+        {
+            m_Params[m_nParamCount++] = 0;
+        }
+        else if (chChar == '*')
+        {
+            m_State = StateAsterisk;
+        }
+        else
+        {
             m_State = StateStart;
-            break;
         }
         break;
 
-    default:
+    case StateAsterisk:
+        if (chChar == 'y')
+        {
+            ReportAreaChecksum();
+        }
         m_State = StateStart;
         break;
-    }
-}
-
-void CTRenderer::CarriageReturn(void)
-{
-    m_nCursorX = 0;
-}
-
-void CTRenderer::ClearDisplay(void)
-{
-    m_nCursorX = 0;
-    m_nCursorY = 0;
-    ClearDisplayEnd();
-}
 
-void CTRenderer::ClearDisplayEnd(void)
-{
-    ClearLineEnd();
+    case StateDcs:
+        if ('0' <= chChar && chChar <= '9')
+        {
+            unsigned &param = m_Params[m_nParamCount - 1];
+            if (param <= MaxParamValue)
+            {
+                param = param * 10 + (chChar - '0');
+            }
+        }
+        else if (chChar == ';')
+        {
+            if (m_nParamCount < MaxParams)
+            {
+                m_Params[m_nParamCount++] = 0;
+            }
+        }
+        else if (chChar == 'q')
+        {
+            BeginSixel();
+            m_State = StateSixel;
+        }
+        else if (chChar == '\x1b')
+        {
+            m_State = StateDcsEscape;
+        }
+        else
+        {
+            m_State = StateDcsIgnore;
+        }
+        break;
 
-    unsigned nPosY = m_nCursorY + m_pCharGen->GetCharHeight();
-    unsigned nOffset = nPosY * m_nWidth;
+    case StateSixel:
+        if (chChar == '\x1b')
+        {
+            EndSixel();
+            m_State = StateDcsEscape;
+        }
+        else if (chChar == '\x18' || chChar == '\x1a')
+        {
+            // CAN/SUB abort the string
+            EndSixel();
+            m_State = StateStart;
+        }
+        else
+        {
+            m_pSixel->Write(chChar);
+        }
+        break;
 
-    switch (m_nDepth)
+    case StateDcsIgnore:
+        if (chChar == '\x1b')
+        {
+            m_State = StateDcsEscape;
+        }
+        else if (chChar == '\x18' || chChar == '\x1a')
+        {
+            m_State = StateStart;
+        }
+        break;
+
+    case StateDcsEscape:
+        // ST (ESC \) ends the string; any other escape sequence is executed
+        m_State = StateEscape;
+        if (chChar == '\\')
+        {
+            m_State = StateStart;
+        }
+        else
+        {
+            Write(chChar);
+        }
+        break;
+
+    case StateAutoPage:
+        switch (chChar)
+        {
+        case '+':
+            SetAutoPageMode(TRUE);
+            m_State = StateStart;
+            break;
+
+        case '*':
+            SetAutoPageMode(FALSE);
+            m_State = StateStart;
+            break;
+
+        default:
+            m_State = StateStart;
+            break;
+        }
+        break;
+
+    default:
+        m_State = StateStart;
+        break;
+    }
+}
+
+VT100_COLD void CTRenderer::WriteVT52Escape(char chChar)
+{
+    switch (chChar)
     {
-    case 1:
+    case 'A':
+        CursorUp();
+        m_State = StateStart;
+        break;
+
+    case 'B':
+        CursorDown();
+        m_State = StateStart;
+        break;
+
+    case 'C':
+        CursorRight();
+        m_State = StateStart;
+        break;
+
+    case 'D':
+        CursorLeft();
+        m_State = StateStart;
+        break;
+
+    case 'H':
+        // VT52 cursor home
+        m_nCursorX = 0;
+        m_nCursorY = 0;
+        m_State = StateStart;
+        break;
+
+    case 'I':
+        ReverseScroll();
+        m_State = StateStart;
+        break;
+
+    case 'J':
+        ClearDisplayEnd();
+        m_State = StateStart;
+        break;
+
+    case 'K':
+        ClearLineEnd();
+        m_State = StateStart;
+        break;
+
+    case 'Y':
+        m_State = StateVT52Row;
+        break;
+
+    case '<':
+        // switch to ANSI mode
+        m_bVT52Mode = FALSE;
+        m_State = StateStart;
+        break;
+
+    case '=':
+        // alternate keypad mode
+        m_bKeypadApplication = TRUE;
+        m_State = StateStart;
+        break;
+
+    case '>':
+        m_bKeypadApplication = FALSE;
+        m_State = StateStart;
+        break;
+
+    default:
+        m_State = StateStart;
+        break;
+    }
+}
+
+VT100_COLD void CTRenderer::SetLineSize(char chChar)
+{
+    // The font is shared by all consoles; background consoles ignore line size changes
+    switch (chChar)
     {
-        nOffset /= 8;
-        unsigned nSize = m_nSize - nOffset;
-        for (u8 *pBuffer = m_pBuffer8 + nOffset; nSize--;)
+    case '3':
+        // Double Width double Height top half -> ignore, as we do not support double height
+        ResolveJumpScroll();
+        if (m_bRasterise)
+        {
+            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsDoubleBoth);
+        }
+        m_State = StateStart;
+        break;
+    case '4':
+        // Double Width double Height bottom half -> ignore, as we do not support double height
+        m_State = StateSkipTillCRLF;
+        break;
+    case '5':
+        // Standard DEC font mode using currently selected VT100 font family
+        ResolveJumpScroll();
+        if (m_bRasterise)
+        {
+            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsNone);
+        }
+        m_State = StateStart;
+        break;
+    case '6':
+        // Double width mode using currently selected VT100 font family
+        ResolveJumpScroll();
+        if (m_bRasterise)
         {
-            *pBuffer++ = m_BackgroundColor ? 0xFF : 0;
+            SetFont(m_CurrentFontSelection, CCharGenerator::FontFlagsDoubleWidth);
         }
+        m_State = StateStart;
+        break;
+    case '8':
+        // Screen test pattern -> ignore
+        m_State = StateStart;
+        break;
+    default:
+        m_State = StateStart;
+        break;
     }
-    break;
+}
 
-    case 8:
+VT100_COLD void CTRenderer::SetTabStopAtCursor(boolean bEnabled)
+{
+    CTConfig *config = CTConfig::Get();
+    if (config != nullptr && m_pCharGen != nullptr)
     {
-        unsigned nSize = m_nSize - nOffset;
-        for (u8 *pBuffer = m_pBuffer8 + nOffset; nSize--;)
+        const unsigned charWidth = m_pCharGen->GetCharWidth();
+        if (charWidth != 0)
         {
-            *pBuffer++ = (u8)m_BackgroundColor;
+            config->SetTabStop(m_nCursorX / charWidth, bEnabled);
         }
     }
-    break;
+}
 
-    case 16:
+VT100_COLD void CTRenderer::ClearTabStops(void)
+{
+    CTConfig *config = CTConfig::Get();
+    if (config != nullptr)
     {
-        unsigned nSize = m_nSize / 2 - nOffset;
-        for (u16 *pBuffer = m_pBuffer16 + nOffset; nSize--;)
+        for (unsigned col = 0; col < CTConfig::TabStopsMax; ++col)
         {
-            *pBuffer++ = (u16)m_BackgroundColor;
+            config->SetTabStop(col, false);
         }
     }
-    break;
+}
 
-    case 32:
+VT100_COLD void CTRenderer::CheckMarginBell(void)
+{
+    CTConfig *config = CTConfig::Get();
+    if (config == nullptr || config->GetBuzzerVolume() == 0U)
     {
-        unsigned nSize = m_nSize / 4 - nOffset;
-        for (u32 *pBuffer = m_pBuffer32 + nOffset; nSize--;)
+        return;
+    }
+
+    const unsigned cols = GetColumns();
+    if (cols > 8U && m_pCharGen != nullptr)
+    {
+        const unsigned currentCol = m_nCursorX / m_pCharGen->GetCharWidth();
+        const unsigned bellCol = cols - 9U;
+        if (currentCol == bellCol)
         {
-            *pBuffer++ = (u32)m_BackgroundColor;
+            CHAL::Get()->BEEP();
         }
     }
-    break;
+}
+
+VT100_HOT void CTRenderer::CarriageReturn(void)
+{
+    m_nCursorX = 0;
+}
+
+void CTRenderer::ClearDisplay(void)
+{
+    m_nCursorX = 0;
+    m_nCursorY = 0;
+    ClearDisplayEnd();
+}
+
+void CTRenderer::ClearDisplayEnd(void)
+{
+    ClearLineEnd();
+
+    unsigned nPosY = m_nCursorY + m_pCharGen->GetCharHeight();
+
+    m_Cells.EraseRows(nPosY / m_pCharGen->GetCharHeight(), m_Cells.GetRows());
+
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
+    if (m_nCursorX == 0 && m_nCursorY <= m_nGraphicsY1)
+    {
+        m_nGraphicsY1 = 1;
+        m_nGraphicsY2 = 0;
+    }
+
+    if (nPosY < m_nHeight)
+    {
+        FillLines(nPosY, m_nHeight - 1, m_BackgroundColor);
     }
 
     SetUpdateArea(m_nCursorY, m_nHeight - 1);
 }
 
-void CTRenderer::ClearLineEnd(void)
+VT100_HOT void CTRenderer::ClearLineEnd(void)
 {
+    if (m_nCursorX == 0)
+    {
+        // The whole row including the right margin: a blank row
+        const unsigned nRow = m_nCursorY / m_pCharGen->GetCharHeight();
+        m_Cells.EraseRange(nRow, 0, m_Cells.GetColumns());
+        if (m_bRasterise)
+        {
+            FillLines(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1, m_BackgroundColor);
+            SetUpdateArea(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1);
+        }
+        return;
+    }
+
     for (unsigned nPosX = m_nCursorX; nPosX < m_nUsedWidth; nPosX += m_pCharGen->GetCharWidth())
     {
         EraseChar(nPosX, m_nCursorY);
     }
 
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
+    TouchLines(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1);
     for (unsigned nPosX = m_nUsedWidth; nPosX < m_nWidth; nPosX++)
     {
         for (unsigned nPosY = m_nCursorY;
@@ -1841,9 +2841,14 @@ void CTRenderer::ClearLineEnd(void)
             SetRawPixel(nPosX, nPosY, m_BackgroundColor);
         }
     }
+
+    if (m_nUsedWidth < m_nWidth)
+    {
+        SetUpdateArea(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1, m_nUsedWidth, m_nWidth - 1);
+    }
 }
 
-void CTRenderer::CursorDown(void)
+VT100_HOT void CTRenderer::CursorDown(void)
 {
     m_nCursorY += m_pCharGen->GetCharHeight();
     if (m_nCursorY >= m_nScrollEnd)
@@ -1867,7 +2872,7 @@ void CTRenderer::CursorHome(void)
     m_nCursorY = m_nScrollStart;
 }
 
-void CTRenderer::CursorLeft(void)
+VT100_HOT void CTRenderer::CursorLeft(void)
 {
     if (m_nCursorX > 0)
     {
@@ -1883,7 +2888,7 @@ void CTRenderer::CursorLeft(void)
     }
 }
 
-void CTRenderer::CursorMove(unsigned nRow, unsigned nColumn)
+VT100_HOT void CTRenderer::CursorMove(unsigned nRow, unsigned nColumn)
 {
     unsigned nPosX = (nColumn - 1) * m_pCharGen->GetCharWidth();
     unsigned nPosY = (nRow - 1) * m_pCharGen->GetCharHeight();
@@ -1895,7 +2900,7 @@ void CTRenderer::CursorMove(unsigned nRow, unsigned nColumn)
     }
 }
 
-void CTRenderer::CursorRight(void)
+VT100_HOT void CTRenderer::CursorRight(void)
 {
     m_nCursorX += m_pCharGen->GetCharWidth();
     if (m_nCursorX >= m_nUsedWidth)
@@ -1948,6 +2953,20 @@ void CTRenderer::DeleteChars(unsigned nCount) // TODO
     const unsigned endY = m_nCursorY + charHeight;
     const unsigned shiftEndX = m_nUsedWidth - pixelWidth;
 
+    m_Cells.DeleteChars(m_nCursorY / charHeight, m_nCursorX / charWidth, pixelWidth / charWidth);
+
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
+    if (m_bDirectRender && !HasGraphics(startY, endY - 1))
+    {
+        RedrawCells(m_nCursorY / charHeight, m_nCursorX / charWidth, m_Cells.GetColumns());
+        return;
+    }
+
+    TouchLines(startY, endY - 1);
     for (unsigned y = startY; y < endY; ++y)
     {
         for (unsigned x = m_nCursorX; x < shiftEndX; ++x)
@@ -1993,6 +3012,13 @@ void CTRenderer::DeleteLines(unsigned nCount) // TODO
         nCount = maxLines;
     }
 
+    m_Cells.ScrollUp(m_nCursorY / charHeight, m_nScrollEnd / charHeight, nCount);
+
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
     bool smoothStarted = false;
     unsigned startTicks = 0;
     if (nCount == 1)
@@ -2005,59 +3031,18 @@ void CTRenderer::DeleteLines(unsigned nCount) // TODO
         startTicks = CTimer::Get()->GetTicks();
     }
 
-    const unsigned lineBytes = m_nPitch * charHeight;
-    const unsigned startOffset = m_nCursorY * m_nPitch;
-    const unsigned endOffset = m_nScrollEnd * m_nPitch;
-    const unsigned deleteBytes = lineBytes * nCount;
-    const unsigned moveBytes = endOffset - startOffset - deleteBytes;
-
-    if (moveBytes > 0)
-    {
-        memmove(m_pBuffer8 + startOffset, m_pBuffer8 + startOffset + deleteBytes, moveBytes);
-    }
-
-    u8 *pClear = m_pBuffer8 + endOffset - deleteBytes;
-    unsigned clearBytes = deleteBytes;
-    switch (m_nDepth)
-    {
-    case 1:
+    if (m_bDirectRender && !HasGraphics(m_nCursorY, m_nScrollEnd - 1))
     {
-        const u8 fill = m_BackgroundColor ? 0xFF : 0x00;
-        while (clearBytes--)
-        {
-            *pClear++ = fill;
-        }
+        RedrawRows(m_nCursorY / charHeight, m_nScrollEnd / charHeight, -static_cast<int>(nCount));
     }
-    break;
-
-    case 8:
-        while (clearBytes--)
-        {
-            *pClear++ = (u8)m_BackgroundColor;
-        }
-        break;
-
-    case 16:
+    else
     {
-        u16 *p16 = reinterpret_cast<u16 *>(pClear);
-        unsigned count = clearBytes / 2;
-        while (count--)
-        {
-            *p16++ = (u16)m_BackgroundColor;
-        }
-    }
-    break;
+        MoveGraphics(m_nCursorY, m_nScrollEnd - 1, -static_cast<int>(nCount * charHeight));
 
-    case 32:
-    {
-        u32 *p32 = reinterpret_cast<u32 *>(pClear);
-        unsigned count = clearBytes / 4;
-        while (count--)
-        {
-            *p32++ = (u32)m_BackgroundColor;
-        }
-    }
-    break;
+        const unsigned deleteLines = nCount * charHeight;
+        MoveLines(m_nCursorY, m_nCursorY + deleteLines, m_nScrollEnd - m_nCursorY - deleteLines);
+        FillLines(m_nScrollEnd - deleteLines, m_nScrollEnd - 1, m_BackgroundColor);
+        RepairOverlayRows(m_nCursorY / charHeight, m_nScrollEnd / charHeight, static_cast<int>(nCount));
     }
 
     SetUpdateArea(m_nCursorY, m_nScrollEnd - 1);
@@ -2070,7 +3055,7 @@ void CTRenderer::DeleteLines(unsigned nCount) // TODO
     }
 }
 
-void CTRenderer::DisplayChar(char chChar)
+VT100_HOT void CTRenderer::DisplayChar(char chChar)
 {
     // TODO: Insert mode
 
@@ -2094,6 +3079,11 @@ void CTRenderer::DisplayChar(char chChar)
             m_pCharGen = pOriginalGen;
         }
 
+        m_Cells.PutChar(m_nCursorY / m_pCharGen->GetCharHeight(),
+                        m_nCursorX / m_pCharGen->GetCharWidth(),
+                        static_cast<u8>(chChar),
+                        GetCellAttributes() | (bUseGraphics ? CTCellBuffer::AttrGraphics : 0));
+
         bool wrapAroundEnabled = true;
         CTConfig *config = CTConfig::Get();
         if (config != nullptr)
@@ -2143,12 +3133,12 @@ void CTRenderer::EraseChars(unsigned nCount)
     }
 }
 
-CDisplay::TRawColor CTRenderer::GetTextBackgroundColor(void)
+VT100_HOT CDisplay::TRawColor CTRenderer::GetTextBackgroundColor(void)
 {
     return m_bReverseAttribute ? AdjustBrightness565(m_ForegroundColor, m_ReverseBackgroundScaleFactor) : m_BackgroundColor;
 }
 
-CDisplay::TRawColor CTRenderer::GetTextColor(void)
+VT100_HOT CDisplay::TRawColor CTRenderer::GetTextColor(void)
 {
     if (m_bReverseAttribute)
     {
@@ -2187,6 +3177,13 @@ void CTRenderer::InsertLines(unsigned nCount) // TODO
         nCount = maxLines;
     }
 
+    m_Cells.ScrollDown(m_nCursorY / charHeight, m_nScrollEnd / charHeight, nCount);
+
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
     bool smoothStarted = false;
     unsigned startTicks = 0;
     if (nCount == 1)
@@ -2199,59 +3196,18 @@ void CTRenderer::InsertLines(unsigned nCount) // TODO
         startTicks = CTimer::Get()->GetTicks();
     }
 
-    const unsigned lineBytes = m_nPitch * charHeight;
-    const unsigned startOffset = m_nCursorY * m_nPitch;
-    const unsigned endOffset = m_nScrollEnd * m_nPitch;
-    const unsigned insertBytes = lineBytes * nCount;
-    const unsigned moveBytes = endOffset - startOffset - insertBytes;
-
-    if (moveBytes > 0)
+    if (m_bDirectRender && !HasGraphics(m_nCursorY, m_nScrollEnd - 1))
     {
-        memmove(m_pBuffer8 + startOffset + insertBytes, m_pBuffer8 + startOffset, moveBytes);
+        RedrawRows(m_nCursorY / charHeight, m_nScrollEnd / charHeight, static_cast<int>(nCount));
     }
-
-    u8 *pClear = m_pBuffer8 + startOffset;
-    unsigned clearBytes = insertBytes;
-    switch (m_nDepth)
-    {
-    case 1:
+    else
     {
-        const u8 fill = m_BackgroundColor ? 0xFF : 0x00;
-        while (clearBytes--)
-        {
-            *pClear++ = fill;
-        }
-    }
-    break;
-
-    case 8:
-        while (clearBytes--)
-        {
-            *pClear++ = (u8)m_BackgroundColor;
-        }
-        break;
-
-    case 16:
-    {
-        u16 *p16 = reinterpret_cast<u16 *>(pClear);
-        unsigned count = clearBytes / 2;
-        while (count--)
-        {
-            *p16++ = (u16)m_BackgroundColor;
-        }
-    }
-    break;
-
-    case 32:
-    {
-        u32 *p32 = reinterpret_cast<u32 *>(pClear);
-        unsigned count = clearBytes / 4;
-        while (count--)
-        {
-            *p32++ = (u32)m_BackgroundColor;
-        }
-    }
-    break;
+        MoveGraphics(m_nCursorY, m_nScrollEnd - 1, static_cast<int>(nCount * charHeight));
+
+        const unsigned insertLines = nCount * charHeight;
+        MoveLines(m_nCursorY + insertLines, m_nCursorY, m_nScrollEnd - m_nCursorY - insertLines);
+        FillLines(m_nCursorY, m_nCursorY + insertLines - 1, m_BackgroundColor);
+        RepairOverlayRows(m_nCursorY / charHeight, m_nScrollEnd / charHeight, -static_cast<int>(nCount));
     }
 
     SetUpdateArea(m_nCursorY, m_nScrollEnd - 1);
@@ -2278,7 +3234,7 @@ void CTRenderer::SetSmoothScrollEnabled(boolean bEnable)
     }
 }
 
-void CTRenderer::NewLine(void)
+VT100_HOT void CTRenderer::NewLine(void)
 {
     CarriageReturn();
     CursorDown();
@@ -2297,7 +3253,7 @@ void CTRenderer::SetAutoPageMode(boolean bEnable)
     m_bAutoPage = bEnable;
 }
 
-void CTRenderer::SetBrightnessScaling(float boldFactor,
+VT100_COLD void CTRenderer::SetBrightnessScaling(float boldFactor,
                                       float reverseBackgroundFactor,
                                       float reverseForegroundFactor)
 {
@@ -2326,7 +3282,7 @@ void CTRenderer::SetCursorMode(boolean bVisible)
     m_bCursorOn = bVisible;
 }
 
-void CTRenderer::SetVT52Mode(boolean bEnable)
+VT100_COLD void CTRenderer::SetVT52Mode(boolean bEnable)
 {
     m_bVT52Mode = bEnable;
 }
@@ -2360,7 +3316,7 @@ void CTRenderer::SetScrollRegion(unsigned nStartRow, unsigned nEndRow)
 }
 
 // TODO: standout mode should be useable together with one other mode
-void CTRenderer::SetStandoutMode(unsigned nMode)
+VT100_HOT void CTRenderer::SetStandoutMode(unsigned nMode)
 {
     switch (nMode)
     {
@@ -2405,7 +3361,7 @@ void CTRenderer::SetStandoutMode(unsigned nMode)
     }
 }
 
-void CTRenderer::Tabulator(void)
+VT100_HOT void CTRenderer::Tabulator(void)
 {
     if (m_pCharGen == nullptr)
     {
@@ -2545,67 +3501,56 @@ void CTRenderer::RestoreCursor(void)
     m_SpinLock.Release();
 }
 
-void CTRenderer::Scroll(void)
+VT100_HOT void CTRenderer::Scroll(void)
 {
     unsigned nLines = m_pCharGen->GetCharHeight();
 
-    const bool smoothStarted = BeginSmoothScrollAnimation(m_nScrollStart, m_nScrollEnd - 1, FALSE) ? true : false;
-    unsigned startTicks = 0;
-    if (!smoothStarted)
+    if (m_bRasterise)
     {
-        startTicks = CTimer::Get()->GetTicks();
+        ++m_nRateWindowScrolls;
+        if (ChooseScrollMode() == ScrollModeJump)
+        {
+            BeginJumpScroll();
+        }
     }
-
-    u8 *pTo = m_pBuffer8 + m_nScrollStart * m_nPitch;
-    u8 *pFrom = m_pBuffer8 + (m_nScrollStart + nLines) * m_nPitch;
-
-    unsigned nSize = m_nPitch * (m_nScrollEnd - m_nScrollStart - nLines);
-    if (nSize)
+    else if (m_bJumpPending)
     {
-        memcpy(pTo, pFrom, nSize);
-
-        pTo += nSize;
+        ++m_nRateWindowScrolls;
     }
 
-    nSize = m_nWidth * nLines;
-    switch (m_nDepth)
-    {
-    case 1:
-    {
-        nSize /= 8;
-        for (u8 *p = (u8 *)pTo; nSize--;)
-        {
-            *p++ = m_BackgroundColor ? 0xFF : 0;
-        }
-    }
-    break;
+    m_Cells.ScrollUp(m_nScrollStart / nLines, m_nScrollEnd / nLines, 1);
 
-    case 8:
+    if (!m_bRasterise)
     {
-        for (u8 *p = (u8 *)pTo; nSize--;)
+        if (m_bJumpPending)
         {
-            *p++ = (u8)m_BackgroundColor;
+            if (m_nScrollStart / nLines == m_nJumpTopRow && m_nScrollEnd / nLines == m_nJumpEndRow)
+            {
+                ++m_nJumpLines;
+            }
         }
+        return;
     }
-    break;
 
-    case 16:
+    const bool smoothStarted = BeginSmoothScrollAnimation(m_nScrollStart, m_nScrollEnd - 1, FALSE) ? true : false;
+    unsigned startTicks = 0;
+    if (!smoothStarted)
     {
-        for (u16 *p = (u16 *)pTo; nSize--;)
-        {
-            *p++ = (u16)m_BackgroundColor;
-        }
+        startTicks = CTimer::Get()->GetTicks();
     }
-    break;
 
-    case 32:
+    if (m_bDirectRender && !HasGraphics(m_nScrollStart, m_nScrollEnd - 1))
     {
-        for (u32 *p = (u32 *)pTo; nSize--;)
-        {
-            *p++ = (u32)m_BackgroundColor;
-        }
+        // The cell grid has scrolled already; redraw what changed instead of reading the framebuffer back
+        RedrawRows(m_nScrollStart / nLines, m_nScrollEnd / nLines, -1);
     }
-    break;
+    else
+    {
+        MoveGraphics(m_nScrollStart, m_nScrollEnd - 1, -static_cast<int>(nLines));
+
+        MoveLines(m_nScrollStart, m_nScrollStart + nLines, m_nScrollEnd - m_nScrollStart - nLines);
+        FillLines(m_nScrollEnd - nLines, m_nScrollEnd - 1, m_BackgroundColor);
+        RepairOverlayRows(m_nScrollStart / nLines, m_nScrollEnd / nLines, 1);
     }
 
     SetUpdateArea(0, m_nHeight - 1);
@@ -2618,9 +3563,14 @@ void CTRenderer::Scroll(void)
     }
 }
 
-void CTRenderer::DisplayChar(char chChar, unsigned nPosX, unsigned nPosY,
+VT100_HOT void CTRenderer::DisplayChar(char chChar, unsigned nPosX, unsigned nPosY,
                              CDisplay::TRawColor nColor)
 {
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
     if (nColor != m_BackgroundColor)
     {
         if (m_bBoldAttribute)
@@ -2633,52 +3583,122 @@ void CTRenderer::DisplayChar(char chChar, unsigned nPosX, unsigned nPosY,
         }
     }
 
-    for (unsigned y = 0; y < m_pCharGen->GetCharHeight(); y++)
-    {
-        CCharGenerator::TPixelLine Line = m_pCharGen->GetPixelLine(chChar, y);
+    const CDisplay::TRawColor nBackground = GetTextBackgroundColor();
+    const unsigned nWidth = m_pCharGen->GetCharWidth();
+    const unsigned nHeight = m_pCharGen->GetCharHeight();
+    const unsigned nUnderlineRow = m_bUnderlineAttribute ? m_pCharGen->GetUnderline() : nHeight;
 
-        for (unsigned x = 0; x < m_pCharGen->GetCharWidth(); x++)
-        {
-            const bool isGlyphPixel = m_pCharGen->GetPixel(x, Line);
-            const CDisplay::TRawColor pixelColor = isGlyphPixel ? nColor : GetTextBackgroundColor();
-            SetRawPixel(nPosX + x, nPosY + y, pixelColor);
-        }
+    TouchLines(nPosY, nPosY + nHeight - 1);
+
+    // Pre-shaded glyph: one level lookup per pixel whatever the CRT effects
+    const TCrtGlyphAtlas *pAtlas = m_pCharGen == m_pGraphicsCharGen ? m_pGraphicsGlyphAtlas : m_pGlyphAtlas;
+    const CDisplay::TRawColor *pRamp = nullptr;
+    const u8 *pLevels = nullptr;
+    u64 nRowMask = 0;
+    if (pAtlas != nullptr)
+    {
+        pRamp = GetShadeRamp(nColor, nBackground);
+        pLevels = pAtlas->GetGlyph(chChar);
+        nRowMask = pAtlas->GetRowMask(chChar);
     }
 
-    if (m_bBoldAttribute)
+    // Underline and bold overstrike are merged in, so every pixel is stored once;
+    // in direct mode these stores go straight to the framebuffer
+    for (unsigned y = 0; y < nHeight; y++)
     {
-        // Overstrike once to simulate a thick stroke
-        for (unsigned y = 0; y < m_pCharGen->GetCharHeight(); y++)
+        if (y == nUnderlineRow)
+        {
+            for (unsigned x = 0; x < nWidth; x++)
+            {
+                SetRawPixel(nPosX + x, nPosY + y, nColor);
+            }
+        }
+        else if (pLevels != nullptr && !m_bBoldAttribute)
+        {
+            if (m_nDepth == 16)
+            {
+                // Common case: store a whole glyph line through one pointer;
+                // blank lines (level 0 is the background) need no lookups
+                u16 *pLine = &m_pBuffer16[m_nWidth * (nPosY + y) + nPosX];
+                if ((nRowMask >> y & 1) == 0)
+                {
+                    const u16 nFill = static_cast<u16>(pRamp[0]);
+                    for (unsigned x = 0; x < nWidth; x++)
+                    {
+                        pLine[x] = nFill;
+                    }
+                }
+                else
+                {
+                    for (unsigned x = 0; x < nWidth; x++)
+                    {
+                        pLine[x] = static_cast<u16>(pRamp[pLevels[x]]);
+                    }
+                }
+            }
+            else
+            {
+                for (unsigned x = 0; x < nWidth; x++)
+                {
+                    SetRawPixel(nPosX + x, nPosY + y, pRamp[pLevels[x]]);
+                }
+            }
+        }
+        else
         {
             CCharGenerator::TPixelLine Line = m_pCharGen->GetPixelLine(chChar, y);
+            boolean bPrevious = FALSE;
 
-            for (unsigned x = 1; x < m_pCharGen->GetCharWidth(); x++)
+            for (unsigned x = 0; x < nWidth; x++)
             {
-                if (m_pCharGen->GetPixel(x - 1, Line))
+                const boolean bGlyphPixel = m_pCharGen->GetPixel(x, Line) ? TRUE : FALSE;
+                CDisplay::TRawColor nPixel;
+                if (m_bBoldAttribute && bPrevious)
+                {
+                    // Overstrike once to simulate a thick stroke
+                    nPixel = nColor;
+                }
+                else if (pLevels != nullptr)
+                {
+                    nPixel = pRamp[pLevels[x]];
+                }
+                else
                 {
-                    SetRawPixel(nPosX + x, nPosY + y, nColor);
+                    nPixel = bGlyphPixel ? nColor : nBackground;
                 }
+
+                SetRawPixel(nPosX + x, nPosY + y, nPixel);
+                bPrevious = bGlyphPixel;
             }
         }
-    }
 
-    if (m_bUnderlineAttribute)
-    {
-        const unsigned underlineRow = m_pCharGen->GetUnderline();
-        if (underlineRow < m_pCharGen->GetCharHeight())
+        if (pLevels != nullptr)
         {
-            for (unsigned x = 0; x < m_pCharGen->GetCharWidth(); x++)
-            {
-                SetRawPixel(nPosX + x, nPosY + underlineRow, nColor);
-            }
+            pLevels += nWidth;
         }
     }
 
-    SetUpdateArea(nPosY, nPosY + m_pCharGen->GetCharHeight() - 1);
+    SetUpdateArea(nPosY, nPosY + nHeight - 1, nPosX, nPosX + nWidth - 1);
 }
 
-void CTRenderer::EraseChar(unsigned nPosX, unsigned nPosY)
+VT100_HOT void CTRenderer::EraseChar(unsigned nPosX, unsigned nPosY)
 {
+    const unsigned column = nPosX / m_pCharGen->GetCharWidth();
+    m_Cells.EraseRange(nPosY / m_pCharGen->GetCharHeight(), column, column + 1);
+
+    if (!m_bRasterise)
+    {
+        return;
+    }
+
+    // Nothing to erase in a row that is still blank in the background color
+    const unsigned nPosY2 = nPosY + m_pCharGen->GetCharHeight() - 1;
+    if (m_pBlankLines[nPosY].blank && m_pBlankLines[nPosY].color == m_BackgroundColor && m_pBlankLines[nPosY2].blank)
+    {
+        return;
+    }
+
+    TouchLines(nPosY, nPosY2);
     for (unsigned y = 0; y < m_pCharGen->GetCharHeight(); y++)
     {
         for (unsigned x = 0; x < m_pCharGen->GetCharWidth(); x++)
@@ -2687,16 +3707,17 @@ void CTRenderer::EraseChar(unsigned nPosX, unsigned nPosY)
         }
     }
 
-    SetUpdateArea(nPosY, nPosY + m_pCharGen->GetCharHeight() - 1);
+    SetUpdateArea(nPosY, nPosY2, nPosX, nPosX + m_pCharGen->GetCharWidth() - 1);
 }
 
-void CTRenderer::InvertCursor(void)
+VT100_HOT void CTRenderer::InvertCursor(void)
 {
-    if (!m_bCursorOn)
+    if (!m_bCursorOn || !m_bRasterise)
     {
         return;
     }
 
+    TouchLines(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1);
     CDisplay::TRawColor *pPixelData = m_pCursorPixels;
     unsigned y0 = m_bCursorBlock ? 0 : m_pCharGen->GetUnderline();
 
@@ -2722,6 +3743,36 @@ void CTRenderer::InvertCursor(void)
             break;
         }
     }
+
+    // Direct mode: compose the cursor cell from the cell grid in the row cache
+    // instead of reading the framebuffer back
+    const unsigned nRow = m_nCursorY / m_pCharGen->GetCharHeight();
+    const unsigned nColumn = m_nCursorX / m_pCharGen->GetCharWidth();
+    const boolean bFromCache = !m_bCursorVisible && m_bDirectRender && m_pCellRowCache != nullptr
+                               && nRow < m_Cells.GetRows() && nColumn < m_Cells.GetColumns()
+                               && !HasGraphics(m_nCursorY, m_nCursorY + m_pCharGen->GetCharHeight() - 1);
+    if (bFromCache)
+    {
+        // The cache holds the character row at m_nCursorY with the framebuffer's addressing
+        u8 *pFrameBuffer = m_pBuffer8;
+        m_pBuffer8 = reinterpret_cast<u8 *>(reinterpret_cast<uintptr>(m_pCellRowCache) - m_nCursorY * m_nPitch);
+
+        const u8 attributes = GetCellAttributes();
+        RenderCell(nRow, nColumn);
+        ApplyCellAttributes(attributes);
+
+        for (unsigned y = y0; y < m_pCharGen->GetCharHeight(); y++)
+        {
+            for (unsigned x = 0; x < m_pCharGen->GetCharWidth(); x++)
+            {
+                *pPixelData++ = GetRawPixel(m_nCursorX + x, m_nCursorY + y);
+            }
+        }
+
+        m_pBuffer8 = pFrameBuffer;
+        pPixelData = m_pCursorPixels;
+    }
+
     for (unsigned y = y0; y < m_pCharGen->GetCharHeight(); y++)
     {
         for (unsigned x = 0; x < m_pCharGen->GetCharWidth(); x++)
@@ -2729,8 +3780,16 @@ void CTRenderer::InvertCursor(void)
             if (!m_bCursorVisible)
             {
                 // Store the old pixel
-                const CDisplay::TRawColor storedPixel = GetRawPixel(m_nCursorX + x, m_nCursorY + y);
-                *pPixelData++ = storedPixel;
+                CDisplay::TRawColor storedPixel;
+                if (bFromCache)
+                {
+                    storedPixel = *pPixelData++;
+                }
+                else
+                {
+                    storedPixel = GetRawPixel(m_nCursorX + x, m_nCursorY + y);
+                    *pPixelData++ = storedPixel;
+                }
 
                 // Plot the cursor by inverting the stored pixel
                 SetRawPixel(m_nCursorX + x, m_nCursorY + y, storedPixel ^ invertMask);
@@ -2745,10 +3804,11 @@ void CTRenderer::InvertCursor(void)
 
     m_bCursorVisible = !m_bCursorVisible;
 
-    SetUpdateArea(m_nCursorY + y0, m_nCursorY + m_pCharGen->GetCharHeight() - 1);
+    SetUpdateArea(m_nCursorY + y0, m_nCursorY + m_pCharGen->GetCharHeight() - 1,
+                  m_nCursorX, m_nCursorX + m_pCharGen->GetCharWidth() - 1);
 }
 
-void CTRenderer::doRenderTest(void)
+VT100_COLD void CTRenderer::doRenderTest(void)
 {
     static boolean once = true;
     if (!once)
@@ -2897,142 +3957,1093 @@ void CTRenderer::doRenderTest(void)
     }
 }
 
-void CTRenderer::SaveState(TRendererState &state)
+VT100_COLD u32 CTRenderer::TakeSnapshot(void)
 {
     m_SpinLock.Acquire();
-    state.font = m_pFont;
-    state.fontFlags = m_FontFlags;
-    state.foreground = m_ForegroundColor;
-    state.background = m_BackgroundColor;
-    state.defaultForeground = m_DefaultForegroundColor;
-    state.defaultBackground = m_DefaultBackgroundColor;
-    state.cursorX = m_nCursorX;
-    state.cursorY = m_nCursorY;
-    state.cursorOn = m_bCursorOn;
-    state.cursorBlock = m_bCursorBlock;
-    state.cursorVisible = m_bCursorVisible;
-    state.blinking = m_bBlinkingCursor;
-    state.blinkTicks = m_nCursorBlinkPeriodTicks;
-    state.nextBlink = m_nNextCursorBlink;
-    state.scrollStart = m_nScrollStart;
-    state.scrollEnd = m_nScrollEnd;
-    state.reverseAttribute = m_bReverseAttribute;
-    state.boldAttribute = m_bBoldAttribute;
-    state.underlineAttribute = m_bUnderlineAttribute;
-    state.blinkAttribute = m_bBlinkAttribute;
-    state.insertOn = m_bInsertOn;
-    state.autoPage = m_bAutoPage;
-    state.delayedUpdate = m_bDelayedUpdate;
-    state.lastUpdateTicks = m_nLastUpdateTicks;
-    state.parserState = static_cast<unsigned>(m_State);
-    state.param1 = m_nParam1;
-    state.param2 = m_nParam2;
-    state.g0CharSet = static_cast<unsigned>(m_G0CharSet);
-    state.g1CharSet = static_cast<unsigned>(m_G1CharSet);
-    state.useG1 = m_bUseG1;
-    m_SpinLock.Release();
-}
 
-void CTRenderer::RestoreState(const TRendererState &state)
-{
-    if (m_bCursorVisible && m_bCursorOn)
+    if (m_pCharGen == nullptr || m_pBuffer8 == nullptr || m_Snapshot.id != 0)
     {
-        m_SpinLock.Acquire();
-        InvertCursor();
         m_SpinLock.Release();
+        return 0;
     }
 
-    if (state.font != nullptr)
+    // Allocated once; in shadow mode they alternate with the live lines
+    if (m_Snapshot.pixels == nullptr)
+    {
+        m_Snapshot.pixels = new u8[m_nSize];
+    }
+    if (m_Snapshot.blankLines == nullptr)
+    {
+        m_Snapshot.blankLines = new TBlankLine[m_nHeight];
+        if (m_Snapshot.blankLines != nullptr)
+        {
+            memset(m_Snapshot.blankLines, 0, m_nHeight * sizeof(TBlankLine));
+        }
+    }
+    if (m_Snapshot.pixels == nullptr || m_Snapshot.blankLines == nullptr)
     {
-        SetFont(*state.font, state.fontFlags);
+        m_SpinLock.Release();
+        LOGWARN("No memory for a terminal snapshot");
+        return 0;
     }
 
-    const unsigned restoredCursorX = (state.cursorX < m_nWidth) ? state.cursorX : 0;
-    const unsigned restoredCursorY = (state.cursorY < m_nHeight) ? state.cursorY : 0;
+    // A pending jump leaves pixels behind the cell grid and rasterising off
+    ResolveJumpScroll();
+    BeginOverlay();
+    m_bSmoothScrollActive = FALSE;
 
-    m_SpinLock.Acquire();
-    m_ForegroundColor = state.foreground;
-    m_BackgroundColor = state.background;
-    m_DefaultForegroundColor = state.defaultForeground;
-    m_DefaultBackgroundColor = state.defaultBackground;
-    m_nCursorX = restoredCursorX;
-    m_nCursorY = restoredCursorY;
-    m_bCursorOn = state.cursorOn;
-    m_bCursorBlock = state.cursorBlock;
-    m_bCursorVisible = state.cursorVisible;
-    m_bBlinkingCursor = state.blinking;
-    m_nCursorBlinkPeriodTicks = state.blinkTicks ? state.blinkTicks : 1;
-    m_nNextCursorBlink = state.nextBlink ? state.nextBlink : CTimer::Get()->GetTicks();
-    m_nScrollStart = state.scrollStart;
-    m_nScrollEnd = state.scrollEnd;
-    m_bReverseAttribute = state.reverseAttribute;
-    m_bBoldAttribute = state.boldAttribute;
-    m_bUnderlineAttribute = state.underlineAttribute;
-    m_bBlinkAttribute = state.blinkAttribute;
-    m_bInsertOn = state.insertOn;
-    m_bAutoPage = state.autoPage;
-    m_bDelayedUpdate = state.delayedUpdate;
-    m_nLastUpdateTicks = state.lastUpdateTicks;
-    m_State = static_cast<TState>(state.parserState);
-    m_nParam1 = state.param1;
-    m_nParam2 = state.param2;
-    m_G0CharSet = static_cast<ECharacterSet>(state.g0CharSet);
-    m_G1CharSet = static_cast<ECharacterSet>(state.g1CharSet);
-    m_bUseG1 = state.useG1;
-    m_SpinLock.Release();
+    m_Snapshot.font = m_pFont;
+    m_Snapshot.fontSelection = m_CurrentFontSelection;
+    m_Snapshot.fontFlags = m_FontFlags;
+    m_Snapshot.foreground = m_ForegroundColor;
+    m_Snapshot.background = m_BackgroundColor;
+    m_Snapshot.defaultForeground = m_DefaultForegroundColor;
+    m_Snapshot.defaultBackground = m_DefaultBackgroundColor;
+    m_Snapshot.cursorVisible = m_bOverlayCursorVisible;
+    m_Snapshot.cursorBlock = m_bCursorBlock;
+    m_Snapshot.blinkingCursor = m_bBlinkingCursor;
+    m_Snapshot.blinkPeriodTicks = m_nCursorBlinkPeriodTicks;
+    CTConfig *pConfig = CTConfig::Get();
+    for (unsigned i = 0; i < CTConfig::TabStopsMax; ++i)
+    {
+        m_Snapshot.tabStops[i] = pConfig->IsTabStop(i);
+    }
+
+    // The terminal state moves out; the state of the last snapshot comes back
+    // reset, so the dialog starts like a terminal after power-on
+    ResetConsoleState(m_Snapshot.console, m_nUsedHeight);
+    ExchangeConsole(m_Snapshot.console);
+    FitConsoleGeometry();
+    m_Cells.Clear();
+    m_Snapshot.console.sixel->DetachTarget();
 
-    if (m_bCursorVisible && m_bCursorOn)
+    if (m_bDirectRender)
     {
-        m_SpinLock.Acquire();
-        InvertCursor();
-        m_SpinLock.Release();
+        // The pixels are the framebuffer the dialog is about to draw into
+        CopyLines(m_Snapshot.pixels, 0, m_nHeight);
     }
-}
+    else
+    {
+        ExchangeValue(m_pBuffer8, m_Snapshot.pixels);
+        ExchangeValue(m_pBlankLines, m_Snapshot.blankLines);
+    }
+    m_Snapshot.graphicsY1 = m_nGraphicsY1;
+    m_Snapshot.graphicsY2 = m_nGraphicsY2;
+    m_nGraphicsY1 = 1;
+    m_nGraphicsY2 = 0;
 
-size_t CTRenderer::GetBufferSize(void) const
-{
-    return m_nSize;
+    ClearPixels();
+    SetUpdateArea(0, m_nHeight - 1);
+    m_OverlayAttributes = GetCellAttributes();
+
+    if (++m_nSnapshotSerial == 0)
+    {
+        ++m_nSnapshotSerial;
+    }
+    m_Snapshot.id = m_nSnapshotSerial;
+    const u32 nSnapshot = m_Snapshot.id;
+
+    // Only marked: the dialog's first write or the next Update() presents it
+    EndOverlay(FALSE);
+
+    ReleaseAndDeliverReplies(m_nActiveConsole);
+    return nSnapshot;
 }
 
-void CTRenderer::SaveScreenBuffer(void *buffer, size_t bufferSize)
+VT100_COLD boolean CTRenderer::RestoreSnapshot(u32 nSnapshot, boolean bRestoreTabStops)
 {
-    if (buffer == nullptr || m_pBuffer8 == nullptr)
+    m_SpinLock.Acquire();
+
+    if (nSnapshot == 0 || nSnapshot != m_Snapshot.id)
     {
-        return;
+        m_SpinLock.Release();
+        return FALSE;
+    }
+
+    const boolean bFontChanged = m_pFont != m_Snapshot.font || m_FontFlags != m_Snapshot.fontFlags
+                                 || m_CurrentFontSelection != m_Snapshot.fontSelection;
+    m_SpinLock.Release();
+
+    // The parked cell grid and pixels have the geometry of the font they were drawn in
+    if (bFontChanged)
+    {
+        m_CurrentFontSelection = m_Snapshot.fontSelection;
+        SetFont(*m_Snapshot.font, m_Snapshot.fontFlags);
+    }
+
+    m_SpinLock.Acquire();
+
+    ResolveJumpScroll();
+    BeginOverlay();
+    m_bSmoothScrollActive = FALSE;
+
+    ExchangeConsole(m_Snapshot.console);
+    FitConsoleGeometry();
+    m_Snapshot.console.sixel->DetachTarget();
+
+    if (m_bDirectRender)
+    {
+        memcpy(m_pBuffer8, m_Snapshot.pixels, m_nSize);
+    }
+    else
+    {
+        ExchangeValue(m_pBuffer8, m_Snapshot.pixels);
+        ExchangeValue(m_pBlankLines, m_Snapshot.blankLines);
+    }
+    m_nGraphicsY1 = m_Snapshot.graphicsY1;
+    m_nGraphicsY2 = m_Snapshot.graphicsY2;
+
+    m_ForegroundColor = m_Snapshot.foreground;
+    m_BackgroundColor = m_Snapshot.background;
+    m_DefaultForegroundColor = m_Snapshot.defaultForeground;
+    m_DefaultBackgroundColor = m_Snapshot.defaultBackground;
+    m_bCursorBlock = m_Snapshot.cursorBlock;
+    m_bBlinkingCursor = m_Snapshot.blinkingCursor;
+    m_nCursorBlinkPeriodTicks = m_Snapshot.blinkPeriodTicks;
+    m_nNextCursorBlink = CTimer::Get()->GetTicks() + m_nCursorBlinkPeriodTicks;
+
+    // EndOverlay() shows the cursor as it was when the snapshot was taken
+    m_bOverlayCursorVisible = m_Snapshot.cursorVisible;
+
+    if (bRestoreTabStops)
+    {
+        CTConfig *pConfig = CTConfig::Get();
+        for (unsigned i = 0; i < CTConfig::TabStopsMax; ++i)
+        {
+            pConfig->SetTabStop(i, m_Snapshot.tabStops[i]);
+        }
     }
-    if (bufferSize < m_nSize)
+
+    m_Cells.TouchAll();
+    SetUpdateArea(0, m_nHeight - 1);
+    m_OverlayAttributes = GetCellAttributes();
+    m_Snapshot.id = 0;
+
+    // Only marked; the next Update() presents the terminal screen once
+    EndOverlay(FALSE);
+
+    ReleaseAndDeliverReplies(m_nActiveConsole);
+    return TRUE;
+}
+
+VT100_COLD void CTRenderer::GetResumeState(TResumeState &state) const
+{
+    memset(&state, 0, sizeof(state));
+    if (m_pCharGen == nullptr)
     {
         return;
     }
 
+    const unsigned charWidth = m_pCharGen->GetCharWidth();
+    const unsigned charHeight = m_pCharGen->GetCharHeight();
+
     m_SpinLock.Acquire();
-    memcpy(buffer, m_pBuffer8, m_nSize);
+    state.columns = m_Cells.GetColumns();
+    state.rows = m_Cells.GetRows();
+    state.cursorColumn = m_nCursorX / charWidth;
+    state.cursorRow = m_nCursorY / charHeight;
+    state.scrollTopRow = m_nScrollStart / charHeight;
+    state.scrollEndRow = m_nScrollEnd / charHeight;
+    state.attributes = GetCellAttributes();
+    state.g0CharSet = static_cast<u8>(m_G0CharSet);
+    state.g1CharSet = static_cast<u8>(m_G1CharSet);
+    state.modes = (m_bUseG1 ? ResumeModeUseG1 : 0)
+                | (m_bInsertOn ? ResumeModeInsert : 0)
+                | (m_bAutoPage ? ResumeModeAutoPage : 0)
+                | (m_bVT52Mode ? ResumeModeVT52 : 0)
+                | (m_bCursorOn ? ResumeModeCursorOn : 0)
+                | (m_bCursorKeyApplication ? ResumeModeCursorKeys : 0)
+                | (m_bKeypadApplication ? ResumeModeKeypad : 0);
+    state.fontFlags = static_cast<u8>(m_FontFlags);
     m_SpinLock.Release();
 }
 
-void CTRenderer::RestoreScreenBuffer(const void *buffer, size_t bufferSize)
+VT100_COLD boolean CTRenderer::ApplyResumeState(const TResumeState &state, const CTCellBuffer::TCell *pCells, size_t nCellCount)
 {
-    if (buffer == nullptr || m_pBuffer8 == nullptr)
+    if (pCells == nullptr || m_pCharGen == nullptr || m_pFrameBuffer == nullptr)
     {
-        return;
+        return FALSE;
     }
-    if (bufferSize < m_nSize)
+
+    if (state.fontFlags != static_cast<u8>(m_FontFlags))
     {
-        return;
+        SetFont(m_CurrentFontSelection, static_cast<CCharGenerator::TFontFlags>(state.fontFlags));
     }
 
+    const unsigned columns = GetColumns();
+    const unsigned rows = GetRows();
+    if (state.columns != columns || state.rows != rows || nCellCount < static_cast<size_t>(columns) * rows)
+    {
+        LOGWARN("Resume: saved screen %ux%u does not match %ux%u", state.columns, state.rows, columns, rows);
+        return FALSE;
+    }
+
+    const unsigned charWidth = m_pCharGen->GetCharWidth();
+    const unsigned charHeight = m_pCharGen->GetCharHeight();
+
     m_SpinLock.Acquire();
-    memcpy(m_pBuffer8, buffer, m_nSize);
-    m_UpdateArea.y1 = 0;
-    m_UpdateArea.y2 = m_nHeight ? (m_nHeight - 1) : 0;
-    if (m_pFrameBuffer != nullptr)
+
+    if (m_bCursorVisible)
     {
-        CDisplay::TArea area;
-        area.x1 = 0;
-        area.y1 = 0;
-        area.x2 = m_nWidth ? (m_nWidth - 1) : 0;
-        area.y2 = m_nHeight ? (m_nHeight - 1) : 0;
-        m_pFrameBuffer->SetArea(area, m_pBuffer8);
+        InvertCursor();
+    }
+    m_bCursorVisible = FALSE;
+
+    m_nCursorX = 0;
+    m_nCursorY = 0;
+    ClearDisplayEnd();
+
+    for (unsigned row = 0; row < rows; ++row)
+    {
+        m_Cells.SetRow(row, pCells + row * columns, columns);
+    }
+    RenderCells();
+
+    m_nCursorX = (state.cursorColumn < columns ? state.cursorColumn : columns - 1) * charWidth;
+    m_nCursorY = (state.cursorRow < rows ? state.cursorRow : rows - 1) * charHeight;
+
+    if (state.scrollTopRow < state.scrollEndRow && state.scrollEndRow <= rows)
+    {
+        m_nScrollStart = state.scrollTopRow * charHeight;
+        m_nScrollEnd = state.scrollEndRow * charHeight;
+    }
+
+    m_bBoldAttribute = (state.attributes & CTCellBuffer::AttrBold) ? TRUE : FALSE;
+    m_bUnderlineAttribute = (state.attributes & CTCellBuffer::AttrUnderline) ? TRUE : FALSE;
+    m_bBlinkAttribute = (state.attributes & CTCellBuffer::AttrBlink) ? TRUE : FALSE;
+    m_bReverseAttribute = (state.attributes & CTCellBuffer::AttrReverse) ? TRUE : FALSE;
+    m_bDimAttribute = (state.attributes & CTCellBuffer::AttrDim) ? TRUE : FALSE;
+
+    m_G0CharSet = state.g0CharSet == CharSetGraphics ? CharSetGraphics : CharSetUS;
+    m_G1CharSet = state.g1CharSet == CharSetGraphics ? CharSetGraphics : CharSetUS;
+    m_bUseG1 = (state.modes & ResumeModeUseG1) ? TRUE : FALSE;
+    m_bInsertOn = (state.modes & ResumeModeInsert) ? TRUE : FALSE;
+    m_bAutoPage = (state.modes & ResumeModeAutoPage) ? TRUE : FALSE;
+    m_bVT52Mode = (state.modes & ResumeModeVT52) ? TRUE : FALSE;
+    m_bCursorOn = (state.modes & ResumeModeCursorOn) ? TRUE : FALSE;
+    m_bCursorKeyApplication = (state.modes & ResumeModeCursorKeys) ? TRUE : FALSE;
+    m_bKeypadApplication = (state.modes & ResumeModeKeypad) ? TRUE : FALSE;
+    m_State = StateStart;
+
+    InvertCursor();
+
+    SetUpdateArea(0, m_nHeight - 1);
+    FlushUpdateArea();
+
+    ReleaseAndDeliverReplies(m_nActiveConsole);
+
+    return TRUE;
+}
+
+u32 CTRenderer::GetCellGeneration(void) const
+{
+    return m_Cells.GetGeneration();
+}
+
+u32 CTRenderer::GetCellRowGeneration(unsigned nRow) const
+{
+    return m_Cells.GetRowGeneration(nRow);
+}
+
+unsigned CTRenderer::CopyCellRow(unsigned nRow, CTCellBuffer::TCell *pDest, unsigned nMaxCells, u32 *pGeneration) const
+{
+    if (pDest == nullptr)
+    {
+        return 0;
+    }
+
+    m_SpinLock.Acquire();
+
+    const CTCellBuffer::TCell *pRow = m_Cells.GetRow(nRow);
+    unsigned count = 0;
+    if (pRow != nullptr)
+    {
+        count = m_Cells.GetColumns() < nMaxCells ? m_Cells.GetColumns() : nMaxCells;
+        memcpy(pDest, pRow, count * sizeof(CTCellBuffer::TCell));
+    }
+
+    if (pGeneration != nullptr)
+    {
+        *pGeneration = m_Cells.GetRowGeneration(nRow);
+    }
+
+    m_SpinLock.Release();
+
+    return count;
+}
+
+u8 CTRenderer::GetCellAttributes(void) const
+{
+    return (m_bBoldAttribute ? CTCellBuffer::AttrBold : 0)
+         | (m_bUnderlineAttribute ? CTCellBuffer::AttrUnderline : 0)
+         | (m_bBlinkAttribute ? CTCellBuffer::AttrBlink : 0)
+         | (m_bReverseAttribute ? CTCellBuffer::AttrReverse : 0)
+         | (m_bDimAttribute ? CTCellBuffer::AttrDim : 0);
+}
+
+VT100_COLD void CTRenderer::RenderCells(void)
+{
+    // Attributes are switched per cell, the caller restores the rendition
+    for (unsigned row = 0; row < m_Cells.GetRows(); ++row)
+    {
+        const CTCellBuffer::TCell *pRow = m_Cells.GetRow(row);
+        for (unsigned column = 0; column < m_Cells.GetColumns(); ++column)
+        {
+            const CTCellBuffer::TCell &cell = pRow[column];
+            if (cell.ch == CTCellBuffer::BlankChar
+                && (cell.attr & (CTCellBuffer::AttrReverse | CTCellBuffer::AttrUnderline)) == 0)
+            {
+                continue;
+            }
+
+            RenderCell(row, column);
+        }
+    }
+}
+
+VT100_HOT void CTRenderer::RenderCell(unsigned nRow, unsigned nColumn)
+{
+    const CTCellBuffer::TCell *pRow = m_Cells.GetRow(nRow);
+    if (pRow == nullptr || nColumn >= m_Cells.GetColumns())
+    {
+        return;
+    }
+
+    const CTCellBuffer::TCell &cell = pRow[nColumn];
+    m_bBoldAttribute = (cell.attr & CTCellBuffer::AttrBold) ? TRUE : FALSE;
+    m_bUnderlineAttribute = (cell.attr & CTCellBuffer::AttrUnderline) ? TRUE : FALSE;
+    m_bReverseAttribute = (cell.attr & CTCellBuffer::AttrReverse) ? TRUE : FALSE;
+    m_bDimAttribute = (cell.attr & CTCellBuffer::AttrDim) ? TRUE : FALSE;
+
+    CCharGenerator *pTextGen = m_pCharGen;
+    if ((cell.attr & CTCellBuffer::AttrGraphics) && m_pGraphicsCharGen != nullptr)
+    {
+        m_pCharGen = m_pGraphicsCharGen;
+    }
+
+    DisplayChar(static_cast<char>(cell.ch), nColumn * pTextGen->GetCharWidth(),
+                nRow * pTextGen->GetCharHeight(), GetTextColor());
+    m_pCharGen = pTextGen;
+}
+
+VT100_COLD void CTRenderer::ReportAreaChecksum(void)
+{
+    // Parameters: Pi (request id), Pg (page, ignored), Pt;Pl;Pb;Pr (1-based, inclusive)
+    const unsigned rows = m_Cells.GetRows();
+    const unsigned columns = m_Cells.GetColumns();
+    const unsigned id = m_nParamCount > 0 ? m_Params[0] : 0;
+    const unsigned top = m_nParamCount > 2 && m_Params[2] != 0 ? m_Params[2] : 1;
+    const unsigned left = m_nParamCount > 3 && m_Params[3] != 0 ? m_Params[3] : 1;
+    const unsigned bottom = m_nParamCount > 4 && m_Params[4] != 0 ? m_Params[4] : rows;
+    const unsigned right = m_nParamCount > 5 && m_Params[5] != 0 ? m_Params[5] : columns;
+
+    // The VT420 reports the two's complement of the sum
+    const u16 sum = m_Cells.GetChecksum(top - 1, bottom, left - 1, right);
+    const u16 checksum = static_cast<u16>(0U - sum);
+
+    CString reply;
+    reply.Format("\x1BP%u!~%04X\x1B\\", id, checksum);
+    QueueReply(reply.c_str(), reply.GetLength());
+}
+
+void CTRenderer::QueueReply(const char *pData, size_t nLength)
+{
+    if (m_pReplyHandler == nullptr || pData == nullptr)
+    {
+        return;
+    }
+
+    if (nLength > ReplyBufferSize - m_nReplyLength)
+    {
+        LOGWARN("Host report dropped (%u bytes pending)", static_cast<unsigned>(m_nReplyLength));
+        return;
+    }
+
+    memcpy(m_ReplyBuffer + m_nReplyLength, pData, nLength);
+    m_nReplyLength += nLength;
+}
+
+boolean CTRenderer::GetCell(unsigned nRow, unsigned nColumn, CTCellBuffer::TCell &rCell) const
+{
+    m_SpinLock.Acquire();
+    const CTCellBuffer::TCell *pRow = m_Cells.GetRow(nRow);
+    const boolean bValid = pRow != nullptr && nColumn < m_Cells.GetColumns();
+    if (bValid)
+    {
+        rCell = pRow[nColumn];
+    }
+    m_SpinLock.Release();
+
+    return bValid;
+}
+
+void CTRenderer::ApplyCellAttributes(u8 nAttributes)
+{
+    m_bBoldAttribute = (nAttributes & CTCellBuffer::AttrBold) ? TRUE : FALSE;
+    m_bUnderlineAttribute = (nAttributes & CTCellBuffer::AttrUnderline) ? TRUE : FALSE;
+    m_bBlinkAttribute = (nAttributes & CTCellBuffer::AttrBlink) ? TRUE : FALSE;
+    m_bReverseAttribute = (nAttributes & CTCellBuffer::AttrReverse) ? TRUE : FALSE;
+    m_bDimAttribute = (nAttributes & CTCellBuffer::AttrDim) ? TRUE : FALSE;
+}
+
+VT100_HOT void CTRenderer::RedrawCells(unsigned nRow, unsigned nColumnStart, unsigned nColumnEnd)
+{
+    const u8 attributes = GetCellAttributes();
+    for (unsigned column = nColumnStart; column < nColumnEnd; ++column)
+    {
+        RenderCell(nRow, column);
+    }
+    ApplyCellAttributes(attributes);
+}
+
+VT100_HOT void CTRenderer::RedrawRows(unsigned nRowStart, unsigned nRowEnd, int nMoved)
+{
+    // Screen row r still shows what the grid now holds in row r + nMoved. Cells
+    // that already show the right glyph are skipped, the others are written once.
+    // A row that showed overlay lines holds no grid content, so the row moved
+    // into its place is drawn in full.
+    const unsigned columns = m_Cells.GetColumns();
+    const u8 attributes = GetCellAttributes();
+    for (unsigned row = nRowStart; row < nRowEnd; ++row)
+    {
+        const int shown = static_cast<int>(row) + nMoved;
+        const CTCellBuffer::TCell *pShown = nullptr;
+        if (shown >= static_cast<int>(nRowStart) && shown < static_cast<int>(nRowEnd)
+            && (!IsOverlayRow(static_cast<unsigned>(shown)) || IsOverlayRow(row)))
+        {
+            pShown = m_Cells.GetRow(static_cast<unsigned>(shown));
+        }
+
+        const CTCellBuffer::TCell *pRow = m_Cells.GetRow(row);
+        for (unsigned column = 0; column < columns; ++column)
+        {
+            if (pShown != nullptr && pShown[column].ch == pRow[column].ch && pShown[column].attr == pRow[column].attr)
+            {
+                continue;
+            }
+
+            RenderCell(row, column);
+        }
+    }
+    ApplyCellAttributes(attributes);
+}
+
+void CTRenderer::RepairOverlayRows(unsigned nRowStart, unsigned nRowEnd, int nMoved)
+{
+    if (m_nOverlayTopRow >= m_nOverlayEndRow)
+    {
+        return;
+    }
+
+    // The pixels moved with the region, the overlay rows stay where they were:
+    // rows outside them that now show overlay pixels are drawn from the grid
+    for (unsigned row = nRowStart; row < nRowEnd; ++row)
+    {
+        const int shown = static_cast<int>(row) + nMoved;
+        if (shown >= static_cast<int>(nRowStart) && shown < static_cast<int>(nRowEnd)
+            && IsOverlayRow(static_cast<unsigned>(shown)) && !IsOverlayRow(row))
+        {
+            RedrawCells(row, 0, m_Cells.GetColumns());
+        }
+    }
+}
+
+VT100_HOT void CTRenderer::FlushUpdateArea(void)
+{
+    // In direct mode the pixels are on screen already
+    if (!m_bDirectRender)
+    {
+        PresentLines(m_UpdateArea.y1, m_UpdateArea.y2, m_UpdateArea.x1, m_UpdateArea.x2);
+    }
+
+    m_UpdateArea.x1 = m_nWidth;
+    m_UpdateArea.x2 = 0;
+    m_UpdateArea.y1 = m_nHeight;
+    m_UpdateArea.y2 = 0;
+}
+
+void CTRenderer::MoveGraphics(unsigned nStartY, unsigned nEndY, int nPixels)
+{
+    if (m_nGraphicsY1 > m_nGraphicsY2 || !HasGraphics(nStartY, nEndY))
+    {
+        return;
+    }
+
+    if (m_nGraphicsY1 < nStartY || m_nGraphicsY2 > nEndY)
+    {
+        // Partly outside the region: keep the union, it is only used to avoid redraws
+        m_nGraphicsY1 = m_nGraphicsY1 < nStartY ? m_nGraphicsY1 : nStartY;
+        m_nGraphicsY2 = m_nGraphicsY2 > nEndY ? m_nGraphicsY2 : nEndY;
+        return;
+    }
+
+    const int posY1 = static_cast<int>(m_nGraphicsY1) + nPixels;
+    const int posY2 = static_cast<int>(m_nGraphicsY2) + nPixels;
+    if (posY2 < static_cast<int>(nStartY) || posY1 > static_cast<int>(nEndY))
+    {
+        // Scrolled out of the region
+        m_nGraphicsY1 = 1;
+        m_nGraphicsY2 = 0;
+        return;
+    }
+
+    m_nGraphicsY1 = posY1 < static_cast<int>(nStartY) ? nStartY : static_cast<unsigned>(posY1);
+    m_nGraphicsY2 = posY2 > static_cast<int>(nEndY) ? nEndY : static_cast<unsigned>(posY2);
+}
+
+void CTRenderer::MaterialiseLines(unsigned nPosY1, unsigned nPosY2)
+{
+    if (!m_bBlankLines)
+    {
+        return;
+    }
+
+    // Whole character rows, so TouchLines() can go by the first and last line
+    const unsigned charHeight = m_pCharGen != nullptr ? m_pCharGen->GetCharHeight() : 1;
+    if (nPosY1 < m_nUsedHeight)
+    {
+        nPosY1 -= nPosY1 % charHeight;
+    }
+    if (nPosY2 < m_nUsedHeight)
+    {
+        nPosY2 += charHeight - 1 - nPosY2 % charHeight;
+    }
+    if (nPosY2 >= m_nHeight)
+    {
+        nPosY2 = m_nHeight - 1;
+    }
+
+    for (unsigned nPosY = nPosY1; nPosY <= nPosY2; ++nPosY)
+    {
+        if (m_pBlankLines[nPosY].blank)
+        {
+            FillPixelLines(m_pBuffer8 + nPosY * m_nPitch, 1, m_nPitch, m_pBlankLines[nPosY].color);
+            m_pBlankLines[nPosY].blank = FALSE;
+        }
+    }
+}
+
+VT100_HOT void CTRenderer::FillLines(unsigned nPosY1, unsigned nPosY2, CDisplay::TRawColor nColor)
+{
+    if (!m_bBlankLines)
+    {
+        FillPixelLines(m_pBuffer8 + nPosY1 * m_nPitch, nPosY2 - nPosY1 + 1, m_nPitch, nColor);
+        return;
+    }
+
+    for (unsigned nPosY = nPosY1; nPosY <= nPosY2; ++nPosY)
+    {
+        m_pBlankLines[nPosY].color = nColor;
+        m_pBlankLines[nPosY].blank = TRUE;
+    }
+}
+
+VT100_HOT void CTRenderer::MoveLines(unsigned nToY, unsigned nFromY, unsigned nCount)
+{
+    if (nCount == 0)
+    {
+        return;
+    }
+
+    u8 *pTo = m_pBuffer8 + nToY * m_nPitch;
+    const u8 *pFrom = m_pBuffer8 + nFromY * m_nPitch;
+    if (!m_bBlankLines)
+    {
+        memmove(pTo, pFrom, static_cast<size_t>(nCount) * m_nPitch);
+        return;
+    }
+
+    // Only runs of stored lines are copied, in the order that keeps later sources intact
+    const TBlankLine *pState = m_pBlankLines + nFromY;
+    if (nToY < nFromY)
+    {
+        unsigned nLine = 0;
+        while (nLine < nCount)
+        {
+            if (pState[nLine].blank)
+            {
+                ++nLine;
+                continue;
+            }
+
+            unsigned nEnd = nLine + 1;
+            while (nEnd < nCount && !pState[nEnd].blank)
+            {
+                ++nEnd;
+            }
+            memmove(pTo + nLine * m_nPitch, pFrom + nLine * m_nPitch, static_cast<size_t>(nEnd - nLine) * m_nPitch);
+            nLine = nEnd;
+        }
+    }
+    else
+    {
+        unsigned nLine = nCount;
+        while (nLine > 0)
+        {
+            if (pState[nLine - 1].blank)
+            {
+                --nLine;
+                continue;
+            }
+
+            unsigned nStart = nLine - 1;
+            while (nStart > 0 && !pState[nStart - 1].blank)
+            {
+                --nStart;
+            }
+            memmove(pTo + nStart * m_nPitch, pFrom + nStart * m_nPitch, static_cast<size_t>(nLine - nStart) * m_nPitch);
+            nLine = nStart;
+        }
+    }
+
+    memmove(m_pBlankLines + nToY, m_pBlankLines + nFromY, nCount * sizeof(TBlankLine));
+}
+
+void CTRenderer::CopyLines(u8 *pDest, unsigned nPosY, unsigned nCount)
+{
+    for (unsigned nLine = 0; nLine < nCount; ++nLine, pDest += m_nPitch)
+    {
+        const TBlankLine &rState = m_pBlankLines[nPosY + nLine];
+        if (rState.blank)
+        {
+            FillPixelLines(pDest, 1, m_nPitch, rState.color);
+        }
+        else
+        {
+            memcpy(pDest, m_pBuffer8 + (nPosY + nLine) * m_nPitch, m_nPitch);
+        }
+    }
+}
+
+VT100_HOT void CTRenderer::FillPixelLines(u8 *pLine, unsigned nCount, unsigned nPitch, CDisplay::TRawColor nColor)
+{
+    for (unsigned nLine = 0; nLine < nCount; ++nLine, pLine += nPitch)
+    {
+        switch (m_nDepth)
+        {
+        case 1:
+            memset(pLine, nColor ? 0xFF : 0, m_nWidth / 8);
+            break;
+
+        case 8:
+            memset(pLine, static_cast<u8>(nColor), m_nWidth);
+            break;
+
+        case 16:
+        {
+            // Two pixels per store; lines of even width start word aligned
+            u16 *p16 = reinterpret_cast<u16 *>(pLine);
+            unsigned nPixels = m_nWidth;
+            if ((reinterpret_cast<uintptr>(p16) & 3) == 0)
+            {
+                const u32 nPair = static_cast<u16>(nColor) | static_cast<u32>(static_cast<u16>(nColor)) << 16;
+                u32 *p32 = reinterpret_cast<u32 *>(p16);
+                for (unsigned i = 0; i < nPixels / 2; ++i)
+                {
+                    p32[i] = nPair;
+                }
+                p16 += nPixels & ~1U;
+                nPixels &= 1;
+            }
+            while (nPixels--)
+            {
+                *p16++ = static_cast<u16>(nColor);
+            }
+        }
+        break;
+
+        case 32:
+        {
+            u32 *p32 = reinterpret_cast<u32 *>(pLine);
+            for (unsigned i = 0; i < m_nWidth; ++i)
+            {
+                p32[i] = static_cast<u32>(nColor);
+            }
+        }
+        break;
+        }
+    }
+}
+
+VT100_HOT void CTRenderer::PresentLines(unsigned nPosY1, unsigned nPosY2, unsigned nPosX1, unsigned nPosX2)
+{
+    const unsigned nBytesPerPixel = m_nDepth / 8;
+    const unsigned nLineBytes = m_nWidth * nBytesPerPixel;
+    unsigned nFirstByte = 0;
+    unsigned nEndByte = nLineBytes;
+    if (nPosX1 <= nPosX2 && nPosX2 < m_nWidth)
+    {
+        // Whole bursts only: the rounding costs less than partial bus writes
+        nFirstByte = CTBlit::AlignDown(nPosX1 * nBytesPerPixel);
+        nEndByte = CTBlit::AlignUp((nPosX2 + 1) * nBytesPerPixel, nLineBytes);
+    }
+
+    CDisplay::TArea area;
+    area.x1 = 0;
+    area.x2 = m_nWidth - 1;
+
+    boolean bInPlace = FALSE;
+    unsigned nPosY = nPosY1;
+    while (nPosY <= nPosY2)
+    {
+        if (!m_pBlankLines[nPosY].blank)
+        {
+            unsigned nEnd = nPosY;
+            while (nEnd < nPosY2 && !m_pBlankLines[nEnd + 1].blank)
+            {
+                ++nEnd;
+            }
+
+            if (m_pFramePixels != nullptr)
+            {
+                CTBlit::Copy(m_pFramePixels + nPosY * m_nFramePitch + nFirstByte, m_nFramePitch,
+                             m_pBuffer8 + nPosY * m_nPitch + nFirstByte, m_nPitch,
+                             nEndByte - nFirstByte, nEnd - nPosY + 1);
+                bInPlace = TRUE;
+            }
+            else
+            {
+                area.y1 = nPosY;
+                area.y2 = nEnd;
+                m_pFrameBuffer->SetArea(area, m_pBuffer8 + nPosY * m_nPitch);
+            }
+            ForgetShownLines(nPosY, nEnd);
+            ++m_nPerfBlits;
+            nPosY = nEnd + 1;
+            continue;
+        }
+
+        // A blank line is filled in place, unless the framebuffer shows that color already
+        const CDisplay::TRawColor nColor = m_pBlankLines[nPosY].color;
+        if (!m_pShownLines[nPosY].blank || m_pShownLines[nPosY].color != nColor)
+        {
+            FillPixelLines(m_pFramePixels + nPosY * m_nFramePitch, 1, m_nFramePitch, nColor);
+            m_pShownLines[nPosY].color = nColor;
+            m_pShownLines[nPosY].blank = TRUE;
+            bInPlace = TRUE;
+        }
+        ++nPosY;
+    }
+
+    if (bInPlace)
+    {
+        ++m_nInPlaceCount;
+    }
+}
+
+void CTRenderer::ForgetShownLines(unsigned nPosY1, unsigned nPosY2)
+{
+    for (unsigned nPosY = nPosY1; nPosY <= nPosY2; ++nPosY)
+    {
+        m_pShownLines[nPosY].blank = FALSE;
+    }
+}
+
+void CTRenderer::DrawPredictedChar(unsigned nRow, unsigned nColumn, char chChar)
+{
+    m_SpinLock.Acquire();
+    if (m_pCharGen != nullptr && nRow < m_Cells.GetRows() && nColumn < m_Cells.GetColumns())
+    {
+        BeginOverlay();
+        m_bBoldAttribute = FALSE;
+        m_bReverseAttribute = FALSE;
+        m_bDimAttribute = TRUE;
+        m_bUnderlineAttribute = TRUE;
+        DisplayChar(chChar, nColumn * m_pCharGen->GetCharWidth(), nRow * m_pCharGen->GetCharHeight(),
+                    GetTextColor());
+        EndOverlay();
+    }
+    m_SpinLock.Release();
+}
+
+void CTRenderer::RefreshCell(unsigned nRow, unsigned nColumn)
+{
+    m_SpinLock.Acquire();
+    if (m_pCharGen != nullptr)
+    {
+        BeginOverlay();
+        RenderCell(nRow, nColumn);
+        EndOverlay();
+    }
+    m_SpinLock.Release();
+}
+
+VT100_COLD void CTRenderer::DrawOverlayLines(unsigned nFirstRow, const TOverlayLine *pLines, unsigned nCount)
+{
+    m_SpinLock.Acquire();
+    if (m_pCharGen != nullptr && pLines != nullptr)
+    {
+        BeginOverlay();
+        m_bReverseAttribute = TRUE;
+        m_bDimAttribute = FALSE;
+        m_bUnderlineAttribute = FALSE;
+
+        const unsigned columns = m_Cells.GetColumns();
+        const unsigned charWidth = m_pCharGen->GetCharWidth();
+        const unsigned charHeight = m_pCharGen->GetCharHeight();
+        for (unsigned i = 0; i < nCount && nFirstRow + i < m_Cells.GetRows(); ++i)
+        {
+            const TOverlayLine &line = pLines[i];
+            m_bBoldAttribute = line.bHighlight;
+            for (unsigned column = 0; column < columns; ++column)
+            {
+                const char chChar = column < line.nLength ? line.pText[column] : ' ';
+                DisplayChar(chChar, column * charWidth, (nFirstRow + i) * charHeight, GetTextColor());
+            }
+        }
+
+        const unsigned endRow = nFirstRow + nCount < m_Cells.GetRows() ? nFirstRow + nCount : m_Cells.GetRows();
+        if (m_nOverlayTopRow >= m_nOverlayEndRow)
+        {
+            m_nOverlayTopRow = nFirstRow;
+            m_nOverlayEndRow = endRow;
+        }
+        else
+        {
+            m_nOverlayTopRow = nFirstRow < m_nOverlayTopRow ? nFirstRow : m_nOverlayTopRow;
+            m_nOverlayEndRow = endRow > m_nOverlayEndRow ? endRow : m_nOverlayEndRow;
+        }
+        EndOverlay();
+    }
+    m_SpinLock.Release();
+}
+
+VT100_COLD void CTRenderer::RefreshRows(unsigned nRowStart, unsigned nRowEnd)
+{
+    m_SpinLock.Acquire();
+    if (m_pCharGen != nullptr)
+    {
+        BeginOverlay();
+        const unsigned rows = m_Cells.GetRows();
+        for (unsigned row = nRowStart; row < nRowEnd && row < rows; ++row)
+        {
+            RedrawCells(row, 0, m_Cells.GetColumns());
+        }
+        if (nRowStart <= m_nOverlayTopRow && nRowEnd >= m_nOverlayEndRow)
+        {
+            m_nOverlayTopRow = 0;
+            m_nOverlayEndRow = 0;
+        }
+        EndOverlay();
+    }
+    m_SpinLock.Release();
+}
+
+void CTRenderer::BeginOverlay(void)
+{
+    // DisplayChar() takes the rendition from the attribute flags, keep the host's
+    m_bOverlayCursorVisible = m_bCursorVisible;
+    if (m_bOverlayCursorVisible)
+    {
+        InvertCursor();
+    }
+
+    m_OverlayAttributes = GetCellAttributes();
+}
+
+void CTRenderer::EndOverlay(boolean bFlush)
+{
+    ApplyCellAttributes(m_OverlayAttributes);
+
+    if (m_bOverlayCursorVisible && m_bCursorOn)
+    {
+        InvertCursor();
+    }
+
+    if (bFlush && !m_bDelayedUpdate && !m_bSmoothScrollActive && m_UpdateArea.y1 <= m_UpdateArea.y2)
+    {
+        FlushUpdateArea();
+    }
+}
+
+void CTRenderer::ReleaseAndDeliverReplies(unsigned nConsole)
+{
+    // Deliver reports outside the lock so the handler may block on the host link
+    char reply[ReplyBufferSize];
+    const size_t nReplyLength = m_nReplyLength;
+    const ReplyHandler pReplyHandler = m_pReplyHandler;
+    if (nReplyLength > 0)
+    {
+        memcpy(reply, m_ReplyBuffer, nReplyLength);
+        m_nReplyLength = 0;
+    }
+
+    // The live state is the shown console again at this point
+    const unsigned nKeyModes = GetKeyModes();
+    const boolean bKeyModesChanged = nKeyModes != m_nReportedKeyModes;
+    const KeyModeHandler pKeyModeHandler = m_pKeyModeHandler;
+    m_nReportedKeyModes = nKeyModes;
+
+    m_SpinLock.Release();
+
+    if (nReplyLength > 0 && pReplyHandler != nullptr)
+    {
+        pReplyHandler(nConsole, reply, nReplyLength);
+    }
+
+    if (bKeyModesChanged && pKeyModeHandler != nullptr)
+    {
+        pKeyModeHandler(nKeyModes);
+    }
+}
+
+void CTRenderer::ResetConsoleState(TConsoleState &rConsole, unsigned nScrollEnd)
+{
+    rConsole.state = StateStart;
+    rConsole.param1 = 0;
+    rConsole.param2 = 0;
+    memset(rConsole.params, 0, sizeof(rConsole.params));
+    rConsole.paramCount = 0;
+    rConsole.cursorX = 0;
+    rConsole.cursorY = 0;
+    rConsole.cursorOn = TRUE;
+    rConsole.scrollStart = 0;
+    rConsole.scrollEnd = nScrollEnd;
+    rConsole.reverseAttribute = FALSE;
+    rConsole.boldAttribute = FALSE;
+    rConsole.dimAttribute = FALSE;
+    rConsole.underlineAttribute = FALSE;
+    rConsole.blinkAttribute = FALSE;
+    rConsole.insertOn = FALSE;
+    rConsole.vt52Mode = FALSE;
+    rConsole.cursorKeyApplication = FALSE;
+    rConsole.keypadApplication = FALSE;
+    rConsole.printerController = FALSE;
+    rConsole.printerMatch = 0;
+    rConsole.autoPage = FALSE;
+    rConsole.g0CharSet = CharSetUS;
+    rConsole.g1CharSet = CharSetGraphics;
+    rConsole.useG1 = FALSE;
+    memset(&rConsole.savedCursor, 0, sizeof(rConsole.savedCursor));
+}
+
+void CTRenderer::ExchangeConsole(TConsoleState &rConsole)
+{
+    // Font, colors and cursor shape are global; only terminal state moves
+    ExchangeValue(m_State, rConsole.state);
+    ExchangeValue(m_nParam1, rConsole.param1);
+    ExchangeValue(m_nParam2, rConsole.param2);
+    for (unsigned i = 0; i < MaxParams; ++i)
+    {
+        ExchangeValue(m_Params[i], rConsole.params[i]);
+    }
+    ExchangeValue(m_nParamCount, rConsole.paramCount);
+    ExchangeValue(m_nCursorX, rConsole.cursorX);
+    ExchangeValue(m_nCursorY, rConsole.cursorY);
+    ExchangeValue(m_bCursorOn, rConsole.cursorOn);
+    ExchangeValue(m_nScrollStart, rConsole.scrollStart);
+    ExchangeValue(m_nScrollEnd, rConsole.scrollEnd);
+    ExchangeValue(m_bReverseAttribute, rConsole.reverseAttribute);
+    ExchangeValue(m_bBoldAttribute, rConsole.boldAttribute);
+    ExchangeValue(m_bDimAttribute, rConsole.dimAttribute);
+    ExchangeValue(m_bUnderlineAttribute, rConsole.underlineAttribute);
+    ExchangeValue(m_bBlinkAttribute, rConsole.blinkAttribute);
+    ExchangeValue(m_bInsertOn, rConsole.insertOn);
+    ExchangeValue(m_bVT52Mode, rConsole.vt52Mode);
+    ExchangeValue(m_bCursorKeyApplication, rConsole.cursorKeyApplication);
+    ExchangeValue(m_bKeypadApplication, rConsole.keypadApplication);
+    ExchangeValue(m_bPrinterController, rConsole.printerController);
+    ExchangeValue(m_nPrinterMatch, rConsole.printerMatch);
+    ExchangeValue(m_bAutoPage, rConsole.autoPage);
+    ExchangeValue(m_G0CharSet, rConsole.g0CharSet);
+    ExchangeValue(m_G1CharSet, rConsole.g1CharSet);
+    ExchangeValue(m_bUseG1, rConsole.useG1);
+    ExchangeValue(m_SavedState, rConsole.savedCursor);
+    ExchangeValue(m_pSixel, rConsole.sixel);
+    m_Cells.Exchange(rConsole.cells);
+}
+
+VT100_COLD void CTRenderer::FitConsoleGeometry(void)
+{
+    const unsigned columns = GetColumns();
+    const unsigned rows = GetRows();
+    if (m_Cells.GetColumns() == columns && m_Cells.GetRows() == rows)
+    {
+        return;
+    }
+
+    // First use, or the font changed while the console was parked
+    if (!m_Cells.Resize(columns, rows))
+    {
+        LOGWARN("Console cell grid resize to %ux%u failed", columns, rows);
+    }
+
+    m_nCursorX = 0;
+    m_nCursorY = 0;
+    m_nScrollStart = 0;
+    m_nScrollEnd = m_nUsedHeight;
+}
+
+void CTRenderer::ClearPixels(void)
+{
+    FillLines(0, m_nHeight - 1, m_DefaultBackgroundColor);
+}
+
+VT100_COLD void CTRenderer::BeginSixel(void)
+{
+    // DCS P1;P2;P3 q: P2 = 1 keeps the pixels below zero bits; the aspect
+    // ratio (P1) and grid size (P3) are ignored, pixels are drawn 1:1
+    const boolean transparent = m_nParamCount >= 2 && m_Params[1] == 1;
+
+    // The image is drawn straight into the pixels, which must be current
+    ResolveJumpScroll();
+    if (m_bRasterise && m_nCursorY < m_nUsedHeight)
+    {
+        MaterialiseLines(m_nCursorY, m_nUsedHeight - 1);
+    }
+
+    CTSixelDecoder::TTarget target;
+    target.pBuffer = m_bRasterise ? m_pBuffer8 : nullptr;
+    target.nPitch = m_nPitch;
+    target.nDepth = m_nDepth;
+    target.nOriginX = m_nCursorX;
+    target.nOriginY = m_nCursorY;
+    target.nClipX = m_nUsedWidth;
+    target.nClipY = m_nUsedHeight;
+
+    m_pSixel->Begin(target, m_pFrameBuffer, transparent, GetTextBackgroundColor());
+}
+
+VT100_COLD void CTRenderer::EndSixel(void)
+{
+    m_pSixel->End();
+    FlushSixelDamage();
+
+    const unsigned height = m_pSixel->GetHeight();
+    if (height == 0 || m_pCharGen == nullptr)
+    {
+        return;
+    }
+
+    // Text continues on the line below the image, in the same column
+    const unsigned charHeight = m_pCharGen->GetCharHeight();
+    unsigned bottom = m_nCursorY + height - 1;
+    if (bottom >= m_nUsedHeight)
+    {
+        bottom = m_nUsedHeight - 1;
+    }
+    m_nCursorY = bottom / charHeight * charHeight;
+    CursorDown();
+}
+
+VT100_HOT void CTRenderer::FlushSixelDamage(void)
+{
+    unsigned posY1;
+    unsigned posY2;
+    if (m_pSixel->TakeDamage(posY1, posY2))
+    {
+        SetUpdateArea(posY1, posY2);
+
+        // Image pixels are not in the cell grid; direct mode must not redraw over them
+        if (m_nGraphicsY1 > m_nGraphicsY2)
+        {
+            m_nGraphicsY1 = posY1;
+            m_nGraphicsY2 = posY2;
+        }
+        else
+        {
+            m_nGraphicsY1 = posY1 < m_nGraphicsY1 ? posY1 : m_nGraphicsY1;
+            m_nGraphicsY2 = posY2 > m_nGraphicsY2 ? posY2 : m_nGraphicsY2;
+        }
     }
-    m_SpinLock.Release();
 }
@@ -0,0 +1,334 @@
+//------------------------------------------------------------------------------
+// Module:        CTSampleProfiler
+// Description:   Timer-interrupt program counter sampler with a fixed histogram.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include "TSampleProfiler.h"
+
+#include <circle/bcm2835.h>
+#include <circle/bcm2835int.h>
+#include <circle/logger.h>
+#include <circle/memio.h>
+#include <circle/memorymap.h>
+#include <circle/sched/scheduler.h>
+#include <circle/synchronize.h>
+#include <circle/timer.h>
+#include <circle/util.h>
+#include <fatfs/ff.h>
+
+LOGMODULE("TSampleProfiler");
+
+namespace
+{
+static const char ProfileFileName[] = "SD:/PROFILE.TXT";
+
+// BCM2835 ARM timer (ARM peripherals manual, chapter 14)
+static const uintptr ArmTimerLoad = ARM_IO_BASE + 0xB400;
+static const uintptr ArmTimerValue = ARM_IO_BASE + 0xB404;
+static const uintptr ArmTimerControl = ARM_IO_BASE + 0xB408;
+static const uintptr ArmTimerIrqClear = ARM_IO_BASE + 0xB40C;
+static const uintptr ArmTimerPreDivider = ARM_IO_BASE + 0xB41C;
+
+static const u32 ControlCounter32 = 1U << 1;
+static const u32 ControlIrqEnable = 1U << 5;
+static const u32 ControlEnable = 1U << 7;
+
+static const unsigned CalibrationUs = 10000;
+
+// Lines before the task and bucket lines of a dump
+static const unsigned HeaderLines = 1;
+}
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTSampleProfiler *s_pThis = nullptr;
+CTSampleProfiler *CTSampleProfiler::Get(void)
+{
+    if (s_pThis == nullptr)
+    {
+        s_pThis = new CTSampleProfiler();
+    }
+    return s_pThis;
+}
+
+CTSampleProfiler::CTSampleProfiler(void)
+    : m_pInterrupt(nullptr),
+      m_nTimerClockHz(0),
+      m_nRateHz(0),
+      m_bRunning(FALSE),
+      m_nStartTicks(0),
+      m_nSampledUs(0),
+      m_nSamples(0),
+      m_nDropped(0)
+{
+    memset(m_Buckets, 0, sizeof(m_Buckets));
+    memset(m_Tasks, 0, sizeof(m_Tasks));
+    strcpy(m_Tasks[0].Name, "-");
+}
+
+CTSampleProfiler::~CTSampleProfiler(void)
+{
+    Stop();
+    if (m_pInterrupt != nullptr)
+    {
+        m_pInterrupt->DisconnectIRQ(ARM_IRQ_ARM_TIMER);
+    }
+}
+
+boolean CTSampleProfiler::Initialize(CInterruptSystem *pInterrupt)
+{
+    if (m_pInterrupt != nullptr)
+    {
+        return TRUE;
+    }
+
+#if AARCH != 32
+    // The interrupted PC is read from the AArch32 IRQ stub's stack frame
+    LOGERR("PC sampling needs an AArch32 build");
+    return FALSE;
+#endif
+
+    if (pInterrupt == nullptr)
+    {
+        LOGERR("No interrupt system, PC sampling disabled");
+        return FALSE;
+    }
+
+    // The timer runs from the core clock; count it down against the system timer
+    write32(ArmTimerControl, 0);
+    write32(ArmTimerPreDivider, 0);
+    write32(ArmTimerLoad, 0xFFFFFFFFU);
+    write32(ArmTimerControl, ControlCounter32 | ControlEnable);
+    const u32 nFrom = read32(ArmTimerValue);
+    CTimer::SimpleusDelay(CalibrationUs);
+    const u32 nTo = read32(ArmTimerValue);
+    write32(ArmTimerControl, 0);
+
+    m_nTimerClockHz = (nFrom - nTo) * (1000000U / CalibrationUs);
+    if (m_nTimerClockHz < MaxRate * 100)
+    {
+        LOGERR("ARM timer clock %u Hz too slow, PC sampling disabled", m_nTimerClockHz);
+        return FALSE;
+    }
+
+    m_pInterrupt = pInterrupt;
+    m_pInterrupt->ConnectIRQ(ARM_IRQ_ARM_TIMER, InterruptHandler, this);
+    LOGNOTE("PC sampler ready, timer clock %u kHz, %u buckets", m_nTimerClockHz / 1000, Buckets);
+    return TRUE;
+}
+
+boolean CTSampleProfiler::Start(unsigned nRateHz)
+{
+    if (m_pInterrupt == nullptr)
+    {
+        return FALSE;
+    }
+
+    nRateHz = nRateHz < MinRate ? MinRate : nRateHz > MaxRate ? MaxRate : nRateHz;
+    Stop();
+
+    m_nRateHz = nRateHz;
+    m_nStartTicks = CTimer::GetClockTicks();
+    m_bRunning = TRUE;
+    write32(ArmTimerIrqClear, 0);
+    write32(ArmTimerLoad, m_nTimerClockHz / nRateHz - 1);
+    write32(ArmTimerControl, ControlCounter32 | ControlIrqEnable | ControlEnable);
+
+    LOGNOTE("PC sampling at %u Hz", nRateHz);
+    return TRUE;
+}
+
+void CTSampleProfiler::Stop(void)
+{
+    if (!m_bRunning)
+    {
+        return;
+    }
+
+    write32(ArmTimerControl, 0);
+    write32(ArmTimerIrqClear, 0);
+    m_bRunning = FALSE;
+    m_nSampledUs += CTimer::GetClockTicks() - m_nStartTicks;
+}
+
+void CTSampleProfiler::Clear(void)
+{
+    EnterCritical();
+    memset(m_Buckets, 0, sizeof(m_Buckets));
+    m_nSamples = 0;
+    m_nDropped = 0;
+    m_nSampledUs = 0;
+    m_nStartTicks = CTimer::GetClockTicks();
+    LeaveCritical();
+}
+
+unsigned CTSampleProfiler::GetSampledMs(void) const
+{
+    const unsigned nUs = m_nSampledUs + (m_bRunning ? CTimer::GetClockTicks() - m_nStartTicks : 0);
+    return nUs / 1000;
+}
+
+void CTSampleProfiler::InterruptHandler(void *pParam)
+{
+    CTSampleProfiler *pThis = static_cast<CTSampleProfiler *>(pParam);
+    write32(ArmTimerIrqClear, 0);
+
+#if AARCH == 32
+    // IRQStub corrects lr to the return address and pushes {r0-r3, r12, lr}
+    // onto the IRQ stack, which is empty on entry (IRQs do not nest), so the
+    // interrupted PC is the top word
+    const u32 nPC = *reinterpret_cast<volatile u32 *>(MEM_IRQ_STACK - 4);
+    pThis->Sample(nPC);
+#else
+    (void)pThis;
+#endif
+}
+
+void CTSampleProfiler::Sample(u32 nPC)
+{
+    ++m_nSamples;
+    const u32 nTask = GetTaskIndex();
+
+    // Instructions are word aligned; the low bits carry no information
+    unsigned nIndex = ((nPC >> 2) ^ (nTask << 9)) * 2654435761U % Buckets;
+    for (unsigned nProbe = 0; nProbe < ProbeLimit; ++nProbe, nIndex = (nIndex + 1) % Buckets)
+    {
+        TBucket &rBucket = m_Buckets[nIndex];
+        if (rBucket.nCount == 0)
+        {
+            rBucket.nPC = nPC;
+            rBucket.nTask = nTask;
+            rBucket.nCount = 1;
+            return;
+        }
+        if (rBucket.nPC == nPC && rBucket.nTask == nTask)
+        {
+            ++rBucket.nCount;
+            return;
+        }
+    }
+
+    ++m_nDropped;
+}
+
+unsigned CTSampleProfiler::GetTaskIndex(void)
+{
+    CScheduler *pScheduler = CScheduler::Get();
+    CTask *pTask = pScheduler != nullptr ? pScheduler->GetCurrentTask() : nullptr;
+    if (pTask == nullptr)
+    {
+        return 0;
+    }
+
+    for (unsigned i = 1; i < MaxTasks; ++i)
+    {
+        TTaskEntry &rEntry = m_Tasks[i];
+        if (rEntry.pTask == pTask)
+        {
+            return i;
+        }
+        if (rEntry.pTask == nullptr)
+        {
+            // First sample of this task; the name is kept in case it ends
+            const char *pName = pTask->GetName();
+            strncpy(rEntry.Name, pName != nullptr && pName[0] != '\0' ? pName : "?", sizeof(rEntry.Name) - 1);
+            rEntry.Name[sizeof(rEntry.Name) - 1] = '\0';
+            rEntry.pTask = pTask;
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+boolean CTSampleProfiler::FormatLine(unsigned &rCursor, CString &rLine) const
+{
+    if (rCursor < HeaderLines)
+    {
+        rLine.Format("profile rate %u ms %u samples %u dropped %u", m_nRateHz, GetSampledMs(),
+                     static_cast<unsigned>(m_nSamples), static_cast<unsigned>(m_nDropped));
+        ++rCursor;
+        return TRUE;
+    }
+
+    while (rCursor < HeaderLines + MaxTasks)
+    {
+        const unsigned nTask = rCursor++ - HeaderLines;
+        if (nTask == 0 || m_Tasks[nTask].pTask != nullptr)
+        {
+            rLine.Format("profile task %u %s", nTask, m_Tasks[nTask].Name);
+            return TRUE;
+        }
+    }
+
+    while (rCursor < HeaderLines + MaxTasks + Buckets)
+    {
+        const TBucket &rBucket = m_Buckets[rCursor++ - HeaderLines - MaxTasks];
+        if (rBucket.nCount != 0)
+        {
+            rLine.Format("profile pc %08X %u %u", rBucket.nPC, rBucket.nTask, rBucket.nCount);
+            return TRUE;
+        }
+    }
+
+    if (rCursor == HeaderLines + MaxTasks + Buckets)
+    {
+        rLine = "profile end";
+        ++rCursor;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+boolean CTSampleProfiler::Save(void)
+{
+    FIL file;
+    FRESULT result = f_open(&file, ProfileFileName, FA_WRITE | FA_CREATE_ALWAYS);
+    if (result != FR_OK)
+    {
+        LOGWARN("Cannot open %s (%d)", ProfileFileName, result);
+        return FALSE;
+    }
+
+    // A consistent snapshot; sampling resumes afterwards
+    const boolean bWasRunning = m_bRunning;
+    Stop();
+
+    unsigned nCursor = 0;
+    unsigned nLines = 0;
+    CString line;
+    while (result == FR_OK && FormatLine(nCursor, line))
+    {
+        line.Append("\n");
+        UINT nWritten = 0;
+        result = f_write(&file, (const char *)line, line.GetLength(), &nWritten);
+        if (result == FR_OK && nWritten != line.GetLength())
+        {
+            result = FR_DISK_ERR;
+        }
+        ++nLines;
+    }
+    f_close(&file);
+
+    if (bWasRunning)
+    {
+        Start(m_nRateHz);
+    }
+
+    if (result != FR_OK)
+    {
+        LOGWARN("Cannot write %s (%d)", ProfileFileName, result);
+        return FALSE;
+    }
+
+    LOGNOTE("Profile written to %s (%u lines)", ProfileFileName, nLines);
+    return TRUE;
+}
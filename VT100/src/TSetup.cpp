@@ -185,7 +185,7 @@ CTSetup::CTSetup()
     , m_pKeyboard(nullptr)
     , m_pPrevKeyPressed(nullptr)
     , m_pPrevKeyStatusRaw(nullptr)
-    , m_Snapshot{nullptr, 0, false, false, {}}
+    , m_nSnapshot(0)
     , m_Visible(false)
     , m_ExitRequested(false)
     , m_SaveRequested(false)
@@ -250,30 +250,16 @@ void CTSetup::Show()
         m_pPrevKeyStatusRaw = m_pKeyboard->GetKeyStatusHandlerRaw();
         m_pKeyboard->SetKeyPressedHandler(KeyPressedHandler);
         m_pKeyboard->SetKeyStatusHandlerRaw(KeyStatusHandlerRaw);
+        // The dialog reads plain ANSI cursor keys whatever the host selected
+        m_pKeyboard->SetKeyModes(0);
     }
 
-    size_t size = m_pRenderer->GetBufferSize();
-    if (size == 0)
+    // The dialog draws on a blank screen; Hide() brings the terminal back as it was
+    if (m_nSnapshot == 0)
     {
-        return;
-    }
-
-    if (m_Snapshot.buffer == nullptr || m_Snapshot.size != size)
-    {
-        delete[] m_Snapshot.buffer;
-        m_Snapshot.buffer = new u8[size];
-        m_Snapshot.size = size;
+        m_nSnapshot = m_pRenderer->TakeSnapshot();
     }
 
-    if (m_Snapshot.buffer != nullptr)
-    {
-        m_pRenderer->SaveScreenBuffer(m_Snapshot.buffer, size);
-        m_Snapshot.valid = true;
-    }
-
-    m_pRenderer->SaveState(m_Snapshot.rendererState);
-    m_Snapshot.stateValid = true;
-
     m_DialogMode = DialogModeLegacy;
     InitializeSetupBFromConfig();
     m_ModernLayoutValid = false;
@@ -320,16 +306,15 @@ void CTSetup::Hide()
         return;
     }
 
-    m_pRenderer->ForceHideCursor();
-
-    if (m_Snapshot.valid && m_Snapshot.buffer != nullptr)
+    // Tab stops edited on SET-UP A are kept
+    if (m_nSnapshot != 0)
     {
-        m_pRenderer->RestoreScreenBuffer(m_Snapshot.buffer, m_Snapshot.size);
+        m_pRenderer->RestoreSnapshot(m_nSnapshot, FALSE);
+        m_nSnapshot = 0;
     }
-
-    if (m_Snapshot.stateValid)
+    else
     {
-        m_pRenderer->RestoreState(m_Snapshot.rendererState);
+        m_pRenderer->ForceHideCursor();
     }
 
     m_Visible = false;
@@ -345,6 +330,7 @@ void CTSetup::Hide()
     {
         m_pKeyboard->SetKeyPressedHandler(m_pPrevKeyPressed);
         m_pKeyboard->SetKeyStatusHandlerRaw(m_pPrevKeyStatusRaw);
+        m_pKeyboard->SetKeyModes(m_pRenderer->GetKeyModes());
     }
 
     if (!IsSuspended())
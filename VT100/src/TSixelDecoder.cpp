@@ -0,0 +1,483 @@
+//------------------------------------------------------------------------------
+// Module:        CTSixelDecoder
+// Description:   Streaming DEC Sixel decoder drawing into the renderer shadow buffer.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Hot/cold code placement
+//------------------------------------------------------------------------------
+
+// Include class header
+#include "TSixelDecoder.h"
+#include "hotpath.h"
+
+// Include Circle core components
+#include <string.h>
+
+namespace
+{
+    // VT340 power-up color registers 0..15 in percent (R, G, B)
+    const u8 s_DefaultColors[16][3] = {
+        {0, 0, 0},
+        {20, 20, 80},
+        {80, 13, 13},
+        {20, 80, 20},
+        {80, 20, 80},
+        {20, 80, 80},
+        {80, 80, 20},
+        {53, 53, 53},
+        {26, 26, 26},
+        {33, 33, 60},
+        {60, 26, 26},
+        {33, 60, 33},
+        {60, 33, 60},
+        {33, 60, 60},
+        {60, 60, 33},
+        {80, 80, 80}};
+
+    // Cap the position so endless repeats cannot wrap it around
+    constexpr unsigned MaxPosX = 0xFFFF;
+
+    float HueToChannel(float p, float q, int nHue)
+    {
+        nHue = (nHue + 360) % 360;
+        if (nHue < 60)
+        {
+            return p + (q - p) * nHue / 60.0f;
+        }
+        if (nHue < 180)
+        {
+            return q;
+        }
+        if (nHue < 240)
+        {
+            return p + (q - p) * (240 - nHue) / 60.0f;
+        }
+        return p;
+    }
+}
+
+CTSixelDecoder::CTSixelDecoder(void)
+    : m_pDisplay(nullptr),
+      m_bActive(FALSE),
+      m_bTransparent(FALSE),
+      m_nBackground(0),
+      m_State(StateData),
+      m_nParamCount(0),
+      m_nRepeat(1),
+      m_nPosX(0),
+      m_nBandY(0),
+      m_nHeight(0),
+      m_nColor(0),
+      m_bBandDirty(FALSE),
+      m_bDamaged(FALSE),
+      m_nDamageY1(0),
+      m_nDamageY2(0),
+      m_nPixelCount(0),
+      m_pPaletteDisplay(nullptr),
+      m_nPaletteDepth(0)
+{
+    memset(&m_Target, 0, sizeof(m_Target));
+    memset(m_Params, 0, sizeof(m_Params));
+    memset(m_Palette, 0, sizeof(m_Palette));
+    memset(m_DefaultPalette, 0, sizeof(m_DefaultPalette));
+}
+
+CTSixelDecoder::~CTSixelDecoder(void)
+{
+    m_pDisplay = nullptr;
+    m_pPaletteDisplay = nullptr;
+}
+
+VT100_COLD void CTSixelDecoder::Begin(const TTarget &rTarget, const CDisplay *pDisplay, boolean bTransparent,
+                           CDisplay::TRawColor nBackground)
+{
+    m_Target = rTarget;
+    m_pDisplay = pDisplay;
+
+    // Depth 1 and missing displays are parsed without drawing
+    if (pDisplay == nullptr || (rTarget.nDepth != 8 && rTarget.nDepth != 16 && rTarget.nDepth != 32))
+    {
+        m_Target.pBuffer = nullptr;
+    }
+
+    if (m_Target.pBuffer != nullptr && (pDisplay != m_pPaletteDisplay || rTarget.nDepth != m_nPaletteDepth))
+    {
+        BuildDefaultPalette(pDisplay, rTarget.nDepth);
+    }
+
+    // Each image starts from the default registers (private color registers)
+    memcpy(m_Palette, m_DefaultPalette, sizeof(m_Palette));
+
+    m_bActive = TRUE;
+    m_bTransparent = bTransparent;
+    m_nBackground = nBackground;
+    m_State = StateData;
+    m_nParamCount = 0;
+    m_nRepeat = 1;
+    m_nPosX = 0;
+    m_nBandY = 0;
+    m_nHeight = 0;
+    m_nColor = m_Palette[0];
+    m_bBandDirty = FALSE;
+    m_bDamaged = FALSE;
+}
+
+VT100_HOT void CTSixelDecoder::Write(char chChar)
+{
+    const unsigned char uch = static_cast<unsigned char>(chChar);
+
+    switch (m_State)
+    {
+    case StateRepeat:
+        if ('0' <= chChar && chChar <= '9')
+        {
+            if (m_nRepeat <= MaxParamValue)
+            {
+                m_nRepeat = m_nRepeat * 10 + (chChar - '0');
+            }
+            return;
+        }
+        if (m_nRepeat == 0)
+        {
+            m_nRepeat = 1;
+        }
+        m_State = StateData;
+        break;
+
+    case StateColor:
+    case StateRaster:
+        if ('0' <= chChar && chChar <= '9')
+        {
+            unsigned &param = m_Params[m_nParamCount - 1];
+            if (param <= MaxParamValue)
+            {
+                param = param * 10 + (chChar - '0');
+            }
+            return;
+        }
+        if (chChar == ';')
+        {
+            if (m_nParamCount < MaxParams)
+            {
+                m_Params[m_nParamCount++] = 0;
+            }
+            return;
+        }
+        if (m_State == StateColor)
+        {
+            ApplyColor();
+        }
+        else
+        {
+            ApplyRaster();
+        }
+        m_State = StateData;
+        break;
+
+    default:
+        break;
+    }
+
+    // Sixel data bytes are by far the most frequent ones
+    if (uch >= 0x3F && uch <= 0x7E)
+    {
+        DrawSixel(uch - 0x3F, m_nRepeat);
+        m_nPosX = m_nPosX + m_nRepeat < MaxPosX ? m_nPosX + m_nRepeat : MaxPosX;
+        m_nRepeat = 1;
+        return;
+    }
+
+    switch (chChar)
+    {
+    case '!':
+        m_State = StateRepeat;
+        m_nRepeat = 0;
+        break;
+
+    case '#':
+        m_State = StateColor;
+        m_Params[0] = 0;
+        m_nParamCount = 1;
+        break;
+
+    case '"':
+        m_State = StateRaster;
+        m_Params[0] = 0;
+        m_nParamCount = 1;
+        break;
+
+    case '$':
+        m_nPosX = 0;
+        break;
+
+    case '-':
+        NextBand();
+        break;
+
+    default:
+        // CR, LF and other bytes inside the data are ignored
+        break;
+    }
+}
+
+void CTSixelDecoder::End(void)
+{
+    if (!m_bActive)
+    {
+        return;
+    }
+
+    if (m_State == StateColor)
+    {
+        ApplyColor();
+    }
+    MarkBandDamage();
+    m_State = StateData;
+    m_bActive = FALSE;
+}
+
+void CTSixelDecoder::DetachTarget(void)
+{
+    m_Target.pBuffer = nullptr;
+    m_bBandDirty = FALSE;
+    m_bDamaged = FALSE;
+}
+
+VT100_HOT boolean CTSixelDecoder::TakeDamage(unsigned &rPosY1, unsigned &rPosY2)
+{
+    MarkBandDamage();
+    if (!m_bDamaged)
+    {
+        return FALSE;
+    }
+
+    rPosY1 = m_nDamageY1;
+    rPosY2 = m_nDamageY2;
+    m_bDamaged = FALSE;
+    return TRUE;
+}
+
+VT100_HOT void CTSixelDecoder::DrawSixel(unsigned nBits, unsigned nCount)
+{
+    if (nBits == 0)
+    {
+        return;
+    }
+
+    if (m_nBandY + BandHeight > m_nHeight)
+    {
+        m_nHeight = m_nBandY + BandHeight;
+    }
+
+    if (m_Target.pBuffer == nullptr)
+    {
+        return;
+    }
+
+    const unsigned posX = m_Target.nOriginX + m_nPosX;
+    const unsigned bandY = m_Target.nOriginY + m_nBandY;
+    if (posX >= m_Target.nClipX || bandY >= m_Target.nClipY)
+    {
+        return;
+    }
+    if (nCount > m_Target.nClipX - posX)
+    {
+        nCount = m_Target.nClipX - posX;
+    }
+
+    for (unsigned bit = 0; bit < BandHeight; ++bit)
+    {
+        if ((nBits & (1U << bit)) == 0)
+        {
+            continue;
+        }
+
+        const unsigned posY = bandY + bit;
+        if (posY >= m_Target.nClipY)
+        {
+            break;
+        }
+
+        FillSpan(posX, posY, nCount, m_nColor);
+        m_nPixelCount += nCount;
+    }
+
+    m_bBandDirty = TRUE;
+}
+
+VT100_HOT void CTSixelDecoder::FillSpan(unsigned nPosX, unsigned nPosY, unsigned nCount, CDisplay::TRawColor nColor)
+{
+    u8 *pLine = m_Target.pBuffer + nPosY * m_Target.nPitch;
+
+    switch (m_Target.nDepth)
+    {
+    case 8:
+        memset(pLine + nPosX, static_cast<u8>(nColor), nCount);
+        break;
+
+    case 16:
+        for (u16 *p = reinterpret_cast<u16 *>(pLine) + nPosX; nCount--;)
+        {
+            *p++ = static_cast<u16>(nColor);
+        }
+        break;
+
+    case 32:
+        for (u32 *p = reinterpret_cast<u32 *>(pLine) + nPosX; nCount--;)
+        {
+            *p++ = static_cast<u32>(nColor);
+        }
+        break;
+    }
+}
+
+void CTSixelDecoder::NextBand(void)
+{
+    MarkBandDamage();
+    m_nPosX = 0;
+    if (m_nBandY <= MaxPosX)
+    {
+        m_nBandY += BandHeight;
+    }
+}
+
+VT100_HOT void CTSixelDecoder::MarkBandDamage(void)
+{
+    if (!m_bBandDirty)
+    {
+        return;
+    }
+
+    const unsigned posY1 = m_Target.nOriginY + m_nBandY;
+    unsigned posY2 = posY1 + BandHeight - 1;
+    if (posY2 >= m_Target.nClipY)
+    {
+        posY2 = m_Target.nClipY - 1;
+    }
+
+    AddDamage(posY1, posY2);
+    m_bBandDirty = FALSE;
+}
+
+VT100_HOT void CTSixelDecoder::AddDamage(unsigned nPosY1, unsigned nPosY2)
+{
+    if (!m_bDamaged)
+    {
+        m_nDamageY1 = nPosY1;
+        m_nDamageY2 = nPosY2;
+        m_bDamaged = TRUE;
+        return;
+    }
+
+    if (nPosY1 < m_nDamageY1)
+    {
+        m_nDamageY1 = nPosY1;
+    }
+    if (nPosY2 > m_nDamageY2)
+    {
+        m_nDamageY2 = nPosY2;
+    }
+}
+
+void CTSixelDecoder::ApplyColor(void)
+{
+    const unsigned index = m_Params[0] % PaletteSize;
+
+    // #Pc;Pu;Px;Py;Pz defines the register, #Pc alone selects it
+    if (m_nParamCount >= 5 && m_Target.pBuffer != nullptr)
+    {
+        const unsigned x = m_Params[2];
+        const unsigned y = m_Params[3] > 100 ? 100 : m_Params[3];
+        const unsigned z = m_Params[4] > 100 ? 100 : m_Params[4];
+
+        if (m_Params[1] == 2)
+        {
+            m_Palette[index] = MapColor(x > 100 ? 100 : x, y, z);
+        }
+        else if (m_Params[1] == 1)
+        {
+            // HLS with the DEC hue origin: 0 = blue, 120 = red, 240 = green
+            const float lightness = y / 100.0f;
+            const float saturation = z / 100.0f;
+            const int hue = static_cast<int>((x % 360 + 240) % 360);
+            const float q = lightness < 0.5f ? lightness * (1.0f + saturation)
+                                             : lightness + saturation - lightness * saturation;
+            const float p = 2.0f * lightness - q;
+
+            m_Palette[index] = MapColor(static_cast<unsigned>(HueToChannel(p, q, hue + 120) * 100.0f + 0.5f),
+                                        static_cast<unsigned>(HueToChannel(p, q, hue) * 100.0f + 0.5f),
+                                        static_cast<unsigned>(HueToChannel(p, q, hue - 120) * 100.0f + 0.5f));
+        }
+    }
+
+    m_nColor = m_Palette[index];
+}
+
+VT100_COLD void CTSixelDecoder::ApplyRaster(void)
+{
+    // "Pan;Pad;Ph;Pv: only the size is used, pixels are drawn 1:1
+    if (m_nParamCount < 4 || m_nPosX != 0 || m_nBandY != 0)
+    {
+        return;
+    }
+
+    const unsigned width = m_Params[2];
+    const unsigned height = m_Params[3];
+    if (height > m_nHeight)
+    {
+        m_nHeight = height;
+    }
+
+    if (m_bTransparent || m_Target.pBuffer == nullptr || width == 0 || height == 0)
+    {
+        return;
+    }
+
+    const unsigned posX = m_Target.nOriginX;
+    if (posX >= m_Target.nClipX || m_Target.nOriginY >= m_Target.nClipY)
+    {
+        return;
+    }
+
+    const unsigned count = width < m_Target.nClipX - posX ? width : m_Target.nClipX - posX;
+    unsigned posY2 = m_Target.nOriginY + height - 1;
+    if (posY2 >= m_Target.nClipY)
+    {
+        posY2 = m_Target.nClipY - 1;
+    }
+
+    for (unsigned posY = m_Target.nOriginY; posY <= posY2; ++posY)
+    {
+        FillSpan(posX, posY, count, m_nBackground);
+    }
+
+    AddDamage(m_Target.nOriginY, posY2);
+}
+
+VT100_COLD void CTSixelDecoder::BuildDefaultPalette(const CDisplay *pDisplay, unsigned nDepth)
+{
+    m_pPaletteDisplay = pDisplay;
+    m_nPaletteDepth = nDepth;
+
+    // Registers beyond the VT340 set repeat it until the host defines them
+    for (unsigned i = 0; i < PaletteSize; ++i)
+    {
+        const u8 *rgb = s_DefaultColors[i % 16];
+        m_DefaultPalette[i] = MapColor(rgb[0], rgb[1], rgb[2]);
+    }
+}
+
+CDisplay::TRawColor CTSixelDecoder::MapColor(unsigned nRed, unsigned nGreen, unsigned nBlue) const
+{
+    const CDisplay *display = m_pDisplay != nullptr ? m_pDisplay : m_pPaletteDisplay;
+    if (display == nullptr)
+    {
+        return 0;
+    }
+
+    return display->GetColor(DISPLAY_COLOR(nRed * 255 / 100, nGreen * 255 / 100, nBlue * 255 / 100));
+}
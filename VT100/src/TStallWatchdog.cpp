@@ -0,0 +1,404 @@
+//------------------------------------------------------------------------------
+// Module:        CTStallWatchdog
+// Description:   Detects stalled loops and records what the terminal was doing.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Capture kept across a watchdog reset, written at next boot
+//------------------------------------------------------------------------------
+
+#include "TStallWatchdog.h"
+
+#include <circle/logger.h>
+#include <circle/sched/scheduler.h>
+#include <circle/util.h>
+#include <fatfs/ff.h>
+
+LOGMODULE("TStallWatchdog");
+
+static const char StallFileName[] = "SD:/STALL.TXT";
+
+// A stall that never yields is reset by the BCM watchdog before Tick() runs.
+// The capture is kept in memory the boot code neither loads nor clears
+// (.noinit follows .bss) and written by the next Initialize().
+static const u32 SavedCaptureMagic = 0x53544C31;     // "STL1"
+
+struct TSavedCapture
+{
+    u32 nMagic;
+    u32 nStall;                         ///< Number of the captured stall
+    u32 nCaptureLength;
+    u32 nChecksum;                      ///< FNV-1a over the capture
+    u8 Capture[1024];
+};
+
+static TSavedCapture s_SavedCapture __attribute__((section(".noinit")));
+
+static u32 ChecksumCapture(const u8 *pData, size_t nLength)
+{
+    u32 hash = 2166136261U;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        hash = (hash ^ pData[i]) * 16777619U;
+    }
+    return hash;
+}
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTStallWatchdog *s_pThis = nullptr;
+CTStallWatchdog *CTStallWatchdog::Get(void)
+{
+    if (s_pThis == nullptr)
+    {
+        s_pThis = new CTStallWatchdog();
+    }
+    return s_pThis;
+}
+
+CTStallWatchdog::CTStallWatchdog(void)
+    : m_bInitialized(FALSE),
+      m_bReboot(FALSE),
+      m_nTimeoutUs(0),
+      m_nLastFeedTicks(0),
+      m_nTraceNext(0),
+      m_bCapturePending(FALSE),
+      m_nStalls(0)
+{
+    memset(m_Watches, 0, sizeof(m_Watches));
+    memset(m_Trace, 0, sizeof(m_Trace));
+    memset(&m_Capture, 0, sizeof(m_Capture));
+}
+
+CTStallWatchdog::~CTStallWatchdog(void)
+{
+    if (m_bReboot)
+    {
+        m_Watchdog.Stop();
+    }
+}
+
+boolean CTStallWatchdog::Initialize(unsigned nTimeoutSeconds, boolean bReboot)
+{
+    if (m_bInitialized)
+    {
+        return TRUE;
+    }
+
+    if (nTimeoutSeconds > MaxTimeoutSeconds)
+    {
+        nTimeoutSeconds = MaxTimeoutSeconds;
+    }
+    m_nTimeoutUs = nTimeoutSeconds * 1000000U;
+    // Without stall detection the hardware watchdog would only be fed blindly
+    m_bReboot = bReboot && nTimeoutSeconds != 0;
+
+    CTimer *pTimer = CTimer::Get();
+    if (pTimer == nullptr)
+    {
+        LOGERR("No system timer, stall watchdog disabled");
+        return FALSE;
+    }
+
+    m_bInitialized = TRUE;
+    WriteSavedReport();
+
+    if (m_nTimeoutUs == 0)
+    {
+        LOGNOTE("Stall watchdog off, tracing only");
+        return TRUE;
+    }
+
+    // Loops that beat during boot start their timeout now
+    EnterCritical();
+    const unsigned nNow = CTimer::GetClockTicks();
+    for (unsigned i = 0; i < WatchCount; ++i)
+    {
+        m_Watches[i].nLastBeat = nNow;
+    }
+    LeaveCritical();
+
+    if (m_bReboot)
+    {
+        m_nLastFeedTicks = nNow;
+        m_Watchdog.Start(RebootSeconds);
+    }
+    pTimer->RegisterPeriodicHandler(TimerHandler);
+
+    LOGNOTE("Stall watchdog: timeout %u s, reboot %s", nTimeoutSeconds, m_bReboot ? "on" : "off");
+    return TRUE;
+}
+
+void CTStallWatchdog::WatchCounter(TWatch Watch, u32 (*pSampler)(void))
+{
+    TWatchState &rState = m_Watches[Watch];
+    EnterCritical();
+    rState.pSampler = pSampler;
+    rState.nLastSample = pSampler != nullptr ? pSampler() : 0;
+    rState.nLastBeat = CTimer::GetClockTicks();
+    rState.bArmed = pSampler != nullptr;
+    LeaveCritical();
+}
+
+void CTStallWatchdog::TimerHandler(void)
+{
+    if (s_pThis != nullptr)
+    {
+        s_pThis->Check();
+    }
+}
+
+void CTStallWatchdog::Check(void)
+{
+    const unsigned nNow = CTimer::GetClockTicks();
+    boolean bStalled = FALSE;
+
+    for (unsigned i = 0; i < WatchCount; ++i)
+    {
+        TWatchState &rState = m_Watches[i];
+        if (rState.pSampler != nullptr)
+        {
+            const u32 nSample = rState.pSampler();
+            if (nSample != rState.nLastSample)
+            {
+                rState.nLastSample = nSample;
+                if (rState.bStalled)
+                {
+                    rState.nStallUs = nNow - rState.nLastBeat;
+                    rState.bStalled = FALSE;
+                    rState.bRecovered = TRUE;
+                }
+                rState.nLastBeat = nNow;
+                ++rState.nBeats;
+            }
+        }
+
+        if (!rState.bArmed)
+        {
+            continue;
+        }
+
+        if (!rState.bStalled && nNow - rState.nLastBeat >= m_nTimeoutUs)
+        {
+            rState.bStalled = TRUE;
+            ++m_nStalls;
+            if (!m_bCapturePending)
+            {
+                Capture(i, nNow);
+            }
+        }
+        bStalled = bStalled || rState.bStalled;
+    }
+
+    // The hardware watchdog is fed only while everything makes progress
+    if (m_bReboot && !bStalled && nNow - m_nLastFeedTicks >= 1000000U)
+    {
+        m_nLastFeedTicks = nNow;
+        m_Watchdog.Start(RebootSeconds);
+    }
+}
+
+void CTStallWatchdog::Capture(unsigned nWatch, unsigned nNow)
+{
+    m_Capture.nTicks = nNow;
+    m_Capture.nStall = m_nStalls;
+    m_Capture.nUptime = CTimer::Get()->GetUptime();
+    m_Capture.nWatch = nWatch;
+
+    m_Capture.TaskName[0] = '\0';
+    CScheduler *pScheduler = CScheduler::Get();
+    CTask *pTask = pScheduler != nullptr ? pScheduler->GetCurrentTask() : nullptr;
+    const char *pName = pTask != nullptr ? pTask->GetName() : nullptr;
+    if (pName != nullptr)
+    {
+        strncpy(m_Capture.TaskName, pName, sizeof(m_Capture.TaskName) - 1);
+        m_Capture.TaskName[sizeof(m_Capture.TaskName) - 1] = '\0';
+    }
+
+    for (unsigned i = 0; i < WatchCount; ++i)
+    {
+        const TWatchState &rState = m_Watches[i];
+        m_Capture.Watches[i].nSinceUs = nNow - rState.nLastBeat;
+        m_Capture.Watches[i].nBeats = rState.nBeats;
+        m_Capture.Watches[i].bArmed = rState.bArmed;
+        m_Capture.Watches[i].bStalled = rState.bStalled;
+    }
+
+    // Trace() runs in task context; at worst the entry it was writing is torn
+    const u32 nNext = m_nTraceNext;
+    const unsigned nCount = nNext < TraceEntries ? nNext : TraceEntries;
+    for (unsigned i = 0; i < nCount; ++i)
+    {
+        m_Capture.Trace[i] = m_Trace[(nNext - nCount + i) % TraceEntries];
+    }
+    m_Capture.nTrace = nCount;
+
+    // The board may be reset before the task side writes the report
+    if (m_bReboot)
+    {
+        memcpy(s_SavedCapture.Capture, &m_Capture, sizeof(m_Capture));
+        s_SavedCapture.nStall = m_Capture.nStall;
+        s_SavedCapture.nCaptureLength = sizeof(m_Capture);
+        s_SavedCapture.nChecksum = ChecksumCapture(s_SavedCapture.Capture, sizeof(m_Capture));
+        s_SavedCapture.nMagic = SavedCaptureMagic;
+    }
+
+    m_bCapturePending = TRUE;
+}
+
+void CTStallWatchdog::Tick(void)
+{
+    if (!m_bInitialized)
+    {
+        return;
+    }
+
+    for (unsigned i = 0; i < WatchCount; ++i)
+    {
+        TWatchState &rState = m_Watches[i];
+        if (rState.bRecovered)
+        {
+            rState.bRecovered = FALSE;
+            LOGNOTE("%s resumed after %u ms", GetWatchName(i), rState.nStallUs / 1000);
+        }
+    }
+
+    if (!m_bCapturePending)
+    {
+        return;
+    }
+
+    Trace(TraceStall, m_Capture.nWatch);
+    const unsigned nStall = m_Capture.nStall;
+    FormatReport("");
+    m_bCapturePending = FALSE;
+
+    WriteReport();
+
+    // On the card now; unless the handler captured a newer stall meanwhile
+    EnterCritical();
+    if (s_SavedCapture.nStall == nStall)
+    {
+        s_SavedCapture.nMagic = 0;
+    }
+    LeaveCritical();
+
+    LogReport();
+}
+
+void CTStallWatchdog::WriteSavedReport(void)
+{
+    static_assert(sizeof(TCapture) <= sizeof(s_SavedCapture.Capture), "stall capture does not fit");
+
+    const boolean bValid = s_SavedCapture.nMagic == SavedCaptureMagic
+                           && s_SavedCapture.nCaptureLength == sizeof(m_Capture)
+                           && s_SavedCapture.nChecksum == ChecksumCapture(s_SavedCapture.Capture, sizeof(m_Capture));
+    s_SavedCapture.nMagic = 0;
+    if (!bValid)
+    {
+        return;
+    }
+
+    memcpy(&m_Capture, s_SavedCapture.Capture, sizeof(m_Capture));
+    FormatReport(" (before the watchdog reset)");
+    WriteReport();
+    LogReport();
+}
+
+void CTStallWatchdog::LogReport(void)
+{
+    // Line by line, so the log pane and the telnet console show the whole report
+    const char *pLine = m_Report;
+    while (*pLine != '\0')
+    {
+        const char *pEnd = strchr(pLine, '\n');
+        const unsigned nLength = pEnd != nullptr ? static_cast<unsigned>(pEnd - pLine) : strlen(pLine);
+        char line[96];
+        const unsigned nCopy = nLength < sizeof(line) - 1 ? nLength : sizeof(line) - 1;
+        memcpy(line, pLine, nCopy);
+        line[nCopy] = '\0';
+        LOGWARN("%s", line);
+        pLine += nLength;
+        if (*pLine == '\n')
+        {
+            ++pLine;
+        }
+    }
+}
+
+void CTStallWatchdog::FormatReport(const char *pNote)
+{
+    const TCapture &rCapture = m_Capture;
+    CString line;
+
+    m_Report.Format("STALL #%u at %u s%s: %s no progress for %u ms, running task '%s'\n", rCapture.nStall,
+                    rCapture.nUptime, pNote, GetWatchName(rCapture.nWatch),
+                    rCapture.Watches[rCapture.nWatch].nSinceUs / 1000,
+                    rCapture.TaskName[0] != '\0' ? rCapture.TaskName : "?");
+
+    for (unsigned i = 0; i < WatchCount; ++i)
+    {
+        line.Format("  %-9s %s beats %u last %u ms ago\n", GetWatchName(i),
+                    !rCapture.Watches[i].bArmed ? "off    " : rCapture.Watches[i].bStalled ? "STALLED" : "ok     ",
+                    rCapture.Watches[i].nBeats, rCapture.Watches[i].nSinceUs / 1000);
+        m_Report.Append(line);
+    }
+
+    line.Format("  trace (%u events, ms before the stall):\n", rCapture.nTrace);
+    m_Report.Append(line);
+    for (unsigned i = 0; i < rCapture.nTrace; ++i)
+    {
+        const TTraceEntry &rEntry = rCapture.Trace[i];
+        line.Format("  %6d %-12s %u\n", -static_cast<int>((rCapture.nTicks - rEntry.nTicks) / 1000),
+                    GetEventName(rEntry.nEvent), rEntry.nArg);
+        m_Report.Append(line);
+    }
+}
+
+void CTStallWatchdog::WriteReport(void)
+{
+    FIL file;
+    FRESULT result = f_open(&file, StallFileName, FA_WRITE | FA_OPEN_ALWAYS);
+    if (result == FR_OK && f_size(&file) + m_Report.GetLength() > MaxFileBytes)
+    {
+        // Keep the file bounded; the newest report matters most
+        f_close(&file);
+        result = f_open(&file, StallFileName, FA_WRITE | FA_CREATE_ALWAYS);
+    }
+    if (result != FR_OK)
+    {
+        LOGWARN("Cannot open %s (%d)", StallFileName, result);
+        return;
+    }
+
+    UINT nWritten = 0;
+    result = f_lseek(&file, f_size(&file));
+    if (result == FR_OK)
+    {
+        result = f_write(&file, (const char *)m_Report, m_Report.GetLength(), &nWritten);
+    }
+    f_close(&file);
+
+    if (result != FR_OK || nWritten != m_Report.GetLength())
+    {
+        LOGWARN("Cannot write %s (%d)", StallFileName, result);
+    }
+}
+
+const char *CTStallWatchdog::GetWatchName(unsigned nWatch)
+{
+    static const char *const Names[WatchCount] = {"main", "renderer", "network", "keyboard"};
+    return nWatch < WatchCount ? Names[nWatch] : "?";
+}
+
+const char *CTStallWatchdog::GetEventName(unsigned nEvent)
+{
+    static const char *const Names[TraceEventCount] = {
+        "serial-rx", "net-rx", "render", "render-end", "net-send", "net-sent",
+        "file-sync", "file-synced", "usb", "usb-end", "stall"};
+    return nEvent < TraceEventCount ? Names[nEvent] : "?";
+}
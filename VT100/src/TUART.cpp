@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-01-27     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Receive backlog query for the scroll governor
+// 2026-10-18     R. Zuehlsdorff        Receive overruns counted for the performance HUD
 //------------------------------------------------------------------------------
 
 #include "TUART.h"
@@ -164,6 +166,11 @@ void CTUART::Run()
     }
 }
 
+unsigned CTUART::GetRxBacklog()
+{
+    return m_pSerial != nullptr ? m_pSerial->RxAvailable() : 0;
+}
+
 int CTUART::DrainSerialInput(char *dest, size_t maxLen)
 {
     if (dest == nullptr || maxLen == 0)
@@ -190,7 +197,12 @@ int CTUART::DrainSerialInput(char *dest, size_t maxLen)
             }
         }
 
-        return m_pSerial->Read(dest, maxLen);
+        const int nResult = m_pSerial->Read(dest, maxLen);
+        if (nResult == -SERIAL_ERROR_OVERRUN)
+        {
+            ++m_nOverruns;
+        }
+        return nResult;
     }
 
     return 0;
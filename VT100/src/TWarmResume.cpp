@@ -0,0 +1,478 @@
+//------------------------------------------------------------------------------
+// Module:        CTWarmResume
+// Description:   Persists the terminal screen to SD and restores it after reboot.
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Checksum over the cells in the header
+//------------------------------------------------------------------------------
+
+// Include class header
+#include "TWarmResume.h"
+
+// Include Circle core components
+#include <circle/logger.h>
+#include <circle/sysconfig.h>
+#include <circle/timer.h>
+#include <circle/util.h>
+#include <string.h>
+
+// Include application components
+#include "TConfig.h"
+#include "TRenderer.h"
+
+LOGMODULE("WarmResume");
+
+namespace
+{
+// Header layout (little endian), cells follow at HeaderSize:
+//   0 magic "VTWR"        4 u16 version        6 u16 header size
+//   8 u16 columns        10 u16 rows          12 u16 cursor column
+//  14 u16 cursor row     16 u16 scroll top    18 u16 scroll end (exclusive)
+//  20 u8 attributes      21 u8 G0 set         22 u8 G1 set
+//  23 u8 modes           24 u8 font flags     32 tab stop bitmap
+//  56 u32 cell checksum: FNV-1a over the FNV-1a checksums of the rows
+//  60 u32 FNV-1a checksum over bytes 0..59
+constexpr u8 Magic[4] = {'V', 'T', 'W', 'R'};
+constexpr unsigned Version = 2;
+constexpr unsigned TabStopOffset = 32;
+constexpr unsigned TabStopBytes = CTConfig::TabStopsMax / 8;
+constexpr unsigned CellChecksumOffset = 56;
+constexpr unsigned ChecksumOffset = 60;
+
+static_assert(TabStopOffset + TabStopBytes <= CellChecksumOffset, "Tab stop bitmap overlaps cell checksum");
+static_assert(sizeof(CTCellBuffer::TCell) == 2, "Cell layout is part of the file format");
+
+void Put16(u8 *pDest, unsigned nValue)
+{
+    pDest[0] = static_cast<u8>(nValue);
+    pDest[1] = static_cast<u8>(nValue >> 8);
+}
+
+void Put32(u8 *pDest, u32 nValue)
+{
+    Put16(pDest, nValue & 0xFFFF);
+    Put16(pDest + 2, nValue >> 16);
+}
+
+unsigned Get16(const u8 *pSource)
+{
+    return pSource[0] | (static_cast<unsigned>(pSource[1]) << 8);
+}
+
+u32 Get32(const u8 *pSource)
+{
+    return Get16(pSource) | (static_cast<u32>(Get16(pSource + 2)) << 16);
+}
+
+u32 Checksum(const u8 *pData, unsigned nLength, u32 hash = 2166136261U)
+{
+    while (nLength--)
+    {
+        hash ^= *pData++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+u32 RowChecksum(const CTCellBuffer::TCell *pCells, unsigned nColumns)
+{
+    return Checksum(reinterpret_cast<const u8 *>(pCells), nColumns * sizeof(CTCellBuffer::TCell));
+}
+
+// Rows are rewritten one at a time, so the image checksum is built from theirs
+u32 CellChecksum(const u32 *pRowChecksums, unsigned nRows)
+{
+    u32 hash = 2166136261U;
+    for (unsigned row = 0; row < nRows; ++row)
+    {
+        u8 bytes[4];
+        Put32(bytes, pRowChecksums[row]);
+        hash = Checksum(bytes, sizeof(bytes), hash);
+    }
+    return hash;
+}
+}
+
+// Singleton instance creation and access
+// teardown handled by runtime
+// CAUTION: Only possible if constructor does not need parameters
+static CTWarmResume *s_pThis = 0;
+CTWarmResume *CTWarmResume::Get(void)
+{
+    if (s_pThis == 0)
+    {
+        s_pThis = new CTWarmResume();
+    }
+    return s_pThis;
+}
+
+CTWarmResume::CTWarmResume(void)
+    : m_pRenderer(nullptr),
+      m_pConfig(nullptr),
+      m_FileOpen(false),
+      m_Active(false),
+      m_nColumns(0),
+      m_nRows(0),
+      m_pWrittenGenerations(nullptr),
+      m_pWrittenChecksums(nullptr),
+      m_nWrittenGeneration(0),
+      m_bHeaderPending(false)
+{
+    memset(m_WrittenHeader, 0, sizeof(m_WrittenHeader));
+}
+
+CTWarmResume::~CTWarmResume(void)
+{
+    Stop();
+
+    delete[] m_pWrittenGenerations;
+    m_pWrittenGenerations = nullptr;
+
+    delete[] m_pWrittenChecksums;
+    m_pWrittenChecksums = nullptr;
+}
+
+bool CTWarmResume::Initialize(CTRenderer *pRenderer, CTConfig *pConfig, const char *pFileName)
+{
+    m_pRenderer = pRenderer;
+    m_pConfig = pConfig;
+    m_Active = false;
+
+    if (m_pRenderer == nullptr || pFileName == nullptr)
+    {
+        return false;
+    }
+
+    if (!m_FileOpen)
+    {
+        FRESULT result = f_open(&m_File, pFileName, FA_READ | FA_WRITE | FA_OPEN_ALWAYS);
+        if (result != FR_OK)
+        {
+            LOGWARN("Cannot open %s (err=%d), warm resume disabled", pFileName, (int)result);
+            return false;
+        }
+        m_FileOpen = true;
+    }
+
+    m_Active = SyncGeometry();
+    return m_Active;
+}
+
+bool CTWarmResume::Restore(void)
+{
+    if (!m_FileOpen || m_pRenderer == nullptr)
+    {
+        return false;
+    }
+
+    const FSIZE_t fileSize = f_size(&m_File);
+    const FSIZE_t maxSize = HeaderSize + MaxColumns * MaxRows * sizeof(CTCellBuffer::TCell);
+    if (fileSize < HeaderSize || fileSize > maxSize)
+    {
+        LOGNOTE("No saved screen to resume");
+        return false;
+    }
+
+    u8 *pImage = new u8[fileSize];
+    if (pImage == nullptr)
+    {
+        return false;
+    }
+
+    // One sequential read of header and cells
+    UINT bytesRead = 0;
+    FRESULT result = f_lseek(&m_File, 0);
+    if (result == FR_OK)
+    {
+        result = f_read(&m_File, pImage, static_cast<UINT>(fileSize), &bytesRead);
+    }
+
+    bool ok = (result == FR_OK && bytesRead == fileSize);
+    ok = ok && memcmp(pImage, Magic, sizeof(Magic)) == 0
+            && Get16(pImage + 4) == Version
+            && Get16(pImage + 6) == HeaderSize
+            && Get32(pImage + ChecksumOffset) == Checksum(pImage, ChecksumOffset);
+
+    CTRenderer::TResumeState state;
+    memset(&state, 0, sizeof(state));
+    if (ok)
+    {
+        state.columns = Get16(pImage + 8);
+        state.rows = Get16(pImage + 10);
+        state.cursorColumn = Get16(pImage + 12);
+        state.cursorRow = Get16(pImage + 14);
+        state.scrollTopRow = Get16(pImage + 16);
+        state.scrollEndRow = Get16(pImage + 18);
+        state.attributes = pImage[20];
+        state.g0CharSet = pImage[21];
+        state.g1CharSet = pImage[22];
+        state.modes = pImage[23];
+        state.fontFlags = pImage[24];
+
+        const unsigned cellCount = state.columns * state.rows;
+        ok = state.columns <= MaxColumns && state.rows <= MaxRows
+            && fileSize >= HeaderSize + cellCount * sizeof(CTCellBuffer::TCell);
+    }
+
+    // Rows written after the last header belong to a pass that did not finish
+    const CTCellBuffer::TCell *pCells = reinterpret_cast<const CTCellBuffer::TCell *>(pImage + HeaderSize);
+    u32 *pRowChecksums = ok ? new u32[state.rows] : nullptr;
+    if (pRowChecksums != nullptr)
+    {
+        for (unsigned row = 0; row < state.rows; ++row)
+        {
+            pRowChecksums[row] = RowChecksum(pCells + row * state.columns, state.columns);
+        }
+        ok = Get32(pImage + CellChecksumOffset) == CellChecksum(pRowChecksums, state.rows);
+    }
+    else
+    {
+        ok = false;
+    }
+
+    if (!ok)
+    {
+        LOGWARN("Saved screen is invalid, starting blank");
+        delete[] pRowChecksums;
+        delete[] pImage;
+        return false;
+    }
+
+    ok = m_pRenderer->ApplyResumeState(state, pCells, state.columns * state.rows);
+
+    if (ok && m_pConfig != nullptr)
+    {
+        for (unsigned column = 0; column < CTConfig::TabStopsMax; ++column)
+        {
+            m_pConfig->SetTabStop(column, (pImage[TabStopOffset + column / 8] >> (column % 8)) & 1);
+        }
+    }
+
+    delete[] pImage;
+
+    if (!ok)
+    {
+        delete[] pRowChecksums;
+        return false;
+    }
+
+    // The card already holds what is on screen now
+    SyncGeometry();
+    for (unsigned row = 0; row < m_nRows; ++row)
+    {
+        m_pWrittenGenerations[row] = m_pRenderer->GetCellRowGeneration(row);
+        m_pWrittenChecksums[row] = row < state.rows ? pRowChecksums[row] : 0;
+    }
+    delete[] pRowChecksums;
+    m_nWrittenGeneration = m_pRenderer->GetCellGeneration();
+    BuildHeader(m_WrittenHeader);
+    m_bHeaderPending = false;
+
+    LOGNOTE("Restored %ux%u screen, cursor at %u,%u", state.columns, state.rows, state.cursorRow + 1, state.cursorColumn + 1);
+    return true;
+}
+
+void CTWarmResume::Tick(void)
+{
+    if (!m_Active)
+    {
+        return;
+    }
+
+    // Stay off the card while the host is sending
+    const unsigned now = CTimer::Get()->GetTicks();
+    if (now - m_pRenderer->GetLastWriteTicks() < MSEC2HZ(IdleDelayMs))
+    {
+        return;
+    }
+
+    if (!SyncGeometry())
+    {
+        return;
+    }
+
+    const u32 generation = m_pRenderer->GetCellGeneration();
+    if (generation != m_nWrittenGeneration)
+    {
+        unsigned rowsWritten = 0;
+        for (unsigned row = 0; row < m_nRows; ++row)
+        {
+            if (m_pRenderer->GetCellRowGeneration(row) == m_pWrittenGenerations[row])
+            {
+                continue;
+            }
+
+            if (rowsWritten == RowsPerTick)
+            {
+                // Continue with the remaining rows on the next heartbeat
+                return;
+            }
+
+            if (!WriteRow(row))
+            {
+                return;
+            }
+            ++rowsWritten;
+        }
+
+        m_nWrittenGeneration = generation;
+        m_bHeaderPending = true;
+    }
+
+    u8 header[HeaderSize];
+    BuildHeader(header);
+    if (m_bHeaderPending || memcmp(header, m_WrittenHeader, HeaderSize) != 0)
+    {
+        WriteHeader(header);
+    }
+}
+
+void CTWarmResume::Stop(void)
+{
+    m_Active = false;
+
+    if (m_FileOpen)
+    {
+        f_close(&m_File);
+        m_FileOpen = false;
+    }
+}
+
+void CTWarmResume::BuildHeader(u8 *pHeader) const
+{
+    CTRenderer::TResumeState state;
+    m_pRenderer->GetResumeState(state);
+
+    memset(pHeader, 0, HeaderSize);
+    memcpy(pHeader, Magic, sizeof(Magic));
+    Put16(pHeader + 4, Version);
+    Put16(pHeader + 6, HeaderSize);
+    Put16(pHeader + 8, state.columns);
+    Put16(pHeader + 10, state.rows);
+    Put16(pHeader + 12, state.cursorColumn);
+    Put16(pHeader + 14, state.cursorRow);
+    Put16(pHeader + 16, state.scrollTopRow);
+    Put16(pHeader + 18, state.scrollEndRow);
+    pHeader[20] = state.attributes;
+    pHeader[21] = state.g0CharSet;
+    pHeader[22] = state.g1CharSet;
+    pHeader[23] = state.modes;
+    pHeader[24] = state.fontFlags;
+    Put32(pHeader + CellChecksumOffset, CellChecksum(m_pWrittenChecksums, m_nRows));
+
+    if (m_pConfig != nullptr)
+    {
+        for (unsigned column = 0; column < CTConfig::TabStopsMax; ++column)
+        {
+            if (m_pConfig->IsTabStop(column))
+            {
+                pHeader[TabStopOffset + column / 8] |= static_cast<u8>(1U << (column % 8));
+            }
+        }
+    }
+
+    Put32(pHeader + ChecksumOffset, Checksum(pHeader, ChecksumOffset));
+}
+
+bool CTWarmResume::WriteRow(unsigned nRow)
+{
+    u32 rowGeneration = 0;
+    const unsigned count = m_pRenderer->CopyCellRow(nRow, m_RowBuffer, MaxColumns, &rowGeneration);
+    if (count != m_nColumns)
+    {
+        // Geometry changed underneath us, SyncGeometry() picks it up next tick
+        return false;
+    }
+
+    const UINT rowBytes = count * sizeof(CTCellBuffer::TCell);
+    FRESULT result = f_lseek(&m_File, HeaderSize + nRow * rowBytes);
+    UINT written = 0;
+    if (result == FR_OK)
+    {
+        result = f_write(&m_File, m_RowBuffer, rowBytes, &written);
+    }
+
+    if (result != FR_OK || written != rowBytes)
+    {
+        Fail("row write", result);
+        return false;
+    }
+
+    m_pWrittenGenerations[nRow] = rowGeneration;
+    m_pWrittenChecksums[nRow] = RowChecksum(m_RowBuffer, count);
+    return true;
+}
+
+bool CTWarmResume::WriteHeader(const u8 *pHeader)
+{
+    FRESULT result = f_lseek(&m_File, 0);
+    UINT written = 0;
+    if (result == FR_OK)
+    {
+        result = f_write(&m_File, pHeader, HeaderSize, &written);
+    }
+    if (result == FR_OK && written == HeaderSize)
+    {
+        result = f_sync(&m_File);
+    }
+
+    if (result != FR_OK || written != HeaderSize)
+    {
+        Fail("header write", result);
+        return false;
+    }
+
+    memcpy(m_WrittenHeader, pHeader, HeaderSize);
+    m_bHeaderPending = false;
+    return true;
+}
+
+bool CTWarmResume::SyncGeometry(void)
+{
+    const unsigned columns = m_pRenderer->GetColumns();
+    const unsigned rows = m_pRenderer->GetRows();
+    if (columns == m_nColumns && rows == m_nRows && m_pWrittenGenerations != nullptr && m_pWrittenChecksums != nullptr)
+    {
+        return true;
+    }
+
+    if (columns == 0 || rows == 0 || columns > MaxColumns || rows > MaxRows)
+    {
+        LOGWARN("Screen %ux%u not supported, warm resume disabled", columns, rows);
+        m_Active = false;
+        return false;
+    }
+
+    delete[] m_pWrittenGenerations;
+    m_pWrittenGenerations = new u32[rows];
+    delete[] m_pWrittenChecksums;
+    m_pWrittenChecksums = new u32[rows];
+    if (m_pWrittenGenerations == nullptr || m_pWrittenChecksums == nullptr)
+    {
+        m_Active = false;
+        return false;
+    }
+
+    // Generation 0 is never assigned to a row, so every row is rewritten;
+    // until then the cell checksum does not match and the image is not restored
+    for (unsigned row = 0; row < rows; ++row)
+    {
+        m_pWrittenGenerations[row] = 0;
+        m_pWrittenChecksums[row] = 0;
+    }
+    m_nColumns = columns;
+    m_nRows = rows;
+    m_nWrittenGeneration = 0;
+    m_bHeaderPending = true;
+    return true;
+}
+
+void CTWarmResume::Fail(const char *pWhat, FRESULT result)
+{
+    LOGERR("SD %s failed (err=%d), warm resume disabled", pWhat, (int)result);
+    m_Active = false;
+}
@@ -7,16 +7,27 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2026-02-02     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Screen query commands (screen/rect/since)
+// 2026-10-18     R. Zuehlsdorff        MCCP2 (telnet COMPRESS2) output compression
+// 2026-10-18     R. Zuehlsdorff        Stall watchdog beats, send trace and 'stall' command
+// 2026-10-18     R. Zuehlsdorff        Socket byte counters for the performance HUD
+// 2026-10-18     R. Zuehlsdorff        'profile' command for the PC sampler
+// 2026-10-18     R. Zuehlsdorff        Serialise the MCCP2 stream with one task mutex
 //------------------------------------------------------------------------------
 
 #include "TWlanLog.h"
 #include "kernel.h"
 #include "TConfig.h"
+#include "TRenderer.h"
+#include "TSampleProfiler.h"
+#include "TStallWatchdog.h"
 
 #include <circle/logger.h>
 #include <circle/net/in.h>
 #include <circle/net/netconfig.h>
 #include <circle/sched/scheduler.h>
+#include <circle/timer.h>
+#include <circle/util.h>
 #include <wlan/bcm4343.h>
 #include <wlan/hostap/wpa_supplicant/wpasupplicant.h>
 #include <string.h>
@@ -38,6 +49,52 @@ static const u8 TelnetSE   = 240;
 static const u8 TelnetOptEcho = 1;
 static const u8 TelnetOptSuppressGoAhead = 3;
 static const u8 TelnetOptLineMode = 34;
+static const u8 TelnetOptCompress2 = 86;
+static const char CommandPrompt[] = ">: ";
+
+// Compression time allowed per flush before output falls back to stored
+// blocks, and how long the fallback lasts
+static const u64 CompressFlushBudgetUs = 2000;
+static const u64 CompressCooldownUs = 1000000;
+
+// Screen queries copy at most this many cells per row
+static const unsigned ScreenQueryMaxColumns = 256;
+
+// ASCII stand-ins for DEC special graphics 0x5F..0x7E in screen dumps
+static const char GraphicsAscii[] = " *#????o+??+++++-----++++|<>*!L.";
+
+char CellToAscii(const CTCellBuffer::TCell &cell)
+{
+    if ((cell.attr & CTCellBuffer::AttrGraphics) && cell.ch >= 0x5F && cell.ch <= 0x7E)
+    {
+        return GraphicsAscii[cell.ch - 0x5F];
+    }
+
+    if (cell.ch < 0x20 || cell.ch > 0x7E)
+    {
+        return '?';
+    }
+
+    return static_cast<char>(cell.ch);
+}
+
+bool ParseUnsignedArg(const char *&text, unsigned &value)
+{
+    while (*text == ' ')
+    {
+        ++text;
+    }
+
+    if (*text < '0' || *text > '9')
+    {
+        return false;
+    }
+
+    char *endPtr = nullptr;
+    value = static_cast<unsigned>(strtoul(text, &endPtr, 10));
+    text = endPtr;
+    return true;
+}
 
 bool TryFormatIPAddress(const CIPAddress *ip, CString &out)
 {
@@ -97,9 +154,20 @@ CTWlanLog::CTWlanLog()
     , m_TelnetNegotiated(false)
     , m_TelnetRxState(TelnetStateData)
     , m_TelnetCommand(0)
+    , m_Deflate()
+    , m_CompressOffered(false)
+    , m_CompressActive(false)
+    , m_CompressPlainUntilUs(0)
+    , m_CompressBytesIn(0)
+    , m_CompressBytesOut(0)
+    , m_CompressCpuUs(0)
+    , m_CompressFallbacks(0)
+    , m_RxBytes(0)
+    , m_TxBytes(0)
     , m_RxLineBuffer()
     , m_ConnectionLock()
     , m_SendLock()
+    , m_StreamLock()
 {
     SetName("wlan-log");
     Suspend();
@@ -254,6 +322,24 @@ void CTWlanLog::Send(const char *buffer, size_t length)
         return;
     }
 
+    // The socket send may yield, so the lock is held until the whole
+    // compressed block including its flush is on the wire
+    m_StreamLock.Acquire();
+
+    if (m_CompressActive)
+    {
+        SendCompressed(buffer, length);
+    }
+    else
+    {
+        SendRaw(buffer, length);
+    }
+
+    m_StreamLock.Release();
+}
+
+bool CTWlanLog::SendRaw(const char *buffer, size_t length)
+{
     while (length > 0)
     {
         m_SendLock.Acquire();
@@ -266,22 +352,123 @@ void CTWlanLog::Send(const char *buffer, size_t length)
         if (client == nullptr)
         {
             m_SendLock.Release();
-            return;
+            return false;
         }
 
+        CTStallWatchdog *watchdog = CTStallWatchdog::Get();
+        watchdog->Trace(CTStallWatchdog::TraceNetSend, static_cast<u32>(length));
         int sent = client->Send(buffer, length, 0);
+        watchdog->Trace(CTStallWatchdog::TraceNetSent, static_cast<u32>(sent));
         if (sent <= 0)
         {
             CloseClient("send failed", true);
             m_SendLock.Release();
-            return;
+            return false;
         }
 
         m_SendLock.Release();
 
+        m_TxBytes += static_cast<u32>(sent);
         buffer += sent;
         length -= static_cast<size_t>(sent);
     }
+
+    return true;
+}
+
+void CTWlanLog::SendCompressed(const char *buffer, size_t length)
+{
+    // After a flush ran over budget the data is only framed for a while
+    const bool plain = CTimer::GetClockTicks64() < m_CompressPlainUntilUs;
+    m_CompressBytesIn += length;
+
+    u64 cpuUs = 0;
+    while (length > 0)
+    {
+        const size_t chunk = length < CTDeflateStream::MaxInputChunk ? length : CTDeflateStream::MaxInputChunk;
+
+        const u64 startUs = CTimer::GetClockTicks64();
+        const size_t produced = plain ? m_Deflate.Store(buffer, chunk, m_CompressOutput)
+                                      : m_Deflate.Compress(buffer, chunk, m_CompressOutput);
+        cpuUs += CTimer::GetClockTicks64() - startUs;
+
+        m_CompressBytesOut += produced;
+        if (!SendRaw(reinterpret_cast<const char *>(m_CompressOutput), produced))
+        {
+            return;
+        }
+
+        buffer += chunk;
+        length -= chunk;
+    }
+
+    const size_t produced = m_Deflate.Flush(m_CompressOutput);
+    m_CompressBytesOut += produced;
+    m_CompressCpuUs += cpuUs;
+
+    if (!plain && cpuUs > CompressFlushBudgetUs)
+    {
+        m_CompressPlainUntilUs = CTimer::GetClockTicks64() + CompressCooldownUs;
+        ++m_CompressFallbacks;
+    }
+
+    SendRaw(reinterpret_cast<const char *>(m_CompressOutput), produced);
+}
+
+void CTWlanLog::StartCompression()
+{
+    // IAC SB COMPRESS2 IAC SE is the last uncompressed sequence of the session
+    static const char Begin[] = {static_cast<char>(TelnetIAC), static_cast<char>(TelnetSB),
+                                 static_cast<char>(TelnetOptCompress2),
+                                 static_cast<char>(TelnetIAC), static_cast<char>(TelnetSE)};
+    m_StreamLock.Acquire();
+    if (!SendRaw(Begin, sizeof Begin))
+    {
+        m_StreamLock.Release();
+        return;
+    }
+
+    m_Deflate.Reset();
+    m_CompressActive = true;
+    m_CompressPlainUntilUs = 0;
+    m_StreamLock.Release();
+
+    if (m_pLogger)
+    {
+        m_pLogger->Write(FromTerminal, LogNotice, "MCCP2 compression active");
+    }
+}
+
+void CTWlanLog::StopCompression()
+{
+    m_StreamLock.Acquire();
+    if (m_CompressActive)
+    {
+        const size_t produced = m_Deflate.Finish(m_CompressOutput);
+        m_CompressBytesOut += produced;
+        m_CompressActive = false;
+        SendRaw(reinterpret_cast<const char *>(m_CompressOutput), produced);
+    }
+    m_StreamLock.Release();
+}
+
+void CTWlanLog::FormatCompressionStats(CString &line) const
+{
+    if (!m_CompressActive && m_CompressBytesIn == 0)
+    {
+        line = m_CompressOffered ? "MCCP2: offered, not used by this client" : "MCCP2: off";
+        return;
+    }
+
+    const u64 bytesIn = m_CompressBytesIn > 0 ? m_CompressBytesIn : 1;
+    line.Format("MCCP2: %s, %u -> %u bytes (%u%%), CPU %u us (%u us/KiB), %u plain fallbacks",
+                m_CompressActive ? "active" : "ended",
+                static_cast<unsigned>(m_CompressBytesIn),
+                static_cast<unsigned>(m_CompressBytesOut),
+                static_cast<unsigned>(m_CompressBytesOut * 100 / bytesIn),
+                static_cast<unsigned>(m_CompressCpuUs),
+                static_cast<unsigned>(m_CompressCpuUs * 1024 / bytesIn),
+                m_CompressFallbacks);
 }
 
 bool CTWlanLog::SendHostData(const char *buffer, size_t length)
@@ -315,8 +502,7 @@ void CTWlanLog::SendLine(const char *line)
 
 void CTWlanLog::SendCommandPrompt()
 {
-    static const char Prompt[] = ">: ";
-    Send(Prompt, sizeof Prompt - 1);
+    Send(CommandPrompt, sizeof CommandPrompt - 1);
     m_CommandPromptVisible = true;
 }
 
@@ -372,24 +558,23 @@ int CTWlanLog::Write(const void *buffer, size_t count)
 
     if (!m_HostModeActive && IsClientConnected())
     {
+        // One Send per log line: with MCCP2 every Send is a sync flush
+        CString payload;
         if (m_CommandPromptVisible)
         {
-            static const char PromptSeparator[] = " ";
-            Send(PromptSeparator, sizeof PromptSeparator - 1);
+            payload = " ";
         }
 
-        if (normalized.GetLength() > 0)
-        {
-            Send(normalized.c_str(), normalized.GetLength());
-        }
+        payload += normalized;
 
         if (!endsWithLineBreak)
         {
-            static const char NewLine[] = "\r\n";
-            Send(NewLine, sizeof NewLine - 1);
+            payload += "\r\n";
         }
 
-        SendCommandPrompt();
+        payload += CommandPrompt;
+        Send(payload.c_str(), payload.GetLength());
+        m_CommandPromptVisible = true;
         return static_cast<int>(count);
     }
 
@@ -413,8 +598,12 @@ void CTWlanLog::Run()
     bool waitingAnnounced = false;
     bool readyNoticeLogged = false;
 
+    CTStallWatchdog *watchdog = CTStallWatchdog::Get();
+
     while (!m_StopRequested)
     {
+        watchdog->Beat(CTStallWatchdog::WatchNetwork);
+
         if (!m_Activated)
         {
             waitIterations = 0;
@@ -564,6 +753,7 @@ void CTWlanLog::Run()
         CScheduler::Get()->MsSleep(10);
     }
 
+    watchdog->Disarm(CTStallWatchdog::WatchNetwork);
     CloseClient("server stopped");
 
     if (m_LoggerAttached && m_pLogger != nullptr && m_pFallback != nullptr)
@@ -592,6 +782,12 @@ void CTWlanLog::ProcessLine(const char *line)
         SendLine("  help   - show this text");
         SendLine("  status - show WLAN status");
         SendLine("  echo <text> - repeat text back to you");
+        SendLine("  screen - dump the screen text");
+        SendLine("  screen rect <top> <left> <bottom> <right> - dump a region (1-based)");
+        SendLine("  screen since <seq> - dump rows changed after sequence <seq>");
+        SendLine("  mccp   - show compression ratio and CPU cost (MCCP2)");
+        SendLine("  stall  - show the last stall watchdog report");
+        SendLine("  profile [start [hz]|stop|clear|dump|save] - PC sampling profiler");
         SendLine("  exit   - disconnect this session");
         SendLine("Host mode is a dedicated session type (wlan_host_autostart: 0=off, 1=log, 2=host).");
         SendLine("Other text is logged at notice level.");
@@ -617,6 +813,53 @@ void CTWlanLog::ProcessLine(const char *line)
         return;
     }
 
+    if (strncmp(line, "screen", 6) == 0 && (line[6] == '\0' || line[6] == ' '))
+    {
+        HandleScreenCommand(line + 6);
+        return;
+    }
+
+    if (strcmp(line, "mccp") == 0)
+    {
+        CString statsLine;
+        FormatCompressionStats(statsLine);
+        SendLine(statsLine.c_str());
+        return;
+    }
+
+    if (strcmp(line, "stall") == 0)
+    {
+        const char *report = CTStallWatchdog::Get()->GetReport();
+        if (report[0] == '\0')
+        {
+            SendLine("No stall recorded since boot");
+            return;
+        }
+
+        while (*report != '\0')
+        {
+            const char *end = strchr(report, '\n');
+            const size_t length = end != nullptr ? static_cast<size_t>(end - report) : strlen(report);
+            char reportLine[96];
+            const size_t copy = length < sizeof reportLine - 1 ? length : sizeof reportLine - 1;
+            memcpy(reportLine, report, copy);
+            reportLine[copy] = '\0';
+            SendLine(reportLine);
+            report += length;
+            if (*report == '\n')
+            {
+                ++report;
+            }
+        }
+        return;
+    }
+
+    if (strncmp(line, "profile", 7) == 0 && (line[7] == '\0' || line[7] == ' '))
+    {
+        HandleProfileCommand(line + 7);
+        return;
+    }
+
     if (strcmp(line, "exit") == 0)
     {
         SendLine("Closing connection. Bye.");
@@ -687,6 +930,192 @@ void CTWlanLog::ProcessLine(const char *line)
     SendLine("Logged your message. Use status/help for built-in commands.");
 }
 
+void CTWlanLog::HandleProfileCommand(const char *args)
+{
+    CTSampleProfiler *profiler = CTSampleProfiler::Get();
+
+    while (*args == ' ')
+    {
+        ++args;
+    }
+
+    if (strncmp(args, "start", 5) == 0)
+    {
+        args += 5;
+        CTConfig *config = CTConfig::Get();
+        unsigned rate = config != nullptr && config->GetProfileRate() != 0 ? config->GetProfileRate()
+                                                                           : CTSampleProfiler::DefaultRate;
+        while (*args == ' ')
+        {
+            ++args;
+        }
+        if (*args != '\0' && !ParseUnsignedArg(args, rate))
+        {
+            SendLine("Usage: profile start [hz]");
+            return;
+        }
+
+        SendLine(profiler->Start(rate) ? "Sampling started" : "PC sampler not available");
+        return;
+    }
+
+    if (strcmp(args, "stop") == 0)
+    {
+        profiler->Stop();
+        SendLine("Sampling stopped");
+        return;
+    }
+
+    if (strcmp(args, "clear") == 0)
+    {
+        profiler->Clear();
+        SendLine("Samples cleared");
+        return;
+    }
+
+    if (strcmp(args, "dump") == 0)
+    {
+        // A consistent snapshot; sending yields, so sampling would go on meanwhile
+        const boolean wasRunning = profiler->IsRunning();
+        profiler->Stop();
+        unsigned cursor = 0;
+        CString dumpLine;
+        while (profiler->FormatLine(cursor, dumpLine))
+        {
+            SendLine(dumpLine.c_str());
+        }
+        if (wasRunning)
+        {
+            profiler->Start(profiler->GetRate());
+        }
+        return;
+    }
+
+    if (strcmp(args, "save") == 0)
+    {
+        SendLine(profiler->Save() ? "Profile written to SD:/PROFILE.TXT" : "Cannot write SD:/PROFILE.TXT");
+        return;
+    }
+
+    if (*args != '\0')
+    {
+        SendLine("Usage: profile [start [hz]|stop|clear|dump|save]");
+        return;
+    }
+
+    CString statusLine;
+    statusLine.Format("PC sampling %s at %u Hz: %u samples in %u ms, %u dropped",
+                      profiler->IsRunning() ? "running" : "stopped", profiler->GetRate(),
+                      static_cast<unsigned>(profiler->GetSampleCount()), profiler->GetSampledMs(),
+                      static_cast<unsigned>(profiler->GetDroppedCount()));
+    SendLine(statusLine.c_str());
+}
+
+void CTWlanLog::HandleScreenCommand(const char *args)
+{
+    CTRenderer *renderer = CTRenderer::Get();
+    if (renderer == nullptr)
+    {
+        SendLine("Screen not available");
+        return;
+    }
+
+    const unsigned rows = renderer->GetRows();
+    const unsigned columns = renderer->GetColumns();
+
+    while (*args == ' ')
+    {
+        ++args;
+    }
+
+    if (*args == '\0')
+    {
+        SendScreenRows(0, rows, 0, columns, 0);
+        return;
+    }
+
+    if (strncmp(args, "since", 5) == 0)
+    {
+        args += 5;
+        unsigned since = 0;
+        if (!ParseUnsignedArg(args, since))
+        {
+            SendLine("Usage: screen since <seq>");
+            return;
+        }
+
+        SendScreenRows(0, rows, 0, columns, since);
+        return;
+    }
+
+    if (strncmp(args, "rect", 4) == 0)
+    {
+        args += 4;
+        unsigned top = 0;
+        unsigned left = 0;
+        unsigned bottom = 0;
+        unsigned right = 0;
+        if (!ParseUnsignedArg(args, top) || !ParseUnsignedArg(args, left) ||
+            !ParseUnsignedArg(args, bottom) || !ParseUnsignedArg(args, right) ||
+            top == 0 || left == 0 || top > bottom || left > right)
+        {
+            SendLine("Usage: screen rect <top> <left> <bottom> <right>");
+            return;
+        }
+
+        SendScreenRows(top - 1, bottom < rows ? bottom : rows, left - 1, right < columns ? right : columns, 0);
+        return;
+    }
+
+    SendLine("Usage: screen [rect <top> <left> <bottom> <right> | since <seq>]");
+}
+
+void CTWlanLog::SendScreenRows(unsigned nTopRow, unsigned nEndRow, unsigned nFirstColumn, unsigned nEndColumn, u32 nSince)
+{
+    CTRenderer *renderer = CTRenderer::Get();
+    if (renderer == nullptr)
+    {
+        return;
+    }
+
+    // Rows changed while we copy carry a newer generation and show up in the next poll
+    const u32 sequence = renderer->GetCellGeneration();
+
+    CString line;
+    line.Format("seq %u rows %u cols %u", sequence, renderer->GetRows(), renderer->GetColumns());
+    SendLine(line.c_str());
+
+    CTCellBuffer::TCell cells[ScreenQueryMaxColumns];
+    char text[ScreenQueryMaxColumns + 1];
+    for (unsigned row = nTopRow; row < nEndRow; ++row)
+    {
+        if (renderer->GetCellRowGeneration(row) <= nSince)
+        {
+            continue;
+        }
+
+        const unsigned count = renderer->CopyCellRow(row, cells, ScreenQueryMaxColumns);
+        const unsigned end = nEndColumn < count ? nEndColumn : count;
+
+        unsigned length = 0;
+        for (unsigned column = nFirstColumn; column < end; ++column)
+        {
+            text[length++] = CellToAscii(cells[column]);
+        }
+
+        while (length > 0 && text[length - 1] == ' ')
+        {
+            --length;
+        }
+        text[length] = '\0';
+
+        line.Format("%u:%s", row + 1, text);
+        SendLine(line.c_str());
+    }
+
+    SendLine("end");
+}
+
 bool CTWlanLog::EnsureListenSocket()
 {
     if (m_pListenSocket != nullptr)
@@ -758,7 +1187,10 @@ void CTWlanLog::AcceptClient()
 
     CIPAddress remoteIP;
     u16 remotePort = 0;
+    // Waiting for a client is idle time, not a stall
+    CTStallWatchdog::Get()->Disarm(CTStallWatchdog::WatchNetwork);
     CSocket *newClient = m_pListenSocket->Accept(&remoteIP, &remotePort);
+    CTStallWatchdog::Get()->Beat(CTStallWatchdog::WatchNetwork);
     if (newClient == nullptr)
     {
         return;
@@ -833,6 +1265,9 @@ void CTWlanLog::CloseClient(const char *reason, bool sendLocked)
     bool disconnected = false;
     bool wasHostMode = m_HostModeActive;
 
+    // Recursive for a send failing inside Send(); other tasks wait until the
+    // current block is out before the deflate stream is reset
+    m_StreamLock.Acquire();
     if (!sendLocked)
     {
         m_SendLock.Acquire();
@@ -844,6 +1279,13 @@ void CTWlanLog::CloseClient(const char *reason, bool sendLocked)
     m_pClientSocket = nullptr;
     m_ConnectionLock.Release();
 
+    CString compressStats;
+    const bool haveCompressStats = m_CompressBytesIn > 0;
+    if (client && haveCompressStats)
+    {
+        FormatCompressionStats(compressStats);
+    }
+
     if (client)
     {
         disconnected = true;
@@ -892,6 +1334,7 @@ void CTWlanLog::CloseClient(const char *reason, bool sendLocked)
     {
         m_SendLock.Release();
     }
+    m_StreamLock.Release();
 
     if (disconnected && m_pLogger)
     {
@@ -904,6 +1347,11 @@ void CTWlanLog::CloseClient(const char *reason, bool sendLocked)
             m_pLogger->Write(FromTerminal, LogNotice, "Client disconnected");
         }
 
+        if (haveCompressStats)
+        {
+            m_pLogger->Write(FromTerminal, LogNotice, "%s", compressStats.c_str());
+        }
+
         if (m_pFallback != nullptr)
         {
             m_pLogger->Write(FromTerminal, LogNotice,
@@ -925,7 +1373,9 @@ void CTWlanLog::HandleIncomingData()
     }
 
     char buffer[RxChunkSize];
+    CTStallWatchdog::Get()->Disarm(CTStallWatchdog::WatchNetwork);
     int received = client->Receive(buffer, sizeof buffer, 0);
+    CTStallWatchdog::Get()->Beat(CTStallWatchdog::WatchNetwork);
     if (received <= 0)
     {
         if (m_pLogger)
@@ -935,6 +1385,7 @@ void CTWlanLog::HandleIncomingData()
         CloseClient("receive failed");
         return;
     }
+    m_RxBytes += static_cast<u32>(received);
 
     CString chunkLog;
     for (int i = 0; i < received; ++i)
@@ -1110,7 +1561,20 @@ bool CTWlanLog::HandleTelnetByte(u8 byte)
         return true;
 
     case TelnetStateCommand:
-        if (m_TelnetCommand == TelnetDO)
+        if (m_TelnetCommand == TelnetDO && byte == TelnetOptCompress2 && m_CompressOffered)
+        {
+            // Accepts our offer; a repeated DO changes nothing
+            if (!m_CompressActive)
+            {
+                StartCompression();
+            }
+        }
+        else if (m_TelnetCommand == TelnetDONT && byte == TelnetOptCompress2)
+        {
+            m_CompressOffered = false;
+            StopCompression();
+        }
+        else if (m_TelnetCommand == TelnetDO)
         {
             if (byte == TelnetOptSuppressGoAhead || byte == TelnetOptEcho)
             {
@@ -1180,6 +1644,13 @@ void CTWlanLog::SendTelnetNegotiation()
     SendTelnetCommand(TelnetWILL, TelnetOptEcho);
     SendTelnetCommand(TelnetDONT, TelnetOptLineMode);
 
+    CTConfig *config = CTConfig::Get();
+    if (config != nullptr && config->GetTelnetCompressEnabled())
+    {
+        SendTelnetCommand(TelnetWILL, TelnetOptCompress2);
+        m_CompressOffered = true;
+    }
+
     m_TelnetNegotiated = true;
 }
 
@@ -1219,4 +1690,12 @@ void CTWlanLog::ResetConnectionState()
     m_TelnetNegotiated = false;
     m_TelnetRxState = TelnetStateData;
     m_TelnetCommand = 0;
+    m_Deflate.Reset();
+    m_CompressOffered = false;
+    m_CompressActive = false;
+    m_CompressPlainUntilUs = 0;
+    m_CompressBytesIn = 0;
+    m_CompressBytesOut = 0;
+    m_CompressCpuUs = 0;
+    m_CompressFallbacks = 0;
 }
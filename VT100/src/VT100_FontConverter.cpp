@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 // Change Log:
 // 2025-12-05     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Pre-shaded CRT glyph atlases
+// 2026-10-18     R. Zuehlsdorff        Generated atlases and per-glyph row masks
 //------------------------------------------------------------------------------
 
 #include <circle/types.h>
@@ -740,3 +742,206 @@ void ConvertVT100Font(void)
     ConvertVT100GraphicsToCircle_SolidDoubling();
     ConvertVT100GraphicsToCircle_8x20();
 }
+
+// CRT glyph atlases
+//
+// Every pixel of a glyph cell gets an intensity level. Lit dots are full
+// intensity; bloom lights the dots left and right of a stroke like a beam that
+// does not switch off instantly, glow adds a faint halo in all directions.
+// Every second ROM scan line is then darkened by the scan-line strength, which
+// doubles with the glyph in double-height lines.
+
+static inline boolean IsGlyphDot(const CCharGenerator &rCharGen, const CCharGenerator::TPixelLine *pLines,
+                                 int x, int y, unsigned width, unsigned height)
+{
+    if (x < 0 || y < 0 || static_cast<unsigned>(x) >= width || static_cast<unsigned>(y) >= height)
+    {
+        return FALSE;
+    }
+    return rCharGen.GetPixel(static_cast<unsigned>(x), pLines[y]);
+}
+
+static void ShadeGlyph(const CCharGenerator &rCharGen, char chChar, boolean bDoubleHeight,
+                       const TCrtEffects &rEffects, u8 *pLevels, CCharGenerator::TPixelLine *pLines)
+{
+    const unsigned width = rCharGen.GetCharWidth();
+    const unsigned height = rCharGen.GetCharHeight();
+    const unsigned fullLevel = CrtShadeLevels - 1;
+    const unsigned bloomLevel = (fullLevel * rEffects.bloom + 100) / 200;
+    const unsigned glowLevel = (fullLevel * rEffects.glow + 150) / 300;
+
+    for (unsigned y = 0; y < height; ++y)
+    {
+        pLines[y] = rCharGen.GetPixelLine(chChar, y);
+    }
+
+    for (unsigned y = 0; y < height; ++y)
+    {
+        const unsigned scanLine = bDoubleHeight ? y / 2 : y;
+        const boolean bDarkLine = (scanLine & 1) != 0;
+
+        for (unsigned x = 0; x < width; ++x)
+        {
+            const int px = static_cast<int>(x);
+            const int py = static_cast<int>(y);
+            unsigned level = 0;
+
+            if (IsGlyphDot(rCharGen, pLines, px, py, width, height))
+            {
+                level = fullLevel;
+            }
+            else
+            {
+                if (bloomLevel != 0 && (IsGlyphDot(rCharGen, pLines, px - 1, py, width, height)
+                                        || IsGlyphDot(rCharGen, pLines, px + 1, py, width, height)))
+                {
+                    level = bloomLevel;
+                }
+
+                if (glowLevel > level)
+                {
+                    for (int dy = -1; dy <= 1 && level < glowLevel; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            if (IsGlyphDot(rCharGen, pLines, px + dx, py + dy, width, height))
+                            {
+                                level = glowLevel;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (bDarkLine && rEffects.scanlines != 0)
+            {
+                level = (level * (100 - rEffects.scanlines) + 50) / 100;
+            }
+
+            *pLevels++ = static_cast<u8>(level);
+        }
+    }
+}
+
+boolean BuildCrtGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags,
+                           const TCrtEffects &rEffects, TCrtGlyphAtlas &rAtlas)
+{
+    CCharGenerator charGen(rFont, FontFlags);
+
+    TCrtEffects effects = rEffects;
+    effects.scanlines = effects.scanlines > 100 ? 100 : effects.scanlines;
+    effects.bloom = effects.bloom > 100 ? 100 : effects.bloom;
+    effects.glow = effects.glow > 100 ? 100 : effects.glow;
+
+    rAtlas.width = charGen.GetCharWidth();
+    rAtlas.height = charGen.GetCharHeight();
+    rAtlas.firstChar = rFont.first_char;
+    rAtlas.lastChar = rFont.last_char;
+
+    rAtlas.levels = nullptr;
+    rAtlas.rowMasks = nullptr;
+    rAtlas.storage = nullptr;
+    if (rAtlas.height > MaxGlyphAtlasHeight)
+    {
+        return FALSE;
+    }
+
+    const unsigned glyphSize = rAtlas.width * rAtlas.height;
+    const unsigned glyphCount = rAtlas.lastChar - rAtlas.firstChar + 2;
+
+    // Row masks first, then the levels, in one block
+    rAtlas.storage = new u64[glyphCount + (glyphCount * glyphSize + sizeof(u64) - 1) / sizeof(u64)];
+    CCharGenerator::TPixelLine *pLines = new CCharGenerator::TPixelLine[rAtlas.height];
+    if (rAtlas.storage == nullptr || pLines == nullptr)
+    {
+        delete[] pLines;
+        FreeCrtGlyphAtlas(rAtlas);
+        return FALSE;
+    }
+    u64 *pMasks = rAtlas.storage;
+    u8 *pLevels = reinterpret_cast<u8 *>(rAtlas.storage + glyphCount);
+
+    const boolean bDoubleHeight = (FontFlags & CCharGenerator::FontFlagsDoubleHeight) != 0;
+    for (unsigned code = rAtlas.firstChar; code <= rAtlas.lastChar; ++code)
+    {
+        ShadeGlyph(charGen, static_cast<char>(code), bDoubleHeight, effects,
+                   pLevels + (code - rAtlas.firstChar) * glyphSize, pLines);
+    }
+
+    // Blank glyph for codes the font does not cover
+    u8 *pBlank = pLevels + (glyphCount - 1) * glyphSize;
+    for (unsigned i = 0; i < glyphSize; ++i)
+    {
+        pBlank[i] = 0;
+    }
+
+    for (unsigned glyph = 0; glyph < glyphCount; ++glyph)
+    {
+        const u8 *pGlyph = pLevels + glyph * glyphSize;
+        u64 mask = 0;
+        for (unsigned y = 0; y < rAtlas.height; ++y)
+        {
+            for (unsigned x = 0; x < rAtlas.width; ++x)
+            {
+                if (pGlyph[y * rAtlas.width + x] != 0)
+                {
+                    mask |= static_cast<u64>(1) << y;
+                    break;
+                }
+            }
+        }
+        pMasks[glyph] = mask;
+    }
+
+    rAtlas.levels = pLevels;
+    rAtlas.rowMasks = pMasks;
+    delete[] pLines;
+    return TRUE;
+}
+
+// Generated by tools/host_renderer/VT100_ATLAS from the conversions above; the
+// generator itself is built without it, so a stale header cannot feed back
+#ifndef VT100_GLYPH_ATLAS_GENERATOR
+#include "VT100_GlyphAtlas.h"
+#endif
+
+boolean GetGeneratedGlyphAtlas(const TFont &rFont, CCharGenerator::TFontFlags FontFlags, TCrtGlyphAtlas &rAtlas)
+{
+#ifdef VT100_GLYPH_ATLAS_GENERATOR
+    (void)rFont;
+    (void)FontFlags;
+    (void)rAtlas;
+    return FALSE;
+#else
+    if (FontFlags != CCharGenerator::FontFlagsNone)
+    {
+        return FALSE;
+    }
+
+    for (const VT100GlyphAtlas::TEntry &rEntry : VT100GlyphAtlas::Entries)
+    {
+        if (&GetVT100Font(rEntry.font) == &rFont)
+        {
+            rAtlas.width = rEntry.width;
+            rAtlas.height = rEntry.height;
+            rAtlas.firstChar = rEntry.firstChar;
+            rAtlas.lastChar = rEntry.lastChar;
+            rAtlas.levels = rEntry.levels;
+            rAtlas.rowMasks = rEntry.rowMasks;
+            rAtlas.storage = nullptr;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+#endif
+}
+
+void FreeCrtGlyphAtlas(TCrtGlyphAtlas &rAtlas)
+{
+    delete[] rAtlas.storage;
+    rAtlas.storage = nullptr;
+    rAtlas.levels = nullptr;
+    rAtlas.rowMasks = nullptr;
+}
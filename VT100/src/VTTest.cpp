@@ -269,6 +269,14 @@ void CVTTest::Start(void)
         m_hasSavedSmoothScroll = true;
         m_savedWrapAround = config->GetWrapAroundEnabled() ? TRUE : FALSE;
         m_hasSavedWrapAround = true;
+    }
+    // The snapshot holds the tab stops; without one they are saved here
+    if (m_pRenderer != nullptr && m_nSnapshot == 0)
+    {
+        m_nSnapshot = m_pRenderer->TakeSnapshot();
+    }
+    if (config != nullptr && m_nSnapshot == 0)
+    {
         for (unsigned i = 0; i < CTConfig::TabStopsMax; ++i)
         {
             m_savedTabStops[i] = config->IsTabStop(i);
@@ -374,15 +382,21 @@ void CVTTest::Stop(void)
 
     if (m_pRenderer != nullptr)
     {
-        // Reset permanent settings via escape sequences
-        const unsigned rows = m_pRenderer->GetRows();
-        if (rows > 0)
+        // The snapshot brings back screen, modes, cursor shape and tab stops as
+        // they were before the test; without one reset what the tests change
+        const bool restored = m_nSnapshot != 0 && m_pRenderer->RestoreSnapshot(m_nSnapshot);
+        m_nSnapshot = 0;
+        if (!restored)
         {
-            CString resetSeq;
-            resetSeq.Format("\x1B[1;%ur\x1B[4l", rows);
-            m_pRenderer->Write(resetSeq.c_str(), resetSeq.GetLength());
+            const unsigned rows = m_pRenderer->GetRows();
+            if (rows > 0)
+            {
+                CString resetSeq;
+                resetSeq.Format("\x1B[1;%ur\x1B[4l", rows);
+                m_pRenderer->Write(resetSeq.c_str(), resetSeq.GetLength());
+            }
+            m_pRenderer->ResetParserState();
         }
-        m_pRenderer->ResetParserState();
         if (config != nullptr)
         {
             if (m_hasSavedSmoothScroll)
@@ -404,10 +418,16 @@ void CVTTest::Stop(void)
                 }
                 m_hasSavedTabStops = false;
             }
-            m_pRenderer->SetCursorBlock(config->GetCursorBlock());
-            m_pRenderer->SetBlinkingCursor(config->GetCursorBlinking(), 500);
+            if (!restored)
+            {
+                m_pRenderer->SetCursorBlock(config->GetCursorBlock());
+                m_pRenderer->SetBlinkingCursor(config->GetCursorBlinking(), 500);
+            }
+        }
+        if (!restored)
+        {
+            m_pRenderer->SetCursorMode(TRUE);
         }
-        m_pRenderer->SetCursorMode(TRUE);
     }
 }
 
@@ -439,7 +459,7 @@ void CVTTest::Tick(void)
     if (m_bStopRequested)
     {
         m_bStopRequested = false;
-        if (m_pRenderer != nullptr)
+        if (m_pRenderer != nullptr && m_nSnapshot == 0)
         {
             m_pRenderer->ClearDisplay();
             m_pRenderer->Goto(0, 0);
@@ -8,6 +8,19 @@
 // Change Log:
 // 2026-01-18     R. Zuehlsdorff        Initial creation
 // 2026-02-10     R. Zuehlsdorff        Added periodic VTTest tick and key routing
+// 2026-10-18     R. Zuehlsdorff        Added warm resume restore and heartbeat tick
+// 2026-10-18     R. Zuehlsdorff        Route renderer reports (DECRQCRA) to the host
+// 2026-10-18     R. Zuehlsdorff        Predictive local echo for TCP host mode
+// 2026-10-18     R. Zuehlsdorff        Virtual consoles for serial and TCP host (F9)
+// 2026-10-18     R. Zuehlsdorff        Apply CRT glyph effects from the config
+// 2026-10-18     R. Zuehlsdorff        Report UART backlog to the scroll governor
+// 2026-10-18     R. Zuehlsdorff        Forward DECCKM/DECKPAM modes to the keyboard
+// 2026-10-18     R. Zuehlsdorff        Printer controller data captured to SD
+// 2026-10-18     R. Zuehlsdorff        Optional renderer microbenchmark at boot
+// 2026-10-18     R. Zuehlsdorff        Screen log routed to the F8 log pane
+// 2026-10-18     R. Zuehlsdorff        Stall watchdog with trace and state capture
+// 2026-10-18     R. Zuehlsdorff        Performance HUD toggled with F7
+// 2026-10-18     R. Zuehlsdorff        PC sampling profiler
 //------------------------------------------------------------------------------
 
 // Include class header
@@ -16,6 +29,7 @@
 // Full class definitions for classes used in this module
 // Include Circle core components
 #include <circle/bcmframebuffer.h>
+#include <circle/memory.h>
 #include <circle/sched/task.h>
 #include <circle/spinlock.h>
 #include <circle/string.h>
@@ -33,6 +47,14 @@
 #include "TFileLog.h"
 #include "TWlanLog.h"
 #include "TSetup.h"
+#include "TWarmResume.h"
+#include "TPredictiveEcho.h"
+#include "TPrintCapture.h"
+#include "TRenderBench.h"
+#include "TLogPane.h"
+#include "TPerfHud.h"
+#include "TSampleProfiler.h"
+#include "TStallWatchdog.h"
 #include "VTTest.h"
 
 LOGMODULE("CKernel");
@@ -65,6 +87,9 @@ static const char *GetWlanModeName(unsigned int mode)
 static volatile unsigned s_f12PressCount = 0;
 static volatile unsigned s_f11PressCount = 0;
 static volatile unsigned s_f10PressCount = 0;
+static volatile unsigned s_f9PressCount = 0;
+static volatile unsigned s_f8PressCount = 0;
+static volatile unsigned s_f7PressCount = 0;
 
 
 
@@ -122,7 +147,31 @@ public:
                 kernel->ToggleLocalMode();
             }
 
+            if (s_f9PressCount != 0)
+            {
+                --s_f9PressCount;
+                kernel->CycleConsole();
+            }
+
+            if (s_f8PressCount != 0)
+            {
+                --s_f8PressCount;
+                kernel->ToggleLogPane();
+            }
+
+            if (s_f7PressCount != 0)
+            {
+                --s_f7PressCount;
+                kernel->TogglePerfHud();
+            }
+
+            kernel->RunConsoleTick();
             kernel->RunVTTestTick();
+            kernel->RunWarmResumeTick();
+            kernel->RunPredictiveEchoTick();
+            kernel->RunLogPaneTick();
+            kernel->RunPerfHudTick();
+            kernel->RunStallWatchdogTick();
 
             CScheduler::Get()->MsSleep(PERIODIC_TASK_INTERVAL_MS);
         }
@@ -153,13 +202,49 @@ static void onKeyPressed(const char *pString)
             return;
         }
 
-        kernel->SendHostOutput(pString, strlen(pString));
+        kernel->SendKeyboardOutput(pString, strlen(pString));
         return;
     }
 
     CTUART::Get()->Send(pString, strlen(pString));
 }
 
+static void onRendererReply(unsigned nConsole, const char *pData, size_t nLength)
+{
+    CKernel *kernel = CKernel::Get();
+    if (kernel == nullptr || kernel->IsLocalModeEnabled())
+    {
+        // Reports answer host requests; in local mode there is no host to answer
+        return;
+    }
+
+    kernel->SendConsoleOutput(nConsole, pData, nLength);
+}
+
+static void onKeyModesChanged(unsigned nModes)
+{
+    // Only a byte store; runs right after the renderer released its lock
+    CTKeyboard::Get()->SetKeyModes(nModes);
+}
+
+static void onPrintData(CTRenderer::TPrintEvent Event, const char *pData, size_t nLength)
+{
+    // Renderer lock is held; the capture only copies into its ring buffer
+    CTPrintCapture *pCapture = CTPrintCapture::Get();
+    switch (Event)
+    {
+    case CTRenderer::PrintJobStart:
+        pCapture->BeginJob();
+        break;
+    case CTRenderer::PrintJobData:
+        pCapture->Write(pData, nLength);
+        break;
+    case CTRenderer::PrintJobEnd:
+        pCapture->EndJob();
+        break;
+    }
+}
+
 static void onKeyPressedRaw(unsigned char ucModifiers, const unsigned char RawKeys[6])
 {
     (void)ucModifiers;
@@ -167,9 +252,15 @@ static void onKeyPressedRaw(unsigned char ucModifiers, const unsigned char RawKe
     static bool s_f12Down = false;
     static bool s_f11Down = false;
     static bool s_f10Down = false;
+    static bool s_f9Down = false;
+    static bool s_f8Down = false;
+    static bool s_f7Down = false;
     bool f12Down = false;
     bool f11Down = false;
     bool f10Down = false;
+    bool f9Down = false;
+    bool f8Down = false;
+    bool f7Down = false;
 
     for (unsigned i = 0; i < 6; ++i)
     {
@@ -185,6 +276,18 @@ static void onKeyPressedRaw(unsigned char ucModifiers, const unsigned char RawKe
         {
             f12Down = true;
         }
+        if (RawKeys[i] == 0x42)
+        {
+            f9Down = true;
+        }
+        if (RawKeys[i] == 0x41)
+        {
+            f8Down = true;
+        }
+        if (RawKeys[i] == 0x40)
+        {
+            f7Down = true;
+        }
     }
 
     if (f11Down && !s_f11Down)
@@ -202,9 +305,27 @@ static void onKeyPressedRaw(unsigned char ucModifiers, const unsigned char RawKe
         ++s_f10PressCount;
     }
 
+    if (f9Down && !s_f9Down)
+    {
+        ++s_f9PressCount;
+    }
+
+    if (f8Down && !s_f8Down)
+    {
+        ++s_f8PressCount;
+    }
+
+    if (f7Down && !s_f7Down)
+    {
+        ++s_f7PressCount;
+    }
+
     s_f11Down = f11Down;
     s_f12Down = f12Down;
     s_f10Down = f10Down;
+    s_f9Down = f9Down;
+    s_f8Down = f8Down;
+    s_f7Down = f7Down;
 }
 
 static CPeriodicTask *s_pPeriodicTask = nullptr;
@@ -234,6 +355,13 @@ CKernel::CKernel(void)
             m_pWlanLog(nullptr),
             m_pSetup(nullptr),
             m_pVTTest(nullptr),
+            m_pWarmResume(nullptr),
+            m_pPredictiveEcho(nullptr),
+            m_pPrintCapture(nullptr),
+            m_pLogPane(nullptr),
+            m_pPerfHud(nullptr),
+            m_pSampleProfiler(nullptr),
+            m_pStallWatchdog(nullptr),
             m_pLogTarget(nullptr),
             m_pNullLog(nullptr),
             m_bWlanLoggerEnabled(FALSE),
@@ -243,7 +371,9 @@ CKernel::CKernel(void)
             m_bWaitingMessageActive(false),
             m_bWaitingMessageShowsIP(false),
             m_bScreenLoggerEnabled(true),
-            m_bLocalModeEnabled(false)
+            m_bLocalModeEnabled(false),
+            m_bScreenResumed(false),
+            m_bHostSessionActive(false)
 {
     s_pThis = this;
 
@@ -257,6 +387,13 @@ CKernel::CKernel(void)
     m_pWlanLog = CTWlanLog::Get();
     m_pSetup = CTSetup::Get();
     m_pVTTest = new CVTTest();
+    m_pWarmResume = CTWarmResume::Get();
+    m_pPredictiveEcho = CTPredictiveEcho::Get();
+    m_pPrintCapture = CTPrintCapture::Get();
+    m_pLogPane = CTLogPane::Get();
+    m_pPerfHud = CTPerfHud::Get();
+    m_pSampleProfiler = CTSampleProfiler::Get();
+    m_pStallWatchdog = CTStallWatchdog::Get();
     s_pPeriodicTask = new CPeriodicTask();
 }
 
@@ -322,6 +459,103 @@ void CKernel::RunVTTestTick()
     }
 }
 
+void CKernel::RunWarmResumeTick()
+{
+    // Never persist the SET-UP overlay or VT test screens
+    if (m_pWarmResume == nullptr
+        || (m_pSetup != nullptr && m_pSetup->IsVisible())
+        || (m_pVTTest != nullptr && m_pVTTest->IsActive()))
+    {
+        return;
+    }
+
+    m_pWarmResume->Tick();
+}
+
+void CKernel::RunPredictiveEchoTick()
+{
+    if (m_pPredictiveEcho == nullptr)
+    {
+        return;
+    }
+
+    if (!IsTcpHostOnScreen())
+    {
+        m_pPredictiveEcho->Reset();
+        return;
+    }
+
+    m_pPredictiveEcho->Tick();
+}
+
+void CKernel::ToggleLogPane()
+{
+    if (m_pLogPane != nullptr)
+    {
+        m_pLogPane->Toggle();
+    }
+}
+
+void CKernel::RunLogPaneTick()
+{
+    if (m_pLogPane == nullptr)
+    {
+        return;
+    }
+
+    // SET-UP and the VT test draw over the whole screen; the pane waits for them
+    const bool bScreenFree = !(m_pSetup != nullptr && m_pSetup->IsVisible())
+                             && !(m_pVTTest != nullptr && m_pVTTest->IsActive());
+    m_pLogPane->Tick(bScreenFree ? TRUE : FALSE);
+}
+
+void CKernel::TogglePerfHud()
+{
+    if (m_pPerfHud != nullptr)
+    {
+        m_pPerfHud->Toggle();
+    }
+}
+
+void CKernel::RunPerfHudTick()
+{
+    if (m_pPerfHud == nullptr)
+    {
+        return;
+    }
+
+    const bool bScreenFree = !(m_pSetup != nullptr && m_pSetup->IsVisible())
+                             && !(m_pVTTest != nullptr && m_pVTTest->IsActive());
+    m_pPerfHud->Tick(bScreenFree ? TRUE : FALSE);
+}
+
+static void samplePerfHud(CTPerfHud::TSample &rSample)
+{
+    CTUART *pUART = CTUART::Get();
+    rSample.nUartOverruns = pUART->GetOverrunCount();
+    rSample.bFlowControl = pUART->IsFlowControlEnabled() ? TRUE : FALSE;
+    rSample.bXoff = pUART->IsFlowStopped() ? TRUE : FALSE;
+
+    CTWlanLog *pWlanLog = CTWlanLog::Get();
+    rSample.nNetRxBytes = pWlanLog->GetRxByteCount();
+    rSample.nNetTxBytes = pWlanLog->GetTxByteCount();
+
+    rSample.nFreeHeap = CMemorySystem::Get()->GetHeapFreeSpace(HEAP_ANY);
+}
+
+void CKernel::RunStallWatchdogTick()
+{
+    if (m_pStallWatchdog != nullptr)
+    {
+        m_pStallWatchdog->Tick();
+    }
+}
+
+static u32 sampleRendererLoop(void)
+{
+    return CTRenderer::Get()->GetLoopCount();
+}
+
 bool CKernel::HandleVTTestKey(const char *pString)
 {
     if (m_pVTTest != nullptr && m_pVTTest->IsActive())
@@ -381,6 +615,13 @@ boolean CKernel::Initialize(void)
             m_pLogTarget = m_pNullLog;
             m_Logger.SetNewTarget(m_pLogTarget);
         }
+        else if (m_pLogPane != nullptr && m_pConfig->GetLogPaneEnabled())
+        {
+            // Screen lines keep going to the screen device until the renderer is up
+            m_pLogPane->Initialize(m_pLogTarget);
+            m_pLogTarget = m_pLogPane;
+            m_Logger.SetNewTarget(m_pLogTarget);
+        }
 
         if (logToFile && m_pFileLog != nullptr)
         {
@@ -483,6 +724,13 @@ boolean CKernel::Initialize(void)
         m_HAL.ConfigureBuzzerVolume(m_pConfig->GetBuzzerVolume());
         m_HAL.ConfigureRxTxSwap(m_pConfig->GetSwitchTxRx() != 0);
 
+        // Early enough to profile font conversion and the rest of the boot
+        if (m_pSampleProfiler != nullptr && m_pSampleProfiler->Initialize(&m_Interrupt)
+            && m_pConfig->GetProfileRate() != 0)
+        {
+            m_pSampleProfiler->Start(m_pConfig->GetProfileRate());
+        }
+
         bool logToScreen = true;
         bool logToFile = false;
         bool logToWlan = false;
@@ -514,6 +762,30 @@ boolean CKernel::Initialize(void)
         m_pRenderer->SetVT52Mode(m_pConfig->GetVT52ModeEnabled() ? TRUE : FALSE);
         m_pRenderer->SetSmoothScrollEnabled(m_pConfig->GetSmoothScrollEnabled() ? TRUE : FALSE);
         m_pRenderer->ClearDisplay();
+        m_pRenderer->RegisterReplyHandler(&onRendererReply);
+        m_pRenderer->RegisterKeyModeHandler(&onKeyModesChanged);
+
+        // From here on log lines no longer draw over the host screen
+        if (m_pLogPane != nullptr && m_pLogPane->IsInitialized())
+        {
+            m_pLogPane->Attach(m_pRenderer);
+        }
+
+        if (m_pPerfHud != nullptr)
+        {
+            m_pPerfHud->Initialize(m_pRenderer, &samplePerfHud);
+        }
+    }
+
+    // Before anything else draws: the benchmark takes over and clears the screen
+    if (m_pConfig != nullptr && m_pConfig->GetRenderBenchEnabled())
+    {
+        CTRenderBench::Run(m_pRenderer);
+    }
+
+    if (m_pPredictiveEcho != nullptr && m_pConfig != nullptr)
+    {
+        m_pPredictiveEcho->Initialize(m_pRenderer, m_pConfig->GetPredictiveEcho());
     }
 
     if (m_pVTTest != nullptr)
@@ -521,6 +793,24 @@ boolean CKernel::Initialize(void)
         m_pVTTest->Initialize(m_pRenderer);
     }
 
+    // Restore the previous screen before any host byte can arrive
+    if (m_pWarmResume != nullptr && m_pConfig != nullptr && m_pConfig->GetWarmResumeEnabled())
+    {
+        if (m_pWarmResume->Initialize(m_pRenderer, m_pConfig))
+        {
+            m_bScreenResumed = m_pWarmResume->Restore();
+        }
+    }
+
+    // Printer controller mode (CSI 5 i) writes the host data to SD:/PRINTnnn.TXT
+    if (m_pPrintCapture != nullptr && m_pConfig != nullptr && m_pConfig->GetPrintCaptureEnabled())
+    {
+        if (m_pPrintCapture->Initialize())
+        {
+            m_pRenderer->RegisterPrintHandler(&onPrintData);
+        }
+    }
+
 
     if (m_pKeyboard != nullptr)
     {
@@ -571,20 +861,27 @@ boolean CKernel::Initialize(void)
         CString banner;
         banner.Format("\r\n%s (%s %s)\r\n", StartupBannerPrefix, __DATE__, __TIME__);
 
-        if (m_pRenderer != nullptr)
+        // A resumed screen is left untouched so the host can continue on it
+        if (m_pRenderer != nullptr && !m_bScreenResumed)
         {
             m_pRenderer->Write(banner.c_str(), banner.GetLength());
         }
 
         LOGNOTE("Startup: %s", (const char *)banner);
-        m_Timer.MsDelay(StartupBannerDelayMs);
+        if (!m_bScreenResumed)
+        {
+            m_Timer.MsDelay(StartupBannerDelayMs);
+        }
 
         if (m_pConfig != nullptr && m_pRenderer != nullptr)
         {
             CString wlanStatus;
             const unsigned int wlanModePolicy = m_pConfig->GetWlanHostAutoStart();
             wlanStatus.Format("\r\nConfig loaded: %s mode active\r\n", GetWlanModeName(wlanModePolicy));
-            m_pRenderer->Write(wlanStatus.c_str(), wlanStatus.GetLength());
+            if (!m_bScreenResumed)
+            {
+                m_pRenderer->Write(wlanStatus.c_str(), wlanStatus.GetLength());
+            }
             LOGNOTE("Config loaded: %s mode active", GetWlanModeName(wlanModePolicy));
         }
     }
@@ -625,9 +922,23 @@ TShutdownMode CKernel::Run(void)
         MarkTelnetWaiting();
     }
 
+    // Armed only now: Initialize() busy-waits and would count as a stall
+    if (m_pStallWatchdog != nullptr && m_pConfig != nullptr)
+    {
+        if (m_pStallWatchdog->Initialize(m_pConfig->GetStallTimeout(), m_pConfig->GetStallRebootEnabled() ? TRUE : FALSE))
+        {
+            m_pStallWatchdog->WatchCounter(CTStallWatchdog::WatchRenderer, &sampleRendererLoop);
+        }
+    }
+
 
     while (1)
     {
+        if (m_pStallWatchdog != nullptr)
+        {
+            m_pStallWatchdog->Beat(CTStallWatchdog::WatchMainLoop);
+        }
+
         ProcessSerial();
 
         if (m_bWlanLoggerEnabled)
@@ -707,6 +1018,13 @@ void CKernel::ApplyRuntimeConfig()
     if (m_pRenderer != nullptr)
     {
         m_pRenderer->SetColors(m_pConfig->GetTextColor(), m_pConfig->GetBackgroundColor());
+
+        TCrtEffects effects;
+        effects.scanlines = m_pConfig->GetCrtScanlines();
+        effects.bloom = m_pConfig->GetCrtBloom();
+        effects.glow = m_pConfig->GetCrtGlowForTextColor();
+        m_pRenderer->SetCrtEffects(effects);
+
         m_pRenderer->SetFont(m_pConfig->GetFontSelection(), CCharGenerator::FontFlagsNone);
         m_pRenderer->SetCursorBlock(m_pConfig->GetCursorBlock());
         m_pRenderer->SetBlinkingCursor(m_pConfig->GetCursorBlinking(), 500);
@@ -714,18 +1032,53 @@ void CKernel::ApplyRuntimeConfig()
         m_pRenderer->SetSmoothScrollEnabled(m_pConfig->GetSmoothScrollEnabled() ? TRUE : FALSE);
     }
 
+    if (m_pPredictiveEcho != nullptr)
+    {
+        m_pPredictiveEcho->SetMode(m_pConfig->GetPredictiveEcho());
+    }
+
     m_HAL.ConfigureBuzzerVolume(m_pConfig->GetBuzzerVolume());
     m_HAL.ConfigureRxTxSwap(m_pConfig->GetSwitchTxRx() != 0);
 }
 
+void CKernel::SendKeyboardOutput(const char *pData, size_t nLength)
+{
+    SendHostOutput(pData, nLength);
+
+    // Only the TCP host path has enough latency to be worth predicting
+    if (m_pPredictiveEcho != nullptr && IsTcpHostOnScreen())
+    {
+        m_pPredictiveEcho->OnHostInput(pData, nLength);
+    }
+}
+
 void CKernel::SendHostOutput(const char *pData, size_t nLength)
+{
+    const unsigned console = m_pRenderer != nullptr ? m_pRenderer->GetActiveConsole() : ConsoleSerial;
+    SendConsoleOutput(console, pData, nLength);
+}
+
+void CKernel::SendConsoleOutput(unsigned nConsole, const char *pData, size_t nLength)
 {
     if (pData == nullptr || nLength == 0)
     {
         return;
     }
 
-    if (m_pWlanLog != nullptr && m_pWlanLog->IsHostModeActive())
+    const bool bHostMode = m_pWlanLog != nullptr && m_pWlanLog->IsHostModeActive();
+    if (IsVirtualConsolesEnabled())
+    {
+        if (nConsole == ConsoleHost)
+        {
+            // A host console without a TCP session has nobody to talk to
+            if (bHostMode)
+            {
+                m_pWlanLog->SendHostData(pData, nLength);
+            }
+            return;
+        }
+    }
+    else if (bHostMode)
     {
         if (m_pWlanLog->SendHostData(pData, nLength))
         {
@@ -739,6 +1092,87 @@ void CKernel::SendHostOutput(const char *pData, size_t nLength)
     }
 }
 
+bool CKernel::IsVirtualConsolesEnabled() const
+{
+    return m_pConfig != nullptr && m_pConfig->GetVirtualConsolesEnabled();
+}
+
+unsigned CKernel::GetTransportConsole(bool bTcpHost) const
+{
+    if (!IsVirtualConsolesEnabled())
+    {
+        // Legacy routing: both hosts draw on whatever is on screen
+        return m_pRenderer != nullptr ? m_pRenderer->GetActiveConsole() : ConsoleSerial;
+    }
+
+    return bTcpHost ? ConsoleHost : ConsoleSerial;
+}
+
+bool CKernel::IsTcpHostOnScreen() const
+{
+    if (m_pWlanLog == nullptr || !m_pWlanLog->IsHostModeActive())
+    {
+        return false;
+    }
+
+    return !IsVirtualConsolesEnabled()
+           || (m_pRenderer != nullptr && m_pRenderer->GetActiveConsole() == ConsoleHost);
+}
+
+void CKernel::RunConsoleTick()
+{
+    if (m_pWlanLog == nullptr || !IsVirtualConsolesEnabled())
+    {
+        return;
+    }
+
+    const bool bHostSession = m_pWlanLog->IsHostModeActive();
+    if (bHostSession == m_bHostSessionActive)
+    {
+        return;
+    }
+
+    // Bring a new TCP host on screen as before and return to the serial host
+    // when it leaves; retried on the next tick while SET-UP owns the screen
+    if (SwitchConsole(bHostSession ? ConsoleHost : ConsoleSerial))
+    {
+        m_bHostSessionActive = bHostSession;
+    }
+}
+
+void CKernel::CycleConsole()
+{
+    if (m_pRenderer == nullptr || !IsVirtualConsolesEnabled())
+    {
+        return;
+    }
+
+    SwitchConsole((m_pRenderer->GetActiveConsole() + 1) % CTRenderer::MaxConsoles);
+}
+
+bool CKernel::SwitchConsole(unsigned nConsole)
+{
+    if (m_pRenderer == nullptr
+        || (m_pSetup != nullptr && m_pSetup->IsVisible())
+        || (m_pVTTest != nullptr && m_pVTTest->IsActive()))
+    {
+        return false;
+    }
+
+    if (nConsole == m_pRenderer->GetActiveConsole())
+    {
+        return true;
+    }
+
+    // Predictions belong to the screen being replaced
+    if (m_pPredictiveEcho != nullptr)
+    {
+        m_pPredictiveEcho->Reset();
+    }
+
+    return m_pRenderer->SwitchConsole(nConsole);
+}
+
 void CKernel::HandleWlanHostRx(const char *pData, size_t nLength)
 {
     if (pData == nullptr || nLength == 0)
@@ -753,7 +1187,28 @@ void CKernel::HandleWlanHostRx(const char *pData, size_t nLength)
 
     if (m_pRenderer != nullptr)
     {
-        m_pRenderer->Write(pData, nLength);
+        const unsigned console = GetTransportConsole(true);
+        const bool bOnScreen = console == m_pRenderer->GetActiveConsole();
+        if (m_pPredictiveEcho != nullptr && bOnScreen)
+        {
+            m_pPredictiveEcho->BeginHostOutput();
+        }
+
+        if (m_pStallWatchdog != nullptr)
+        {
+            m_pStallWatchdog->Trace(CTStallWatchdog::TraceNetRx, static_cast<u32>(nLength));
+            m_pStallWatchdog->Trace(CTStallWatchdog::TraceRenderBegin, console << 24 | static_cast<u32>(nLength));
+        }
+        m_pRenderer->WriteConsole(console, pData, nLength);
+        if (m_pStallWatchdog != nullptr)
+        {
+            m_pStallWatchdog->Trace(CTStallWatchdog::TraceRenderEnd, console);
+        }
+
+        if (m_pPredictiveEcho != nullptr && bOnScreen)
+        {
+            m_pPredictiveEcho->EndHostOutput();
+        }
     }
 }
 
@@ -764,7 +1219,8 @@ void CKernel::ProcessSerial()
         return;
     }
 
-    if (m_pWlanLog != nullptr && m_pWlanLog->IsHostModeActive())
+    // Without virtual consoles the TCP host owns the shared screen
+    if (!IsVirtualConsolesEnabled() && m_pWlanLog != nullptr && m_pWlanLog->IsHostModeActive())
     {
         return;
     }
@@ -783,7 +1239,22 @@ void CKernel::ProcessSerial()
 
         if (m_pRenderer != nullptr)
         {
-            m_pRenderer->Write(buffer, (size_t)nBytes);
+            // What is still queued tells the scroll governor how far the screen lags behind
+            const unsigned console = GetTransportConsole(false);
+            if (console == m_pRenderer->GetActiveConsole())
+            {
+                m_pRenderer->SetIngestBacklog(m_pUART->GetRxBacklog());
+            }
+            if (m_pStallWatchdog != nullptr)
+            {
+                m_pStallWatchdog->Trace(CTStallWatchdog::TraceSerialRx, static_cast<u32>(nBytes));
+                m_pStallWatchdog->Trace(CTStallWatchdog::TraceRenderBegin, console << 24 | static_cast<u32>(nBytes));
+            }
+            m_pRenderer->WriteConsole(console, buffer, (size_t)nBytes);
+            if (m_pStallWatchdog != nullptr)
+            {
+                m_pStallWatchdog->Trace(CTStallWatchdog::TraceRenderEnd, console);
+            }
         }
     }
     else if (nBytes < 0)
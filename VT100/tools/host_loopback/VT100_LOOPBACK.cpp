@@ -0,0 +1,1021 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_LOOPBACK
+// Description:   Native host loopback responder and traffic generator
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation (replaces VT100_SCREEN_ECHO.py)
+// 2026-10-18     R. Zuehlsdorff        Minimum width for the graphics workload
+//------------------------------------------------------------------------------
+
+/**
+ * @file VT100_LOOPBACK.cpp
+ * @brief Host-side loopback responder and load generator for the VT100 terminal.
+ * @details Build on Linux/macOS with:
+ *
+ *     c++ -O2 -std=c++17 -o VT100_LOOPBACK VT100_LOOPBACK.cpp
+ *
+ * Two operating modes share one I/O layer (stdio, serial/PTY device, TCP host port):
+ *
+ * - respond:  line responder with the same semantics as the former
+ *             VT100_SCREEN_ECHO.py helper (`SIMHOST:` prefix, banner filter,
+ *             `exit\r` on SIGINT/SIGTERM). Used by `VT100_PTY --autorespond`.
+ * - load:     paced workload generator (line floods, cursor-addressed updates,
+ *             SGR churn, DEC special graphics). Every frame starts with a
+ *             sequence tag `~Sxxxxxxxx~`; with `--verify echo` the returned byte
+ *             stream is matched frame-by-frame to report loss, corruption and
+ *             round-trip latency percentiles.
+ *
+ * Echo verification needs a peer that returns the bytes verbatim (TX/RX jumper
+ * on the serial line, a PTY loop, or an echo service on the TCP side).
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    const char SimHostPrefix[] = "SIMHOST: ";
+    const char ShutdownSequence[] = "exit\r";
+
+    const char *const IgnorePrefixes[] = {
+        "wlan-log:",
+        "Welcome to the Circle WLAN logging console",
+        "WLAN mode is active.",
+        "Log output is mirrored here",
+        "Type 'help' for a list of commands.",
+        "Host bridge mode auto-enabled by config.",
+        "Press Ctrl-C or type +++ to return to command mode.",
+    };
+
+    const size_t ReadChunkSize = 4096;
+    const size_t SeqTagLength = 11;     // "~S" + 8 hex digits + "~"
+    const unsigned MinColumns = SeqTagLength + 13;  // tag, box corners and a 10 cell box
+    const unsigned DefaultColumns = 80;
+    const unsigned DefaultRows = 24;
+
+    volatile sig_atomic_t g_StopRequested = 0;
+
+    enum EWorkload
+    {
+        WorkloadLines,
+        WorkloadCursor,
+        WorkloadSgr,
+        WorkloadGraphics,
+        WorkloadMixed
+    };
+
+    enum EVerify
+    {
+        VerifyNone,
+        VerifyEcho
+    };
+
+    struct TOptions
+    {
+        bool respond = false;
+        std::string device;
+        std::string tcpHost;
+        unsigned tcpPort = 0;
+        unsigned baud = 115200;
+        EWorkload workload = WorkloadMixed;
+        EVerify verify = VerifyNone;
+        double rate = 0.0;              // bytes/s, 0 = unthrottled
+        double duration = 10.0;         // seconds
+        uint64_t maxBytes = 0;          // 0 = duration-limited only
+        double reportInterval = 1.0;    // seconds, 0 = final report only
+        double drainSeconds = 2.0;      // wait for outstanding echoes
+        unsigned columns = DefaultColumns;
+        unsigned rows = DefaultRows;
+        uint32_t seed = 0x56543130u;    // "VT10"
+    };
+
+    struct TPendingFrame
+    {
+        uint64_t sentUs;
+        std::string bytes;
+    };
+
+    uint64_t NowUs(void)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000ULL + static_cast<uint64_t>(ts.tv_nsec) / 1000ULL;
+    }
+
+    void HandleStopSignal(int)
+    {
+        g_StopRequested = 1;
+    }
+
+    //--------------------------------------------------------------------------
+    // I/O endpoint
+    //--------------------------------------------------------------------------
+
+    struct TEndpoint
+    {
+        int rxFd = -1;
+        int txFd = -1;
+        bool ownsFds = false;
+    };
+
+    speed_t BaudToSpeed(unsigned baud)
+    {
+        switch (baud)
+        {
+        case 9600:   return B9600;
+        case 19200:  return B19200;
+        case 38400:  return B38400;
+        case 57600:  return B57600;
+        case 115200: return B115200;
+        case 230400: return B230400;
+#ifdef B460800
+        case 460800: return B460800;
+#endif
+#ifdef B921600
+        case 921600: return B921600;
+#endif
+        default:     return 0;
+        }
+    }
+
+    bool OpenDevice(const TOptions &options, TEndpoint &endpoint)
+    {
+        int fd = open(options.device.c_str(), O_RDWR | O_NOCTTY);
+        if (fd < 0)
+        {
+            fprintf(stderr, "Cannot open %s: %s\n", options.device.c_str(), strerror(errno));
+            return false;
+        }
+
+        struct termios tio;
+        if (tcgetattr(fd, &tio) == 0)
+        {
+            cfmakeraw(&tio);
+            tio.c_cflag |= CLOCAL | CREAD;
+            tio.c_cc[VMIN] = 1;
+            tio.c_cc[VTIME] = 0;
+
+            speed_t speed = BaudToSpeed(options.baud);
+            if (speed == 0)
+            {
+                fprintf(stderr, "Unsupported baud rate %u\n", options.baud);
+                close(fd);
+                return false;
+            }
+            cfsetispeed(&tio, speed);
+            cfsetospeed(&tio, speed);
+
+            if (tcsetattr(fd, TCSANOW, &tio) != 0)
+            {
+                fprintf(stderr, "Cannot configure %s: %s\n", options.device.c_str(), strerror(errno));
+                close(fd);
+                return false;
+            }
+            tcflush(fd, TCIOFLUSH);
+        }
+
+        endpoint.rxFd = fd;
+        endpoint.txFd = fd;
+        endpoint.ownsFds = true;
+        return true;
+    }
+
+    bool OpenTcp(const TOptions &options, TEndpoint &endpoint)
+    {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        char port[16];
+        snprintf(port, sizeof(port), "%u", options.tcpPort);
+
+        struct addrinfo *result = nullptr;
+        int rc = getaddrinfo(options.tcpHost.c_str(), port, &hints, &result);
+        if (rc != 0)
+        {
+            fprintf(stderr, "Cannot resolve %s: %s\n", options.tcpHost.c_str(), gai_strerror(rc));
+            return false;
+        }
+
+        int fd = -1;
+        for (struct addrinfo *ai = result; ai != nullptr; ai = ai->ai_next)
+        {
+            fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (fd < 0)
+            {
+                continue;
+            }
+            if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+            {
+                break;
+            }
+            close(fd);
+            fd = -1;
+        }
+        freeaddrinfo(result);
+
+        if (fd < 0)
+        {
+            fprintf(stderr, "Cannot connect to %s:%u\n", options.tcpHost.c_str(), options.tcpPort);
+            return false;
+        }
+
+        // Pacing is done here; do not let Nagle re-batch the frames
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        endpoint.rxFd = fd;
+        endpoint.txFd = fd;
+        endpoint.ownsFds = true;
+        return true;
+    }
+
+    bool OpenEndpoint(const TOptions &options, TEndpoint &endpoint)
+    {
+        if (!options.device.empty())
+        {
+            return OpenDevice(options, endpoint);
+        }
+        if (!options.tcpHost.empty())
+        {
+            return OpenTcp(options, endpoint);
+        }
+
+        endpoint.rxFd = STDIN_FILENO;
+        endpoint.txFd = STDOUT_FILENO;
+        endpoint.ownsFds = false;
+        return true;
+    }
+
+    void CloseEndpoint(TEndpoint &endpoint)
+    {
+        if (endpoint.ownsFds && endpoint.rxFd >= 0)
+        {
+            close(endpoint.rxFd);
+        }
+        endpoint.rxFd = -1;
+        endpoint.txFd = -1;
+    }
+
+    bool WriteAll(int fd, const char *pData, size_t nLength)
+    {
+        while (nLength > 0)
+        {
+            ssize_t written = write(fd, pData, nLength);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    if (g_StopRequested)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (errno == EAGAIN)
+                {
+                    struct pollfd pfd = {fd, POLLOUT, 0};
+                    poll(&pfd, 1, 100);
+                    continue;
+                }
+                return false;
+            }
+            pData += written;
+            nLength -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // Respond mode (former VT100_SCREEN_ECHO.py)
+    //--------------------------------------------------------------------------
+
+    bool IsIgnoredRemoteLine(const std::string &line)
+    {
+        for (const char *prefix : IgnorePrefixes)
+        {
+            if (line.compare(0, strlen(prefix), prefix) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool IsEchoCandidate(const std::string &line)
+    {
+        if (line.empty())
+        {
+            return false;
+        }
+        for (unsigned char ch : line)
+        {
+            if (ch == '\t')
+            {
+                continue;
+            }
+            if (ch < 32 || ch > 126)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int RunRespond(TEndpoint &endpoint)
+    {
+        std::string pending;
+        char chunk[ReadChunkSize];
+
+        while (!g_StopRequested)
+        {
+            ssize_t nRead = read(endpoint.rxFd, chunk, sizeof(chunk));
+            if (nRead < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                break;
+            }
+            if (nRead == 0)
+            {
+                return 0;
+            }
+            pending.append(chunk, static_cast<size_t>(nRead));
+
+            // Split on CR or LF; CRLF and LFCR pairs count as one delimiter
+            size_t start = 0;
+            for (;;)
+            {
+                size_t index = pending.find_first_of("\r\n", start);
+                if (index == std::string::npos)
+                {
+                    break;
+                }
+
+                size_t next = index + 1;
+                if (next < pending.size())
+                {
+                    char ch = pending[index];
+                    char nxt = pending[next];
+                    if ((ch == '\r' && nxt == '\n') || (ch == '\n' && nxt == '\r'))
+                    {
+                        ++next;
+                    }
+                }
+
+                std::string line = pending.substr(start, index - start);
+                start = next;
+
+                if (line.empty()
+                    || line.compare(0, sizeof(SimHostPrefix) - 1, SimHostPrefix) == 0
+                    || IsIgnoredRemoteLine(line)
+                    || !IsEchoCandidate(line))
+                {
+                    continue;
+                }
+
+                std::string reply = SimHostPrefix + line + "\r\n";
+                if (!WriteAll(endpoint.txFd, reply.data(), reply.size()))
+                {
+                    return 1;
+                }
+            }
+            pending.erase(0, start);
+        }
+
+        // Signal-triggered shutdown: close the host session cleanly
+        WriteAll(endpoint.txFd, ShutdownSequence, sizeof(ShutdownSequence) - 1);
+        return 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // Workload generation
+    //--------------------------------------------------------------------------
+
+    class CWorkloadGenerator
+    {
+    public:
+        CWorkloadGenerator(const TOptions &options)
+        : m_Workload(options.workload)
+        , m_nColumns(std::max(options.columns, MinColumns))
+        , m_nRows(std::max(options.rows, 4u))
+        , m_nSeed(options.seed)
+        , m_nState(options.seed)
+        {
+        }
+
+        /// \brief Builds frame @p seq; identical inputs always give identical bytes.
+        void BuildFrame(uint32_t seq, std::string &frame)
+        {
+            m_nState = m_nSeed ^ (seq * 0x9E3779B9u);
+            if (m_nState == 0)
+            {
+                m_nState = 1;
+            }
+
+            frame.clear();
+            char tag[SeqTagLength + 1];
+            snprintf(tag, sizeof(tag), "~S%08X~", seq);
+            frame.append(tag, SeqTagLength);
+
+            EWorkload workload = m_Workload;
+            if (workload == WorkloadMixed)
+            {
+                workload = static_cast<EWorkload>(seq % WorkloadMixed);
+            }
+
+            switch (workload)
+            {
+            case WorkloadLines:    BuildLines(frame);    break;
+            case WorkloadCursor:   BuildCursor(frame);   break;
+            case WorkloadSgr:      BuildSgr(frame);      break;
+            case WorkloadGraphics: BuildGraphics(frame); break;
+            default:               BuildLines(frame);    break;
+            }
+        }
+
+    private:
+        uint32_t Next(void)
+        {
+            // xorshift32
+            m_nState ^= m_nState << 13;
+            m_nState ^= m_nState >> 17;
+            m_nState ^= m_nState << 5;
+            return m_nState;
+        }
+
+        char PrintableChar(void)
+        {
+            // Printable ASCII without '~' so tags stay unambiguous in the echo
+            return static_cast<char>(' ' + Next() % ('~' - ' '));
+        }
+
+        void AppendText(std::string &frame, unsigned nLength)
+        {
+            for (unsigned i = 0; i < nLength; ++i)
+            {
+                frame.push_back(PrintableChar());
+            }
+        }
+
+        // Full-width line plus CRLF: exercises scrolling once the screen is full
+        void BuildLines(std::string &frame)
+        {
+            AppendText(frame, m_nColumns - SeqTagLength - 1);
+            frame.append("\r\n");
+        }
+
+        // Absolute cursor moves with short updates across the whole screen
+        void BuildCursor(std::string &frame)
+        {
+            char csi[32];
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                unsigned row = 1 + Next() % m_nRows;
+                unsigned col = 1 + Next() % (m_nColumns - 12);
+                snprintf(csi, sizeof(csi), "\x1b[%u;%uH", row, col);
+                frame.append(csi);
+                AppendText(frame, 4 + Next() % 8);
+            }
+            frame.append("\x1b[H");
+        }
+
+        // Short text runs with attribute changes between every run
+        void BuildSgr(std::string &frame)
+        {
+            static const char *const Attributes[] = {"0", "1", "4", "5", "7", "1;4", "1;7", "4;7"};
+            for (unsigned i = 0; i < 6; ++i)
+            {
+                frame.append("\x1b[");
+                frame.append(Attributes[Next() % (sizeof(Attributes) / sizeof(Attributes[0]))]);
+                frame.push_back('m');
+                AppendText(frame, 3 + Next() % 6);
+            }
+            frame.append("\x1b[0m\r\n");
+        }
+
+        // Box drawing through G0 = DEC special graphics, then back to ASCII
+        void BuildGraphics(std::string &frame)
+        {
+            unsigned width = 10 + Next() % (m_nColumns - SeqTagLength - 12);
+            frame.append("\x1b(0l");
+            frame.append(width, 'q');
+            frame.append("k\x1b(B\r\n\x1b(0x");
+            for (unsigned i = 0; i < width; ++i)
+            {
+                frame.push_back(static_cast<char>('`' + Next() % 30));
+            }
+            frame.append("x\x1b(B\r\n\x1b(0m");
+            frame.append(width, 'q');
+            frame.append("j\x1b(B\r\n");
+        }
+
+        EWorkload m_Workload;
+        unsigned m_nColumns;
+        unsigned m_nRows;
+        uint32_t m_nSeed;
+        uint32_t m_nState;
+    };
+
+    //--------------------------------------------------------------------------
+    // Echo verification
+    //--------------------------------------------------------------------------
+
+    class CEchoVerifier
+    {
+    public:
+        void OnSent(uint32_t seq, uint64_t sentUs, const std::string &frame)
+        {
+            m_Pending[seq] = TPendingFrame{sentUs, frame};
+        }
+
+        void OnReceived(const char *pData, size_t nLength, uint64_t nowUs)
+        {
+            m_RxBytes += nLength;
+            m_Window.append(pData, nLength);
+
+            size_t pos = 0;
+            for (;;)
+            {
+                if (m_bCapturing)
+                {
+                    size_t need = m_CaptureExpected.size() - m_Capture.size();
+                    size_t take = std::min(need, m_Window.size() - pos);
+                    m_Capture.append(m_Window, pos, take);
+                    pos += take;
+                    if (m_Capture.size() < m_CaptureExpected.size())
+                    {
+                        break;
+                    }
+                    if (m_Capture != m_CaptureExpected)
+                    {
+                        ++m_nCorrupted;
+                    }
+                    m_bCapturing = false;
+                    m_Capture.clear();
+                    m_CaptureExpected.clear();
+                    continue;
+                }
+
+                size_t tag = m_Window.find("~S", pos);
+                if (tag == std::string::npos)
+                {
+                    pos = m_Window.size() > 0 ? m_Window.size() - 1 : 0;
+                    break;
+                }
+                if (m_Window.size() - tag < SeqTagLength)
+                {
+                    pos = tag;
+                    break;
+                }
+                if (m_Window[tag + SeqTagLength - 1] != '~')
+                {
+                    pos = tag + 1;
+                    continue;
+                }
+
+                char hex[9];
+                memcpy(hex, m_Window.data() + tag + 2, 8);
+                hex[8] = '\0';
+                char *pEnd = nullptr;
+                uint32_t seq = static_cast<uint32_t>(strtoul(hex, &pEnd, 16));
+                pos = tag + SeqTagLength;
+                if (pEnd != hex + 8)
+                {
+                    continue;
+                }
+
+                auto it = m_Pending.find(seq);
+                if (it == m_Pending.end())
+                {
+                    ++m_nUnexpected;
+                    continue;
+                }
+
+                if (m_bHaveLastSeq && seq < m_nLastSeq)
+                {
+                    ++m_nReordered;
+                }
+                m_nLastSeq = seq;
+                m_bHaveLastSeq = true;
+
+                m_RttUs.push_back(nowUs - it->second.sentUs);
+                ++m_nMatched;
+
+                m_CaptureExpected = it->second.bytes.substr(SeqTagLength);
+                m_Pending.erase(it);
+                m_bCapturing = !m_CaptureExpected.empty();
+            }
+
+            m_Window.erase(0, pos);
+        }
+
+        size_t Outstanding(void) const { return m_Pending.size(); }
+        uint64_t RxBytes(void) const { return m_RxBytes; }
+        uint64_t Matched(void) const { return m_nMatched; }
+        uint64_t Corrupted(void) const { return m_nCorrupted; }
+        uint64_t Reordered(void) const { return m_nReordered; }
+        uint64_t Unexpected(void) const { return m_nUnexpected; }
+
+        /// \brief Returns the @p percentile (0..100) RTT in microseconds.
+        uint64_t RttPercentile(double percentile)
+        {
+            if (m_RttUs.empty())
+            {
+                return 0;
+            }
+            std::vector<uint64_t> sorted(m_RttUs);
+            size_t index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+            std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+            return sorted[index];
+        }
+
+    private:
+        std::unordered_map<uint32_t, TPendingFrame> m_Pending;
+        std::vector<uint64_t> m_RttUs;
+        std::string m_Window;
+        std::string m_Capture;
+        std::string m_CaptureExpected;
+        bool m_bCapturing = false;
+        bool m_bHaveLastSeq = false;
+        uint32_t m_nLastSeq = 0;
+        uint64_t m_RxBytes = 0;
+        uint64_t m_nMatched = 0;
+        uint64_t m_nCorrupted = 0;
+        uint64_t m_nReordered = 0;
+        uint64_t m_nUnexpected = 0;
+    };
+
+    //--------------------------------------------------------------------------
+    // Load mode
+    //--------------------------------------------------------------------------
+
+    void DrainInput(TEndpoint &endpoint, CEchoVerifier *pVerifier, int timeoutMs)
+    {
+        struct pollfd pfd = {endpoint.rxFd, POLLIN, 0};
+        while (poll(&pfd, 1, timeoutMs) > 0 && (pfd.revents & POLLIN))
+        {
+            char chunk[ReadChunkSize];
+            ssize_t nRead = read(endpoint.rxFd, chunk, sizeof(chunk));
+            if (nRead <= 0)
+            {
+                return;
+            }
+            if (pVerifier != nullptr)
+            {
+                pVerifier->OnReceived(chunk, static_cast<size_t>(nRead), NowUs());
+            }
+            timeoutMs = 0;
+        }
+    }
+
+    int RunLoad(const TOptions &options, TEndpoint &endpoint)
+    {
+        CWorkloadGenerator generator(options);
+        CEchoVerifier verifier;
+        CEchoVerifier *pVerifier = options.verify == VerifyEcho ? &verifier : nullptr;
+
+        const uint64_t startUs = NowUs();
+        const uint64_t endUs = startUs + static_cast<uint64_t>(options.duration * 1e6);
+        const uint64_t reportUs = static_cast<uint64_t>(options.reportInterval * 1e6);
+        uint64_t nextReportUs = startUs + reportUs;
+
+        uint64_t txBytes = 0;
+        uint64_t lastReportBytes = 0;
+        uint64_t lastReportUs = startUs;
+        uint32_t seq = 0;
+        std::string frame;
+
+        // Start from a known screen state
+        static const char Prologue[] = "\x1b[0m\x1b(B\x1b[2J\x1b[H";
+        if (!WriteAll(endpoint.txFd, Prologue, sizeof(Prologue) - 1))
+        {
+            return 1;
+        }
+
+        while (!g_StopRequested)
+        {
+            uint64_t nowUs = NowUs();
+            if (nowUs >= endUs || (options.maxBytes != 0 && txBytes >= options.maxBytes))
+            {
+                break;
+            }
+
+            // Byte-exact pacing: frame N may leave once txBytes/rate seconds have elapsed
+            if (options.rate > 0.0)
+            {
+                uint64_t dueUs = startUs + static_cast<uint64_t>(static_cast<double>(txBytes) * 1e6 / options.rate);
+                if (dueUs > nowUs)
+                {
+                    int waitMs = static_cast<int>((dueUs - nowUs) / 1000);
+                    if (waitMs > 0)
+                    {
+                        DrainInput(endpoint, pVerifier, waitMs);
+                        continue;
+                    }
+                    while (NowUs() < dueUs)
+                    {
+                    }
+                }
+            }
+
+            generator.BuildFrame(seq, frame);
+            uint64_t sentUs = NowUs();
+            if (pVerifier != nullptr)
+            {
+                pVerifier->OnSent(seq, sentUs, frame);
+            }
+            if (!WriteAll(endpoint.txFd, frame.data(), frame.size()))
+            {
+                fprintf(stderr, "Write failed: %s\n", strerror(errno));
+                break;
+            }
+            txBytes += frame.size();
+            ++seq;
+
+            DrainInput(endpoint, pVerifier, 0);
+
+            nowUs = NowUs();
+            if (reportUs != 0 && nowUs >= nextReportUs)
+            {
+                double intervalS = static_cast<double>(nowUs - lastReportUs) / 1e6;
+                fprintf(stderr, "[%7.1fs] tx %10llu B  %9.0f B/s  frames %u",
+                        static_cast<double>(nowUs - startUs) / 1e6,
+                        static_cast<unsigned long long>(txBytes),
+                        static_cast<double>(txBytes - lastReportBytes) / intervalS, seq);
+                if (pVerifier != nullptr)
+                {
+                    fprintf(stderr, "  rx %10llu B  outstanding %zu",
+                            static_cast<unsigned long long>(verifier.RxBytes()), verifier.Outstanding());
+                }
+                fprintf(stderr, "\n");
+                lastReportBytes = txBytes;
+                lastReportUs = nowUs;
+                nextReportUs = nowUs + reportUs;
+            }
+        }
+
+        const uint64_t txEndUs = NowUs();
+        if (pVerifier != nullptr)
+        {
+            uint64_t drainEndUs = txEndUs + static_cast<uint64_t>(options.drainSeconds * 1e6);
+            while (verifier.Outstanding() > 0 && NowUs() < drainEndUs && !g_StopRequested)
+            {
+                DrainInput(endpoint, pVerifier, 50);
+            }
+        }
+
+        double elapsedS = static_cast<double>(txEndUs - startUs) / 1e6;
+        printf("frames sent      %u\n", seq);
+        printf("bytes sent       %llu\n", static_cast<unsigned long long>(txBytes));
+        printf("elapsed          %.3f s\n", elapsedS);
+        printf("throughput       %.0f B/s (target %s)\n",
+               elapsedS > 0.0 ? static_cast<double>(txBytes) / elapsedS : 0.0,
+               options.rate > 0.0 ? std::to_string(static_cast<uint64_t>(options.rate)).c_str() : "unthrottled");
+
+        if (pVerifier == nullptr)
+        {
+            return 0;
+        }
+
+        uint64_t lost = verifier.Outstanding();
+        printf("bytes received   %llu\n", static_cast<unsigned long long>(verifier.RxBytes()));
+        printf("frames echoed    %llu\n", static_cast<unsigned long long>(verifier.Matched()));
+        printf("frames lost      %llu (%.3f %%)\n", static_cast<unsigned long long>(lost),
+               seq > 0 ? 100.0 * static_cast<double>(lost) / seq : 0.0);
+        printf("frames corrupted %llu\n", static_cast<unsigned long long>(verifier.Corrupted()));
+        printf("frames reordered %llu\n", static_cast<unsigned long long>(verifier.Reordered()));
+        printf("unexpected tags  %llu\n", static_cast<unsigned long long>(verifier.Unexpected()));
+        printf("rtt p50/p90/p99/max  %.3f / %.3f / %.3f / %.3f ms\n",
+               verifier.RttPercentile(50.0) / 1000.0,
+               verifier.RttPercentile(90.0) / 1000.0,
+               verifier.RttPercentile(99.0) / 1000.0,
+               verifier.RttPercentile(100.0) / 1000.0);
+
+        return (lost == 0 && verifier.Corrupted() == 0) ? 0 : 2;
+    }
+
+    //--------------------------------------------------------------------------
+    // Command line
+    //--------------------------------------------------------------------------
+
+    void PrintUsage(const char *pProgram)
+    {
+        fprintf(stderr,
+                "Usage: %s [endpoint] --respond\n"
+                "       %s [endpoint] [load options]\n"
+                "\n"
+                "Endpoint (default: stdin/stdout):\n"
+                "  --device PATH      serial or PTY device (raw mode)\n"
+                "  --baud N           serial speed for --device (default 115200)\n"
+                "  --tcp HOST:PORT    VT100 TCP host port (e.g. 192.168.1.50:2323)\n"
+                "\n"
+                "Respond mode:\n"
+                "  --respond          echo incoming lines back with prefix \"SIMHOST:\"\n"
+                "\n"
+                "Load options:\n"
+                "  --workload W       lines | cursor | sgr | graphics | mixed (default mixed)\n"
+                "  --rate N           target byte rate in bytes/s (default unthrottled)\n"
+                "  --duration S       run time in seconds (default 10)\n"
+                "  --bytes N          stop after N bytes\n"
+                "  --verify V         none | echo (default none)\n"
+                "  --drain S          wait S seconds for outstanding echoes (default 2)\n"
+                "  --report S         progress interval in seconds, 0 = off (default 1)\n"
+                "  --size COLSxROWS   screen geometry for generated frames (default 80x24, at least 24 columns)\n"
+                "  --seed N           workload seed\n",
+                pProgram, pProgram);
+    }
+
+    bool ParseWorkload(const char *pValue, EWorkload &workload)
+    {
+        static const struct { const char *name; EWorkload value; } Names[] = {
+            {"lines", WorkloadLines},
+            {"cursor", WorkloadCursor},
+            {"sgr", WorkloadSgr},
+            {"graphics", WorkloadGraphics},
+            {"mixed", WorkloadMixed},
+        };
+        for (const auto &entry : Names)
+        {
+            if (strcmp(pValue, entry.name) == 0)
+            {
+                workload = entry.value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ParseOptions(int argc, char **argv, TOptions &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            const char *pValue = (i + 1 < argc) ? argv[i + 1] : nullptr;
+            bool needsValue = arg != "--respond" && arg != "-h" && arg != "--help";
+            if (needsValue && pValue == nullptr)
+            {
+                fprintf(stderr, "Missing value for %s\n", arg.c_str());
+                return false;
+            }
+
+            if (arg == "--respond")
+            {
+                options.respond = true;
+                continue;
+            }
+            if (arg == "-h" || arg == "--help")
+            {
+                return false;
+            }
+
+            ++i;
+            if (arg == "--device")
+            {
+                options.device = pValue;
+            }
+            else if (arg == "--baud")
+            {
+                options.baud = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--tcp")
+            {
+                std::string value = pValue;
+                size_t colon = value.rfind(':');
+                if (colon == std::string::npos)
+                {
+                    fprintf(stderr, "--tcp expects HOST:PORT\n");
+                    return false;
+                }
+                options.tcpHost = value.substr(0, colon);
+                options.tcpPort = static_cast<unsigned>(strtoul(value.c_str() + colon + 1, nullptr, 10));
+            }
+            else if (arg == "--workload")
+            {
+                if (!ParseWorkload(pValue, options.workload))
+                {
+                    fprintf(stderr, "Unknown workload: %s\n", pValue);
+                    return false;
+                }
+            }
+            else if (arg == "--rate")
+            {
+                options.rate = strtod(pValue, nullptr);
+            }
+            else if (arg == "--duration")
+            {
+                options.duration = strtod(pValue, nullptr);
+            }
+            else if (arg == "--bytes")
+            {
+                options.maxBytes = strtoull(pValue, nullptr, 10);
+            }
+            else if (arg == "--verify")
+            {
+                if (strcmp(pValue, "none") == 0)
+                {
+                    options.verify = VerifyNone;
+                }
+                else if (strcmp(pValue, "echo") == 0)
+                {
+                    options.verify = VerifyEcho;
+                }
+                else
+                {
+                    fprintf(stderr, "Unknown verify mode: %s\n", pValue);
+                    return false;
+                }
+            }
+            else if (arg == "--drain")
+            {
+                options.drainSeconds = strtod(pValue, nullptr);
+            }
+            else if (arg == "--report")
+            {
+                options.reportInterval = strtod(pValue, nullptr);
+            }
+            else if (arg == "--size")
+            {
+                if (sscanf(pValue, "%ux%u", &options.columns, &options.rows) != 2)
+                {
+                    fprintf(stderr, "--size expects COLSxROWS\n");
+                    return false;
+                }
+            }
+            else if (arg == "--seed")
+            {
+                options.seed = static_cast<uint32_t>(strtoul(pValue, nullptr, 0));
+            }
+            else
+            {
+                fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+                return false;
+            }
+        }
+
+        if (!options.device.empty() && !options.tcpHost.empty())
+        {
+            fprintf(stderr, "--device and --tcp are mutually exclusive\n");
+            return false;
+        }
+        if (!options.respond && options.verify == VerifyEcho && options.device.empty() && options.tcpHost.empty())
+        {
+            fprintf(stderr, "--verify echo needs --device or --tcp\n");
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    TOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = HandleStopSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+
+    TEndpoint endpoint;
+    if (!OpenEndpoint(options, endpoint))
+    {
+        return 1;
+    }
+
+    int result = options.respond ? RunRespond(endpoint) : RunLoad(options, endpoint);
+
+    CloseEndpoint(endpoint);
+    return result;
+}
@@ -0,0 +1,503 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_PROFILE
+// Description:   Host symboliser for the firmware PC sampling profiler
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+/**
+ * @file VT100_PROFILE.cpp
+ * @brief Turns a CTSampleProfiler dump into a flat profile and flame graph input.
+ * @details Build on Linux/macOS with:
+ *
+ *     c++ -O2 -std=c++17 -o VT100_PROFILE VT100_PROFILE.cpp
+ *
+ * Input is `SD:/PROFILE.TXT` (`profile save`) or a telnet capture of
+ * `profile dump`; only lines containing `profile ` are read, so log output in
+ * between does not matter. Addresses are resolved against the function labels
+ * of `build/kernel.lst` (objdump -d of the kernel image); `build/kernel.map`
+ * supplies the object or library each address belongs to (`libcircle`,
+ * `libnet`, `TRenderer.o`, ...) and the symbols when no listing is given.
+ *
+ * Output is a flat profile by function, by module and by task on stdout and,
+ * with `--folded FILE`, one `task;module;function count` line per entry as
+ * read by flamegraph.pl or speedscope. The sampler records no call stacks, so
+ * the flame graph is three levels deep.
+ */
+
+#include <cxxabi.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::string profilePath;
+        std::string mapPath = "build/kernel.map";
+        std::string lstPath = "build/kernel.lst";
+        std::string foldedPath;
+        unsigned top = 30;
+    };
+
+    struct Symbol
+    {
+        uint64_t address;
+        std::string name;
+    };
+
+    struct Range
+    {
+        uint64_t address;
+        uint64_t size;
+        std::string module;
+    };
+
+    struct Sample
+    {
+        uint64_t pc;
+        unsigned task;
+        uint64_t count;
+    };
+
+    struct Profile
+    {
+        unsigned rate = 0;
+        unsigned ms = 0;
+        uint64_t samples = 0;
+        uint64_t dropped = 0;
+        std::map<unsigned, std::string> tasks;
+        std::vector<Sample> entries;
+        bool complete = false;
+    };
+
+    bool ParseHex(const std::string &text, uint64_t &value)
+    {
+        const char *begin = text.c_str();
+        if (strncmp(begin, "0x", 2) == 0)
+        {
+            begin += 2;
+        }
+        char *end = nullptr;
+        value = strtoull(begin, &end, 16);
+        return end != begin && *end == '\0';
+    }
+
+    std::vector<std::string> SplitWords(const std::string &line)
+    {
+        std::vector<std::string> words;
+        size_t pos = 0;
+        while (pos < line.size())
+        {
+            while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r'))
+            {
+                ++pos;
+            }
+            const size_t start = pos;
+            while (pos < line.size() && line[pos] != ' ' && line[pos] != '\t' && line[pos] != '\r')
+            {
+                ++pos;
+            }
+            if (pos > start)
+            {
+                words.push_back(line.substr(start, pos - start));
+            }
+        }
+        return words;
+    }
+
+    std::string Demangle(const std::string &name)
+    {
+        if (name.compare(0, 2, "_Z") != 0)
+        {
+            return name;
+        }
+        int status = 0;
+        char *pDemangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+        std::string result = status == 0 && pDemangled != nullptr ? pDemangled : name;
+        free(pDemangled);
+        return result;
+    }
+
+    /// `../third_party/circle/lib/libcircle.a(timer.o)` -> `libcircle`, `./build/TRenderer.o` -> `TRenderer.o`
+    std::string ModuleName(const std::string &object)
+    {
+        std::string path = object;
+        const size_t paren = path.find('(');
+        if (paren != std::string::npos)
+        {
+            path.erase(paren);
+            if (path.size() > 2 && path.compare(path.size() - 2, 2, ".a") == 0)
+            {
+                path.erase(path.size() - 2);
+            }
+        }
+        const size_t slash = path.find_last_of('/');
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    bool ReadProfile(const std::string &path, Profile &rProfile)
+    {
+        std::ifstream fileStream;
+        std::istream *pInput = &std::cin;
+        if (path != "-")
+        {
+            fileStream.open(path);
+            if (!fileStream)
+            {
+                fprintf(stderr, "Cannot open %s\n", path.c_str());
+                return false;
+            }
+            pInput = &fileStream;
+        }
+
+        std::string line;
+        while (std::getline(*pInput, line))
+        {
+            const size_t start = line.find("profile ");
+            if (start == std::string::npos)
+            {
+                continue;
+            }
+            const std::vector<std::string> words = SplitWords(line.substr(start));
+            if (words.size() >= 9 && words[1] == "rate")
+            {
+                // A second dump in the same capture replaces the first
+                rProfile = Profile();
+                rProfile.rate = static_cast<unsigned>(strtoul(words[2].c_str(), nullptr, 10));
+                rProfile.ms = static_cast<unsigned>(strtoul(words[4].c_str(), nullptr, 10));
+                rProfile.samples = strtoull(words[6].c_str(), nullptr, 10);
+                rProfile.dropped = strtoull(words[8].c_str(), nullptr, 10);
+            }
+            else if (words.size() >= 4 && words[1] == "task")
+            {
+                rProfile.tasks[static_cast<unsigned>(strtoul(words[2].c_str(), nullptr, 10))] = words[3];
+            }
+            else if (words.size() >= 5 && words[1] == "pc")
+            {
+                Sample sample;
+                if (ParseHex(words[2], sample.pc))
+                {
+                    sample.task = static_cast<unsigned>(strtoul(words[3].c_str(), nullptr, 10));
+                    sample.count = strtoull(words[4].c_str(), nullptr, 10);
+                    rProfile.entries.push_back(sample);
+                }
+            }
+            else if (words.size() >= 2 && words[1] == "end")
+            {
+                rProfile.complete = true;
+            }
+        }
+
+        if (rProfile.entries.empty())
+        {
+            fprintf(stderr, "%s: no 'profile pc' lines\n", path.c_str());
+            return false;
+        }
+        if (!rProfile.complete)
+        {
+            fprintf(stderr, "%s: dump without 'profile end', capture may be cut off\n", path.c_str());
+        }
+        return true;
+    }
+
+    /// Function labels of `objdump -d`: `0000a1c4 <CTRenderer::Write(char const*, unsigned int)>:`
+    bool ReadListing(const std::string &path, std::vector<Symbol> &rSymbols)
+    {
+        std::ifstream input(path);
+        if (!input)
+        {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(input, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            const size_t open = line.find(" <");
+            if (open == 0 || open == std::string::npos || line.size() < open + 4
+                || line.compare(line.size() - 2, 2, ">:") != 0)
+            {
+                continue;
+            }
+            Symbol symbol;
+            if (ParseHex(line.substr(0, open), symbol.address))
+            {
+                symbol.name = Demangle(line.substr(open + 2, line.size() - open - 4));
+                rSymbols.push_back(symbol);
+            }
+        }
+        return true;
+    }
+
+    /// Input sections (` .text.name 0xaddr 0xsize object`, the name may stand on
+    /// its own line) and symbol lines (`0xaddr name`) of a GNU ld map file.
+    bool ReadMap(const std::string &path, std::vector<Range> &rRanges, std::vector<Symbol> &rSymbols)
+    {
+        std::ifstream input(path);
+        if (!input)
+        {
+            return false;
+        }
+
+        std::string line;
+        std::string pendingSection;
+        bool inText = false;
+        while (std::getline(input, line))
+        {
+            const std::vector<std::string> words = SplitWords(line);
+            if (words.empty())
+            {
+                continue;
+            }
+
+            // Output sections start in column 0; only code is of interest
+            if (line[0] != ' ')
+            {
+                inText = words[0].compare(0, 5, ".text") == 0 || words[0].compare(0, 5, ".init") == 0;
+                pendingSection.clear();
+                continue;
+            }
+            if (!inText)
+            {
+                continue;
+            }
+
+            uint64_t address = 0;
+            uint64_t size = 0;
+            if (words[0][0] == '.' || words[0][0] == '*')
+            {
+                if (words.size() == 1)
+                {
+                    pendingSection = words[0];
+                }
+                else if (words.size() >= 4 && ParseHex(words[1], address) && ParseHex(words[2], size) && size != 0)
+                {
+                    rRanges.push_back({address, size, ModuleName(words[3])});
+                }
+                continue;
+            }
+
+            if (!pendingSection.empty() && words.size() >= 3 && ParseHex(words[0], address) && ParseHex(words[1], size))
+            {
+                if (size != 0)
+                {
+                    rRanges.push_back({address, size, ModuleName(words[2])});
+                }
+                pendingSection.clear();
+                continue;
+            }
+            pendingSection.clear();
+
+            if (words.size() >= 2 && ParseHex(words[0], address) && words[1].find('=') == std::string::npos
+                && words[1] != "PROVIDE")
+            {
+                std::string name = line.substr(line.find(words[1]));
+                rSymbols.push_back({address, Demangle(name)});
+            }
+        }
+        return true;
+    }
+
+    void PrintUsage(const char *pProgram)
+    {
+        fprintf(stderr,
+                "Usage: %s [options] PROFILE.TXT|-\n"
+                "  --lst FILE      objdump -d listing with function labels (default build/kernel.lst)\n"
+                "  --map FILE      linker map for modules and fallback symbols (default build/kernel.map)\n"
+                "  --folded FILE   write task;module;function counts for flame graphs\n"
+                "  --top N         functions listed in the flat profile (default 30)\n",
+                pProgram);
+    }
+
+    bool ParseOptions(int argc, char **argv, Options &rOptions)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                return false;
+            }
+            if (arg == "-" || arg[0] != '-')
+            {
+                rOptions.profilePath = arg;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *pValue = argv[++i];
+            if (arg == "--lst")
+            {
+                rOptions.lstPath = pValue;
+            }
+            else if (arg == "--map")
+            {
+                rOptions.mapPath = pValue;
+            }
+            else if (arg == "--folded")
+            {
+                rOptions.foldedPath = pValue;
+            }
+            else if (arg == "--top")
+            {
+                rOptions.top = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return !rOptions.profilePath.empty();
+    }
+
+    template <typename T>
+    const T *FindBelow(const std::vector<T> &rSorted, uint64_t address)
+    {
+        auto it = std::upper_bound(rSorted.begin(), rSorted.end(), address,
+                                   [](uint64_t value, const T &rItem) { return value < rItem.address; });
+        return it == rSorted.begin() ? nullptr : &*(it - 1);
+    }
+
+    void PrintTable(const char *pTitle, const std::map<std::string, uint64_t> &rCounts, uint64_t total, unsigned limit)
+    {
+        std::vector<std::pair<std::string, uint64_t>> rows(rCounts.begin(), rCounts.end());
+        std::stable_sort(rows.begin(), rows.end(),
+                         [](const auto &a, const auto &b) { return a.second > b.second; });
+
+        printf("\n%s\n%10s %7s  %s\n", pTitle, "samples", "%", "name");
+        for (size_t i = 0; i < rows.size() && (limit == 0 || i < limit); ++i)
+        {
+            printf("%10llu %6.2f%%  %s\n", static_cast<unsigned long long>(rows[i].second),
+                   total != 0 ? 100.0 * static_cast<double>(rows[i].second) / static_cast<double>(total) : 0.0,
+                   rows[i].first.c_str());
+        }
+        if (limit != 0 && rows.size() > limit)
+        {
+            printf("%10s %7s  (%zu more)\n", "", "", rows.size() - limit);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    Profile profile;
+    if (!ReadProfile(options.profilePath, profile))
+    {
+        return 1;
+    }
+
+    std::vector<Symbol> symbols;
+    std::vector<Symbol> mapSymbols;
+    std::vector<Range> ranges;
+    const bool haveListing = ReadListing(options.lstPath, symbols);
+    const bool haveMap = ReadMap(options.mapPath, ranges, mapSymbols);
+    if (!haveListing && !haveMap)
+    {
+        fprintf(stderr, "Neither %s nor %s can be read; build the kernel first\n", options.lstPath.c_str(),
+                options.mapPath.c_str());
+        return 1;
+    }
+    if (!haveListing)
+    {
+        fprintf(stderr, "%s not found, using the global symbols of %s\n", options.lstPath.c_str(),
+                options.mapPath.c_str());
+        symbols = mapSymbols;
+    }
+
+    const auto byAddress = [](const auto &a, const auto &b) { return a.address < b.address; };
+    std::stable_sort(symbols.begin(), symbols.end(), byAddress);
+    std::stable_sort(ranges.begin(), ranges.end(), byAddress);
+
+    std::map<std::string, uint64_t> functions;
+    std::map<std::string, uint64_t> modules;
+    std::map<std::string, uint64_t> tasks;
+    std::map<std::string, uint64_t> folded;
+    uint64_t total = 0;
+    uint64_t unresolved = 0;
+
+    for (const Sample &rSample : profile.entries)
+    {
+        const Symbol *pSymbol = FindBelow(symbols, rSample.pc);
+        const Range *pRange = FindBelow(ranges, rSample.pc);
+        if (pRange != nullptr && rSample.pc >= pRange->address + pRange->size)
+        {
+            pRange = nullptr;
+        }
+
+        char fallback[32];
+        snprintf(fallback, sizeof(fallback), "0x%08llx", static_cast<unsigned long long>(rSample.pc));
+        const std::string function = pSymbol != nullptr ? pSymbol->name : fallback;
+        const std::string module = pRange != nullptr ? pRange->module : "?";
+        const auto task = profile.tasks.find(rSample.task);
+        const std::string taskName = task != profile.tasks.end() ? task->second : std::to_string(rSample.task);
+        if (pSymbol == nullptr)
+        {
+            unresolved += rSample.count;
+        }
+
+        functions[function + "  [" + module + "]"] += rSample.count;
+        modules[module] += rSample.count;
+        tasks[taskName] += rSample.count;
+        folded[taskName + ";" + module + ";" + function] += rSample.count;
+        total += rSample.count;
+    }
+
+    printf("VT100 profile: %llu samples in %.1f s at %u Hz, %llu dropped, %llu unresolved\n",
+           static_cast<unsigned long long>(total), profile.ms / 1000.0, profile.rate,
+           static_cast<unsigned long long>(profile.dropped), static_cast<unsigned long long>(unresolved));
+    if (profile.samples != 0 && profile.samples != total + profile.dropped)
+    {
+        printf("note: header counts %llu samples, the entries add up to %llu\n",
+               static_cast<unsigned long long>(profile.samples),
+               static_cast<unsigned long long>(total + profile.dropped));
+    }
+
+    PrintTable("Functions (self)", functions, total, options.top);
+    PrintTable("Modules", modules, total, 0);
+    PrintTable("Tasks", tasks, total, 0);
+
+    if (!options.foldedPath.empty())
+    {
+        FILE *pFile = fopen(options.foldedPath.c_str(), "w");
+        if (pFile == nullptr)
+        {
+            fprintf(stderr, "Cannot write %s\n", options.foldedPath.c_str());
+            return 1;
+        }
+        for (const auto &rEntry : folded)
+        {
+            fprintf(pFile, "%s %llu\n", rEntry.first.c_str(), static_cast<unsigned long long>(rEntry.second));
+        }
+        fclose(pFile);
+    }
+
+    return 0;
+}
@@ -0,0 +1,278 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_ATLAS
+// Description:   Generates the glyph atlas header from the firmware font sources
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+/**
+ * @file VT100_ATLAS.cpp
+ * @brief Writes include/VT100_GlyphAtlas.h.
+ * @details Runs the firmware's own ROM conversion (VT100_FontConverter.cpp,
+ * built with VT100_GLYPH_ATLAS_GENERATOR so it does not read the header it is
+ * about to write) and BuildCrtGlyphAtlas() without effects for every font in
+ * normal size, then prints the levels as C++ arrays: one glyph line per source
+ * line, `o` for background and `X` for full intensity, so a glyph can be read
+ * in the diff. Each glyph also gets its row mask.
+ *
+ * Usage: `VT100_ATLAS [--check] FILE`
+ * - without `--check` FILE is only written when its content changes, so an
+ *   unchanged font does not touch the header's time stamp and nothing
+ *   recompiles;
+ * - with `--check` FILE is compared and the exit status is 1 when it is stale.
+ *
+ * `make atlas` and `make atlas-check` run both forms on the checked-in header.
+ */
+
+#include "VT100_FontConverter.h"
+#include "TFontConverter.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+struct TFontEntry
+{
+    EFontSelection selection;
+    const char *pSelectionName;
+    const char *pArrayName;
+};
+
+const TFontEntry Fonts[] = {
+    {EFontSelection::VT100Font10x20, "VT100Font10x20", "Text10x20"},
+    {EFontSelection::VT100Font10x20Solid, "VT100Font10x20Solid", "Text10x20Solid"},
+    {EFontSelection::VT100Font8x20, "VT100Font8x20", "Text8x20"},
+    {EFontSelection::VT100GraphicsFont10x20, "VT100GraphicsFont10x20", "Graphics10x20"},
+    {EFontSelection::VT100GraphicsFont10x20Solid, "VT100GraphicsFont10x20Solid", "Graphics10x20Solid"},
+    {EFontSelection::VT100GraphicsFont8x20, "VT100GraphicsFont8x20", "Graphics8x20"},
+};
+
+const char HeaderTop[] =
+    "//------------------------------------------------------------------------------\n"
+    "// Module:        VT100_GlyphAtlas\n"
+    "// Description:   Pre-shaded glyph atlases of the VT100 fonts (generated)\n"
+    "// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de\n"
+    "// Created:       2026-10-18\n"
+    "// License:       MIT License (https://opensource.org/license/mit/)\n"
+    "//------------------------------------------------------------------------------\n"
+    "// Change Log:\n"
+    "// 2026-10-18     R. Zuehlsdorff        Initial creation\n"
+    "//------------------------------------------------------------------------------\n"
+    "// GENERATED by tools/host_renderer/VT100_ATLAS - do not edit; after changing\n"
+    "// the font sources run `make atlas` in tools/host_renderer.\n"
+    "//------------------------------------------------------------------------------\n"
+    "\n"
+    "#pragma once\n"
+    "\n"
+    "#include <circle/types.h>\n"
+    "#include \"TFontConverter.h\"\n"
+    "\n"
+    "/**\n"
+    " * @file VT100_GlyphAtlas.h\n"
+    " * @brief Glyph atlases of all VT100 fonts in normal size without CRT effects.\n"
+    " * @details Equal to BuildCrtGlyphAtlas() with all effects 0, so the firmware\n"
+    " * takes them from the kernel image instead of converting pixel lines at run\n"
+    " * time. Included by VT100_FontConverter.cpp only.\n"
+    " */\n"
+    "\n"
+    "namespace VT100GlyphAtlas\n"
+    "{\n"
+    "struct TEntry\n"
+    "{\n"
+    "    EFontSelection font;\n"
+    "    unsigned width;\n"
+    "    unsigned height;\n"
+    "    unsigned firstChar;\n"
+    "    unsigned lastChar;\n"
+    "    const u8 *levels;\n"
+    "    const u64 *rowMasks;\n"
+    "};\n"
+    "\n"
+    "// Levels: o = background, X = full intensity\n";
+
+void AppendGlyphLabel(std::ostringstream &rOut, unsigned nGlyph, const TCrtGlyphAtlas &rAtlas)
+{
+    char label[32];
+    const unsigned code = rAtlas.firstChar + nGlyph;
+    if (code > rAtlas.lastChar)
+    {
+        snprintf(label, sizeof(label), "blank");
+    }
+    else if (code >= 0x20 && code < 0x7F && code != '\\')
+    {
+        snprintf(label, sizeof(label), "0x%02X '%c'", code, code);
+    }
+    else
+    {
+        snprintf(label, sizeof(label), "0x%02X", code);
+    }
+    rOut << label;
+}
+
+bool AppendFont(std::ostringstream &rOut, std::ostringstream &rEntries, const TFontEntry &rFont)
+{
+    const TCrtEffects effects = {0, 0, 0};
+    TCrtGlyphAtlas atlas;
+    if (!BuildCrtGlyphAtlas(GetVT100Font(rFont.selection), CCharGenerator::FontFlagsNone, effects, atlas))
+    {
+        fprintf(stderr, "VT100_ATLAS: cannot build the atlas of %s\n", rFont.pSelectionName);
+        return false;
+    }
+
+    const unsigned glyphSize = atlas.width * atlas.height;
+    const unsigned glyphCount = atlas.lastChar - atlas.firstChar + 2;
+    char line[256];
+
+    snprintf(line, sizeof(line), "\n// %s: %ux%u, 0x%02X..0x%02X and the blank glyph\n", rFont.pSelectionName,
+             atlas.width, atlas.height, atlas.firstChar, atlas.lastChar);
+    rOut << line;
+    rOut << "static const u8 " << rFont.pArrayName << "Levels[] = {\n";
+    for (unsigned glyph = 0; glyph < glyphCount; ++glyph)
+    {
+        rOut << "    // ";
+        AppendGlyphLabel(rOut, glyph, atlas);
+        rOut << "\n";
+        const u8 *pGlyph = atlas.levels + glyph * glyphSize;
+        for (unsigned y = 0; y < atlas.height; ++y)
+        {
+            rOut << "    ";
+            for (unsigned x = 0; x < atlas.width; ++x)
+            {
+                const u8 level = pGlyph[y * atlas.width + x];
+                if (level == 0)
+                {
+                    rOut << "o,";
+                }
+                else if (level == CrtShadeLevels - 1)
+                {
+                    rOut << "X,";
+                }
+                else
+                {
+                    rOut << static_cast<unsigned>(level) << ",";
+                }
+            }
+            rOut << "\n";
+        }
+    }
+    rOut << "};\n";
+
+    rOut << "static const u64 " << rFont.pArrayName << "RowMasks[] = {\n";
+    for (unsigned glyph = 0; glyph < glyphCount; ++glyph)
+    {
+        snprintf(line, sizeof(line), "    0x%016llXULL, // ", static_cast<unsigned long long>(atlas.rowMasks[glyph]));
+        rOut << line;
+        AppendGlyphLabel(rOut, glyph, atlas);
+        rOut << "\n";
+    }
+    rOut << "};\n";
+
+    snprintf(line, sizeof(line), "    {EFontSelection::%s, %u, %u, 0x%02X, 0x%02X, %sLevels, %sRowMasks},\n",
+             rFont.pSelectionName, atlas.width, atlas.height, atlas.firstChar, atlas.lastChar, rFont.pArrayName,
+             rFont.pArrayName);
+    rEntries << line;
+
+    FreeCrtGlyphAtlas(atlas);
+    return true;
+}
+
+bool Generate(std::string &rText)
+{
+    std::ostringstream out;
+    std::ostringstream entries;
+    out << HeaderTop;
+    out << "static constexpr u8 o = 0;\n";
+    out << "static constexpr u8 X = " << (CrtShadeLevels - 1) << ";\n";
+
+    for (const TFontEntry &rFont : Fonts)
+    {
+        if (!AppendFont(out, entries, rFont))
+        {
+            return false;
+        }
+    }
+
+    out << "\nstatic const TEntry Entries[] = {\n" << entries.str() << "};\n";
+    out << "} // namespace VT100GlyphAtlas\n";
+
+    rText = out.str();
+    return true;
+}
+
+bool ReadFile(const char *pPath, std::string &rText)
+{
+    std::ifstream in(pPath, std::ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+    std::ostringstream content;
+    content << in.rdbuf();
+    rText = content.str();
+    return true;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool bCheck = false;
+    const char *pPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--check") == 0)
+        {
+            bCheck = true;
+        }
+        else if (pPath == nullptr && argv[i][0] != '-')
+        {
+            pPath = argv[i];
+        }
+        else
+        {
+            pPath = nullptr;
+            break;
+        }
+    }
+    if (pPath == nullptr)
+    {
+        fprintf(stderr, "usage: VT100_ATLAS [--check] FILE\n");
+        return 2;
+    }
+
+    std::string generated;
+    if (!Generate(generated))
+    {
+        return 2;
+    }
+
+    std::string current;
+    const bool bSame = ReadFile(pPath, current) && current == generated;
+    if (bCheck)
+    {
+        printf("%s: %s\n", pPath, bSame ? "up to date" : "STALE, run make atlas");
+        return bSame ? 0 : 1;
+    }
+    if (bSame)
+    {
+        printf("%s: unchanged\n", pPath);
+        return 0;
+    }
+
+    std::ofstream out(pPath, std::ios::binary | std::ios::trunc);
+    out << generated;
+    if (!out.flush())
+    {
+        fprintf(stderr, "VT100_ATLAS: cannot write %s\n", pPath);
+        return 2;
+    }
+    printf("%s: written (%zu bytes)\n", pPath, generated.size());
+    return 0;
+}
@@ -0,0 +1,1416 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_BENCH
+// Description:   Host microbenchmarks for the firmware renderer sources
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation (Sixel decoder)
+// 2026-10-18     R. Zuehlsdorff        CRT glyph effects case
+// 2026-10-18     R. Zuehlsdorff        Mixed text workload case
+// 2026-10-18     R. Zuehlsdorff        MCCP2 deflate case
+// 2026-10-18     R. Zuehlsdorff        Printer controller case
+// 2026-10-18     R. Zuehlsdorff        Renderer primitive case (CTRenderBench)
+// 2026-10-18     R. Zuehlsdorff        Log pane case
+// 2026-10-18     R. Zuehlsdorff        Presentation blit case (CTBlit)
+// 2026-10-18     R. Zuehlsdorff        Performance HUD case
+// 2026-10-18     R. Zuehlsdorff        Printable span scanner case
+// 2026-10-18     R. Zuehlsdorff        Terminal snapshot case
+// 2026-10-18     R. Zuehlsdorff        MCCP2 inflate round trip against zlib
+//------------------------------------------------------------------------------
+
+/**
+ * @file VT100_BENCH.cpp
+ * @brief Repeatable throughput measurements without a PTY.
+ * @details Links the same firmware objects as VT100_HOST and feeds synthetic
+ * input straight into them, so results do not depend on a shell or the PTY.
+ * Each case prints one result line; `--ppm FILE` keeps the last frame for a
+ * visual check.
+ *
+ * Cases:
+ * - `sixel`: a generated 16-color Sixel image, decoded by CTSixelDecoder into a
+ *   plain pixel buffer and by CTRenderer::Write() in 4 KiB chunks (as from the
+ *   UART/TCP host), reported as decoded pixels per second.
+ * - `crt`: full screens of text drawn with the CRT effects off and on; both
+ *   use the same pre-shaded glyph path, so the glyph rates should match.
+ * - `text`: terminal output as from a shell session (SGR attributes, erase to
+ *   end of line, cursor positioning, scrolling) through CTRenderer::Write(),
+ *   reported as glyphs per second; the reference workload for parser and
+ *   rasterizer changes.
+ * - `mccp`: a debug log with RX hex dumps through CTDeflateStream, one sync
+ *   flush per line as CTWlanLog sends it; reports compression ratio and input
+ *   rate for LZ77 blocks and for the stored-block fallback, then inflates
+ *   varied streams (seeds, chunk sizes, block types, flush points) with zlib
+ *   and fails unless every flush and the final Adler-32 round trip exactly.
+ * - `print`: print jobs (CSI 5 i ... CSI 4 i) with embedded escape sequences,
+ *   fed in odd-sized chunks so the terminator is split; reports the rate of
+ *   the renderer's printer controller path alone and through CTPrintCapture
+ *   into `PRINTnnn.TXT` below `--sd`, whose content is checked and removed.
+ *   Then more jobs than CTPrintCapture queues are sent before its task runs;
+ *   `print.merge` checks that the extra jobs land in the file of the last
+ *   queued job and nowhere else.
+ * - `prims`: CTRenderBench, the on-device microbenchmark of the drawing
+ *   primitives, timed with the time stamp counter instead of the ARM cycle
+ *   counter; its log lines are printed.
+ * - `logpane`: the `text` workload alone and with a burst of highlighted log
+ *   lines through the shown CTLogPane, ticked after every chunk as by the
+ *   kernel heartbeat; both glyph rates should match.
+ * - `blit`: CTBlit::Copy() against CTBlit::CopyReference() for random spans,
+ *   pitches and alignments, including the guard bytes around each span; then
+ *   full 1024x768 16 bpp screens through Copy(), CopyReference() and memcpy().
+ * - `hud`: the `text` workload alone and with the shown CTPerfHud ticked
+ *   after every chunk; reports both glyph rates, the HUD updates drawn and
+ *   the cost of the last one.
+ * - `scan`: CTRenderer::ScanPrintable() against a byte-wise scan for random
+ *   buffers at every alignment; then both scanners over the `text` and `mccp`
+ *   streams, and the `text` workload with every byte dispatched through the
+ *   parser and with printable spans.
+ * - `snapshot`: the `text` screen left with a scroll region, SGR and the
+ *   graphics character set, then TakeSnapshot() and RestoreSnapshot() around
+ *   a SET-UP like dialog; the frame, cells and resume state must come back
+ *   unchanged. Reports the round trip alone and with the dialog, against a
+ *   save and restore copy of the screen as used before.
+ */
+
+#include <circle/logger.h>
+#include <circle/sched/scheduler.h>
+#include <circle/timer.h>
+
+#include "TBlit.h"
+#include "TConfig.h"
+#include "TDeflateStream.h"
+#include "TFontConverter.h"
+#include "TLogPane.h"
+#include "TPerfHud.h"
+#include "TPrintCapture.h"
+#include "TRenderBench.h"
+#include "TRenderer.h"
+#include "TSixelDecoder.h"
+#include "host_display.h"
+
+#include <fatfs/ff.h>
+#include <zlib.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+LOGMODULE("bench");
+
+namespace
+{
+    const unsigned ChunkSize = 4096;
+    const unsigned SixelWidth = 600;
+    const unsigned SixelHeight = 480;
+    const unsigned SixelColors = 16;
+    const unsigned SixelPassesPerBand = 4;
+    const unsigned TextLines = 2000;
+    const unsigned MccpRoundTripSeeds = 24;
+    const size_t MccpRoundTripBytes = 48 * 1024;
+    const unsigned BlitTrials = 20000;
+    const unsigned BlitPitch = 2048;
+    const unsigned BlitLines = 768;
+    const unsigned ScanTrials = 100000;
+
+    struct TOptions
+    {
+        std::string benchCase = "sixel";
+        std::string driveRoot = ".";
+        std::string ppmPath;
+        unsigned iterations = 20;
+    };
+
+    TOptions g_Options;
+
+    /// Pseudo-random sequence, fixed seed so every run decodes the same image.
+    unsigned NextRandom(unsigned &rState)
+    {
+        rState = rState * 1103515245U + 12345U;
+        return (rState >> 16) & 0x7FFF;
+    }
+
+    /// Build a Sixel image with color definitions, repeats and overlaid color
+    /// passes per band, like img2sixel output; returns the pixels it sets.
+    u64 BuildSixelImage(std::string &rImage)
+    {
+        unsigned seed = 1;
+        u64 pixels = 0;
+        char buffer[32];
+
+        rImage = "\x1bP0;1;0q";
+        snprintf(buffer, sizeof(buffer), "\"1;1;%u;%u", SixelWidth, SixelHeight);
+        rImage += buffer;
+
+        for (unsigned color = 0; color < SixelColors; ++color)
+        {
+            snprintf(buffer, sizeof(buffer), "#%u;2;%u;%u;%u", color,
+                     color * 6, 100 - color * 6, (color * 37) % 101);
+            rImage += buffer;
+        }
+
+        for (unsigned band = 0; band < SixelHeight / CTSixelDecoder::BandHeight; ++band)
+        {
+            for (unsigned pass = 0; pass < SixelPassesPerBand; ++pass)
+            {
+                snprintf(buffer, sizeof(buffer), "#%u", (band + pass * 5) % SixelColors);
+                rImage += buffer;
+
+                for (unsigned x = 0; x < SixelWidth;)
+                {
+                    unsigned run = 1 + NextRandom(seed) % 8;
+                    if (run > SixelWidth - x)
+                    {
+                        run = SixelWidth - x;
+                    }
+                    const unsigned bits = NextRandom(seed) % 64;
+                    const char sixel = static_cast<char>(0x3F + bits);
+
+                    if (run >= 4)
+                    {
+                        snprintf(buffer, sizeof(buffer), "!%u%c", run, sixel);
+                        rImage += buffer;
+                    }
+                    else
+                    {
+                        rImage.append(run, sixel);
+                    }
+
+                    pixels += static_cast<u64>(__builtin_popcount(bits)) * run;
+                    x += run;
+                }
+
+                rImage += pass + 1 < SixelPassesPerBand ? '$' : '-';
+            }
+            rImage += '\n';
+        }
+
+        rImage += "\x1b\\";
+        return pixels;
+    }
+
+    void Report(const char *pName, size_t nBytes, u64 nItems, u64 nElapsedUs, const char *pUnit = "pixel")
+    {
+        const double seconds = nElapsedUs / 1000000.0;
+        printf("%-16s %10.2f MB/s %10.2f M%s/s  (%llu bytes, %llu %ss, %.3f s)\n",
+               pName, nBytes / seconds / 1e6, nItems / seconds / 1e6, pUnit,
+               static_cast<unsigned long long>(nBytes), static_cast<unsigned long long>(nItems), pUnit, seconds);
+    }
+
+    bool RunSixel(CTRenderer *pRenderer)
+    {
+        std::string image;
+        const u64 imagePixels = BuildSixelImage(image);
+
+        // Decoder alone, into a heap buffer with the renderer's geometry
+        CBcmFrameBuffer *pFrameBuffer = HostDisplay::GetFrameBuffer();
+        const unsigned pitch = pFrameBuffer->GetPitch();
+        std::vector<u8> pixels(static_cast<size_t>(pitch) * pRenderer->GetHeight());
+
+        CTSixelDecoder decoder;
+        CTSixelDecoder::TTarget target;
+        target.pBuffer = pixels.data();
+        target.nPitch = pitch;
+        target.nDepth = pFrameBuffer->GetDepth();
+        target.nOriginX = 0;
+        target.nOriginY = 0;
+        target.nClipX = pRenderer->GetWidth();
+        target.nClipY = pRenderer->GetHeight();
+
+        // Skip the DCS introducer and ST, the decoder only sees the data
+        const size_t dataStart = image.find('q') + 1;
+        const size_t dataLength = image.size() - 2 - dataStart;
+
+        u64 startUs = CTimer::GetClockTicks64();
+        for (unsigned i = 0; i < g_Options.iterations; ++i)
+        {
+            decoder.Begin(target, pFrameBuffer, TRUE, 0);
+            for (size_t n = 0; n < dataLength; ++n)
+            {
+                decoder.Write(image[dataStart + n]);
+            }
+            decoder.End();
+        }
+        Report("sixel.decoder", dataLength * g_Options.iterations, decoder.GetPixelCount(),
+               CTimer::GetClockTicks64() - startUs);
+
+        if (decoder.GetPixelCount() != imagePixels * g_Options.iterations)
+        {
+            LOGERR("Decoder stored %llu pixels, expected %llu",
+                   static_cast<unsigned long long>(decoder.GetPixelCount()),
+                   static_cast<unsigned long long>(imagePixels * g_Options.iterations));
+            return false;
+        }
+
+        // Full path: parser, decoder, damage and presentation per chunk
+        std::string stream;
+        for (unsigned i = 0; i < g_Options.iterations; ++i)
+        {
+            stream += "\x1b[H";
+            stream += image;
+        }
+
+        startUs = CTimer::GetClockTicks64();
+        for (size_t offset = 0; offset < stream.size(); offset += ChunkSize)
+        {
+            const size_t length = stream.size() - offset < ChunkSize ? stream.size() - offset : ChunkSize;
+            pRenderer->Write(stream.data() + offset, length);
+        }
+        Report("sixel.renderer", stream.size(), imagePixels * g_Options.iterations,
+               CTimer::GetClockTicks64() - startUs);
+
+        return true;
+    }
+
+    bool RunCrt(CTRenderer *pRenderer)
+    {
+        const unsigned columns = pRenderer->GetColumns();
+        const unsigned rows = pRenderer->GetRows();
+
+        // One screen of printable ASCII; the last line ends without a newline so nothing scrolls
+        std::string page = "\x1b[H";
+        for (unsigned row = 0; row < rows; ++row)
+        {
+            for (unsigned column = 0; column < columns; ++column)
+            {
+                page += static_cast<char>('!' + (row * 7 + column) % 94);
+            }
+            if (row + 1 < rows)
+            {
+                page += "\r\n";
+            }
+        }
+        const u64 glyphs = static_cast<u64>(columns) * rows * g_Options.iterations;
+
+        static const struct
+        {
+            const char *pName;
+            TCrtEffects effects;
+        } s_Settings[] = {
+            {"crt.off", {0, 0, 0}},
+            {"crt.on", {60, 50, 60}},
+        };
+
+        for (const auto &rSetting : s_Settings)
+        {
+            pRenderer->SetCrtEffects(rSetting.effects);
+
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                pRenderer->Write(page.data(), page.size());
+            }
+            Report(rSetting.pName, page.size() * g_Options.iterations, glyphs,
+                   CTimer::GetClockTicks64() - startUs, "glyph");
+        }
+
+        return true;
+    }
+
+    /// Build shell-like output: colored names, plain words, erase to end of
+    /// line and a status line updated by cursor positioning every 16 lines.
+    u64 BuildTextStream(std::string &rStream)
+    {
+        static const char *const s_Attributes[] = {"\x1b[0m", "\x1b[1m", "\x1b[4m", "\x1b[7m", "\x1b[1;4m"};
+        unsigned seed = 7;
+        u64 glyphs = 0;
+        char buffer[32];
+
+        for (unsigned line = 0; line < TextLines; ++line)
+        {
+            rStream += s_Attributes[line % 5];
+            snprintf(buffer, sizeof(buffer), "%05u", line);
+            rStream += buffer;
+            rStream += "\x1b[m ";
+            glyphs += 6;
+
+            const unsigned words = 3 + NextRandom(seed) % 9;
+            for (unsigned word = 0; word < words; ++word)
+            {
+                const unsigned length = 2 + NextRandom(seed) % 6;
+                for (unsigned i = 0; i < length; ++i)
+                {
+                    rStream += static_cast<char>('a' + NextRandom(seed) % 26);
+                }
+                rStream += ' ';
+                glyphs += length + 1;
+            }
+            rStream += "\x1b[K\r\n";
+
+            if (line % 16 == 15)
+            {
+                snprintf(buffer, sizeof(buffer), "\x1b" "7\x1b[1;60H\x1b[7m%6u\x1b[m\x1b" "8", line);
+                rStream += buffer;
+                glyphs += 6;
+            }
+        }
+
+        return glyphs;
+    }
+
+    bool RunText(CTRenderer *pRenderer)
+    {
+        std::string stream;
+        const u64 glyphs = BuildTextStream(stream);
+
+        const u64 startUs = CTimer::GetClockTicks64();
+        for (unsigned i = 0; i < g_Options.iterations; ++i)
+        {
+            for (size_t offset = 0; offset < stream.size(); offset += ChunkSize)
+            {
+                const size_t length = stream.size() - offset < ChunkSize ? stream.size() - offset : ChunkSize;
+                pRenderer->Write(stream.data() + offset, length);
+            }
+        }
+        Report("text.renderer", stream.size() * g_Options.iterations, glyphs * g_Options.iterations,
+               CTimer::GetClockTicks64() - startUs, "glyph");
+
+        return true;
+    }
+
+    /// Text workload with and without log output: the burst pass writes
+    /// LogLinesPerChunk warning lines through the shown log pane per chunk.
+    bool RunLogPane(CTRenderer *pRenderer)
+    {
+        const unsigned LogLinesPerChunk = 8;
+        std::string stream;
+        const u64 glyphs = BuildTextStream(stream);
+
+        CTLogPane *pPane = CTLogPane::Get();
+        pPane->Initialize(nullptr);
+        pPane->Attach(pRenderer);
+        pPane->Toggle();
+
+        u32 logLines = 0;
+        char line[128];
+        for (unsigned burst = 0; burst <= 1; ++burst)
+        {
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                for (size_t offset = 0; offset < stream.size(); offset += ChunkSize)
+                {
+                    const size_t length = stream.size() - offset < ChunkSize ? stream.size() - offset : ChunkSize;
+                    pRenderer->Write(stream.data() + offset, length);
+
+                    for (unsigned n = 0; burst && n < LogLinesPerChunk; ++n, ++logLines)
+                    {
+                        const int lineLength = snprintf(line, sizeof(line),
+                            "\x1b[1m00:%02u:%02u.%02u uart: RX overrun, %u bytes lost\x1b[0m\n",
+                            logLines / 6000 % 60, logLines / 100 % 60, logLines % 100, logLines % 97);
+                        pPane->Write(line, static_cast<size_t>(lineLength));
+                    }
+                    pPane->Tick(TRUE);
+                }
+            }
+            Report(burst ? "logpane.burst" : "logpane.quiet", stream.size() * g_Options.iterations,
+                   glyphs * g_Options.iterations, CTimer::GetClockTicks64() - startUs, "glyph");
+        }
+
+        printf("%-16s %10u log lines, %u pane updates\n", "", static_cast<unsigned>(logLines),
+               pPane->GetUpdateCount());
+
+        // Let the last rate-limited update through; the pane stays shown for --ppm
+        CScheduler::Get()->MsSleep(1000 / CTLogPane::MaxUpdatesPerSecond);
+        pPane->Tick(TRUE);
+        return pPane->GetLineCount() == logLines;
+    }
+
+    /// Transport counters as the kernel would sample them, slowly counting up.
+    void SamplePerfHud(CTPerfHud::TSample &rSample)
+    {
+        static u32 s_Samples = 0;
+        ++s_Samples;
+        rSample.nUartOverruns = s_Samples / 4;
+        rSample.bFlowControl = TRUE;
+        rSample.bXoff = (s_Samples & 1) ? TRUE : FALSE;
+        rSample.nNetRxBytes = s_Samples * 1200;
+        rSample.nNetTxBytes = s_Samples * 48000;
+        rSample.nFreeHeap = 200U * 1024 * 1024;
+    }
+
+    /// Text workload with the HUD hidden and shown: the shown pass ticks the
+    /// HUD after every chunk as the kernel heartbeat does.
+    bool RunPerfHud(CTRenderer *pRenderer)
+    {
+        std::string stream;
+        const u64 glyphs = BuildTextStream(stream);
+
+        CTPerfHud *pHud = CTPerfHud::Get();
+        pHud->Initialize(pRenderer, &SamplePerfHud);
+
+        for (unsigned shown = 0; shown <= 1; ++shown)
+        {
+            if (shown)
+            {
+                pHud->Toggle();
+            }
+
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                for (size_t offset = 0; offset < stream.size(); offset += ChunkSize)
+                {
+                    const size_t length = stream.size() - offset < ChunkSize ? stream.size() - offset : ChunkSize;
+                    pRenderer->Write(stream.data() + offset, length);
+                    pHud->Tick(TRUE);
+                }
+            }
+            Report(shown ? "hud.shown" : "hud.hidden", stream.size() * g_Options.iterations,
+                   glyphs * g_Options.iterations, CTimer::GetClockTicks64() - startUs, "glyph");
+        }
+
+        // At least one line after the priming sample; the HUD stays shown for --ppm
+        CScheduler::Get()->MsSleep(1000 / CTPerfHud::UpdatesPerSecond);
+        pHud->Tick(TRUE);
+        printf("%-16s %10u HUD updates, last %u us\n", "", pHud->GetUpdateCount(), pHud->GetLastCostUs());
+        printf("%-16s %s\n", "", pHud->GetText());
+        return pHud->GetUpdateCount() != 0;
+    }
+
+    /// Build a LogDebug session as mirrored to telnet: status lines and RX hex
+    /// dumps of random host data; returns the line lengths.
+    void BuildLogStream(std::string &rStream, std::vector<size_t> &rLines)
+    {
+        unsigned seed = 7;
+        char buffer[160];
+
+        for (unsigned line = 0; line < TextLines; ++line)
+        {
+            const size_t start = rStream.size();
+            if (line % 4 == 0)
+            {
+                snprintf(buffer, sizeof(buffer), "00:%02u:%02u.%02u uart: RX %u bytes, fifo %u\r\n",
+                         line / 600 % 60, line / 10 % 60, line % 100, 16 + NextRandom(seed) % 48,
+                         NextRandom(seed) % 64);
+                rStream += buffer;
+            }
+            else
+            {
+                snprintf(buffer, sizeof(buffer), "00:%02u:%02u.%02u uart: %04X:", line / 600 % 60,
+                         line / 10 % 60, line % 100, (line % 4 - 1) * 16);
+                rStream += buffer;
+                for (unsigned i = 0; i < 16; ++i)
+                {
+                    snprintf(buffer, sizeof(buffer), " %02X", NextRandom(seed) % 3 == 0 ? 0x1B : 0x20 + NextRandom(seed) % 0x5F);
+                    rStream += buffer;
+                }
+                rStream += "\r\n";
+            }
+            rStream += ">: ";
+            rLines.push_back(rStream.size() - start);
+        }
+    }
+
+    /// Build varied deflate input: log text, random bytes, byte runs longer
+    /// than MaxMatch and copies from near and far back, so matches cross the
+    /// window slide.
+    void BuildDeflateInput(unsigned seed, const std::string &rLog, std::string &rInput)
+    {
+        while (rInput.size() < MccpRoundTripBytes)
+        {
+            const unsigned length = 1 + NextRandom(seed) % 700;
+            switch (NextRandom(seed) % 4)
+            {
+            case 0:
+                rInput.append(rLog, NextRandom(seed) * 7 % (rLog.size() - length), length);
+                break;
+            case 1:
+                for (unsigned i = 0; i < length; ++i)
+                {
+                    rInput.push_back(static_cast<char>(NextRandom(seed)));
+                }
+                break;
+            case 2:
+                rInput.append(length, static_cast<char>(NextRandom(seed)));
+                break;
+            default:
+                if (rInput.size() > length)
+                {
+                    const size_t distance = 1 + NextRandom(seed) * 3 % (rInput.size() < 6000 ? rInput.size() : 6000);
+                    const size_t from = rInput.size() - distance;
+                    for (unsigned i = 0; i < length; ++i)
+                    {
+                        rInput.push_back(rInput[from + i]);
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    /// Feed deflate output to the zlib reference inflater and append what it decodes.
+    int Inflate(z_stream &rInflate, const u8 *pData, size_t nLength, std::string &rDecoded)
+    {
+        u8 buffer[4096];
+        rInflate.next_in = const_cast<u8 *>(pData);
+        rInflate.avail_in = static_cast<uInt>(nLength);
+        int status = Z_OK;
+        do
+        {
+            rInflate.next_out = buffer;
+            rInflate.avail_out = sizeof(buffer);
+            status = inflate(&rInflate, Z_SYNC_FLUSH);
+            rDecoded.append(reinterpret_cast<const char *>(buffer), sizeof(buffer) - rInflate.avail_out);
+        } while (status == Z_OK && (rInflate.avail_in != 0 || rInflate.avail_out == 0));
+        return status == Z_BUF_ERROR && rInflate.avail_in == 0 ? Z_OK : status;
+    }
+
+    /// Round trip through zlib: seeds vary the input, the chunk sizes, the
+    /// mix of Compress() and Store() and where Flush() is called. After every
+    /// flush the inflater must have decoded all input so far, and Finish() must
+    /// end the stream with a matching Adler-32.
+    bool RunMccpRoundTrip(const std::string &rLog)
+    {
+        CTDeflateStream *pDeflate = new CTDeflateStream;
+        std::vector<u8> output(CTDeflateStream::MaxOutput(CTDeflateStream::MaxInputChunk));
+        bool bResult = true;
+        unsigned streams = 0;
+        unsigned flushes = 0;
+        u64 total = 0;
+
+        for (unsigned seed = 1; seed <= MccpRoundTripSeeds && bResult; ++seed)
+        {
+            std::string input;
+            BuildDeflateInput(seed, rLog, input);
+
+            z_stream inflater = {};
+            inflateInit(&inflater);
+            pDeflate->Reset();
+
+            std::string decoded;
+            unsigned state = seed * 0x9E37U;
+            int status = Z_OK;
+            size_t offset = 0;
+            while (offset < input.size() && status == Z_OK)
+            {
+                // Chunks of every size up to MaxInputChunk; every 8th stream mostly single bytes
+                size_t length = seed % 8 == 0 ? 1 + NextRandom(state) % 4
+                                              : 1 + NextRandom(state) % CTDeflateStream::MaxInputChunk;
+                if (length > input.size() - offset)
+                {
+                    length = input.size() - offset;
+                }
+
+                // Seeds 3, 6, ... store every chunk, the others mix in a stored block now and then
+                const bool bStore = seed % 3 == 0 || NextRandom(state) % 8 == 0;
+                size_t produced = bStore ? pDeflate->Store(input.data() + offset, length, output.data())
+                                         : pDeflate->Compress(input.data() + offset, length, output.data());
+                offset += length;
+                if (produced > output.size())
+                {
+                    LOGERR("Seed %u: %zu output bytes for %zu input bytes", seed, produced, length);
+                    status = Z_DATA_ERROR;
+                    break;
+                }
+                status = Inflate(inflater, output.data(), produced, decoded);
+
+                // Flush after every chunk, at random points or only at the end
+                const unsigned every = seed % 4 == 0 ? 1 : seed % 4 == 1 ? 4 : seed % 4 == 2 ? 32 : 0;
+                if (status == Z_OK && every != 0 && NextRandom(state) % every == 0)
+                {
+                    produced = pDeflate->Flush(output.data());
+                    status = Inflate(inflater, output.data(), produced, decoded);
+                    ++flushes;
+                    if (status == Z_OK && decoded.compare(0, std::string::npos, input, 0, offset) != 0)
+                    {
+                        LOGERR("Seed %u: %zu bytes decoded after a flush at %zu", seed, decoded.size(), offset);
+                        status = Z_DATA_ERROR;
+                    }
+                }
+            }
+
+            if (status == Z_OK)
+            {
+                const size_t produced = pDeflate->Finish(output.data());
+                status = Inflate(inflater, output.data(), produced, decoded);
+            }
+            if (status != Z_STREAM_END || inflater.avail_in != 0 || decoded != input)
+            {
+                LOGERR("Seed %u: inflate status %d, %zu of %zu bytes decoded%s", seed, status, decoded.size(),
+                       input.size(), inflater.msg != nullptr ? inflater.msg : "");
+                bResult = false;
+            }
+            inflateEnd(&inflater);
+            total += input.size();
+            ++streams;
+        }
+
+        delete pDeflate;
+        printf("%-16s %u streams, %llu bytes, %u flushes, %s\n", "mccp.inflate", streams,
+               static_cast<unsigned long long>(total), flushes, bResult ? "round trip as expected" : "ROUND TRIP FAILED");
+        return bResult;
+    }
+
+    bool RunMccp()
+    {
+        std::string stream;
+        std::vector<size_t> lines;
+        BuildLogStream(stream, lines);
+
+        CTDeflateStream *pDeflate = new CTDeflateStream;
+        std::vector<u8> output(CTDeflateStream::MaxOutput(CTDeflateStream::MaxInputChunk));
+
+        for (unsigned stored = 0; stored <= 1; ++stored)
+        {
+            u64 produced = 0;
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                pDeflate->Reset();
+                size_t offset = 0;
+                for (size_t length : lines)
+                {
+                    produced += stored ? pDeflate->Store(stream.data() + offset, length, output.data())
+                                       : pDeflate->Compress(stream.data() + offset, length, output.data());
+                    produced += pDeflate->Flush(output.data());
+                    offset += length;
+                }
+            }
+            const u64 elapsedUs = CTimer::GetClockTicks64() - startUs;
+
+            const u64 consumed = static_cast<u64>(stream.size()) * g_Options.iterations;
+            Report(stored ? "mccp.stored" : "mccp.deflate", consumed, lines.size() * g_Options.iterations,
+                   elapsedUs, "line");
+            printf("%-16s %10.1f %% of input (%llu -> %llu bytes)\n", "", produced * 100.0 / consumed,
+                   static_cast<unsigned long long>(consumed), static_cast<unsigned long long>(produced));
+        }
+
+        delete pDeflate;
+        return RunMccpRoundTrip(stream);
+    }
+
+    /// Build a print job: report lines with SGR sequences and ESC [ 4 x
+    /// near-misses of the terminator, which must reach the file unchanged.
+    void BuildPrintJob(std::string &rJob)
+    {
+        unsigned seed = 11;
+        char buffer[64];
+
+        for (unsigned line = 0; line < TextLines * 4; ++line)
+        {
+            snprintf(buffer, sizeof(buffer), "%06u \x1b[1m%08X\x1b[m ", line, NextRandom(seed) * 65536U + NextRandom(seed));
+            rJob += buffer;
+            const unsigned length = 20 + NextRandom(seed) % 40;
+            for (unsigned i = 0; i < length; ++i)
+            {
+                rJob += static_cast<char>(' ' + NextRandom(seed) % 95);
+            }
+            rJob += line % 7 == 0 ? "\x1b[4m\x1b[4\r\n" : "\r\n";
+        }
+    }
+
+    /// Feed the jobs in chunks of 4093 bytes so chunk ends fall anywhere; with
+    /// bWait the writer task may fall at most half a ring behind, as a host
+    /// link far slower than the card would never get further ahead.
+    void WritePrintJobs(CTRenderer *pRenderer, const std::string &rStream, bool bWait)
+    {
+        const size_t PrintChunk = ChunkSize - 3;
+        for (size_t offset = 0; offset < rStream.size(); offset += PrintChunk)
+        {
+            const size_t length = rStream.size() - offset < PrintChunk ? rStream.size() - offset : PrintChunk;
+            pRenderer->Write(rStream.data() + offset, length);
+            while (bWait && CTPrintCapture::Get()->GetBacklog() > CTPrintCapture::RingSize / 2)
+            {
+                CScheduler::Get()->Yield();
+            }
+        }
+    }
+
+    u64 g_PrintBytes = 0;
+    unsigned g_PrintJobs = 0;
+
+    void CountPrintData(CTRenderer::TPrintEvent Event, const char *pData, size_t nLength)
+    {
+        (void)pData;
+        g_PrintBytes += nLength;
+        g_PrintJobs += Event == CTRenderer::PrintJobEnd ? 1 : 0;
+    }
+
+    void CapturePrintData(CTRenderer::TPrintEvent Event, const char *pData, size_t nLength)
+    {
+        CTPrintCapture *pCapture = CTPrintCapture::Get();
+        switch (Event)
+        {
+        case CTRenderer::PrintJobStart:
+            pCapture->BeginJob();
+            break;
+        case CTRenderer::PrintJobData:
+            pCapture->Write(pData, nLength);
+            break;
+        case CTRenderer::PrintJobEnd:
+            pCapture->EndJob();
+            break;
+        }
+    }
+
+    /// Read and remove the nCount highest numbered print files, lowest number first.
+    void TakePrintFiles(unsigned nCount, std::vector<std::string> &rContents)
+    {
+        // Files written by this run are the highest numbers on the card
+        rContents.clear();
+        for (unsigned number = CTPrintCapture::MaxFileNumber; number > 0 && rContents.size() < nCount; --number)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/PRINT%03u.TXT", g_Options.driveRoot.c_str(), number);
+            FILE *pFile = fopen(path, "rb");
+            if (pFile == nullptr)
+            {
+                continue;
+            }
+            std::string content;
+            char buffer[4096];
+            size_t length;
+            while ((length = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+            {
+                content.append(buffer, length);
+            }
+            fclose(pFile);
+            remove(path);
+            rContents.insert(rContents.begin(), content);
+        }
+    }
+
+    /// More jobs than CTPrintCapture queues, all sent before the writer runs:
+    /// the first MaxPendingJobs - 1 get a file each, the rest share the last one.
+    bool RunPrintMerge(CTRenderer *pRenderer)
+    {
+        const unsigned Jobs = CTPrintCapture::MaxPendingJobs + 4;
+        CTPrintCapture *pCapture = CTPrintCapture::Get();
+        const unsigned mergedBefore = pCapture->GetMergedJobs();
+        pRenderer->RegisterPrintHandler(&CapturePrintData);
+
+        std::vector<std::string> expected(CTPrintCapture::MaxPendingJobs);
+        for (unsigned i = 0; i < Jobs; ++i)
+        {
+            // Each job has its own number in every line and a size that is no sector multiple
+            std::string job;
+            for (unsigned line = 0; line < 20 + i * 7; ++line)
+            {
+                char text[64];
+                snprintf(text, sizeof(text), "job %02u line %03u\r\n", i, line);
+                job += text;
+            }
+            const std::string stream = "\x1b[5i" + job + "\x1b[4i";
+            pRenderer->Write(stream.data(), stream.size());
+
+            const unsigned file = i < CTPrintCapture::MaxPendingJobs ? i : CTPrintCapture::MaxPendingJobs - 1;
+            expected[file] += job;
+        }
+        pRenderer->RegisterPrintHandler(nullptr);
+
+        while (!pCapture->IsIdle())
+        {
+            CScheduler::Get()->MsSleep(1);
+        }
+
+        bool bResult = true;
+        const unsigned merged = pCapture->GetMergedJobs() - mergedBefore;
+        if (merged != Jobs - CTPrintCapture::MaxPendingJobs)
+        {
+            LOGERR("%u print jobs merged, expected %u", merged, Jobs - CTPrintCapture::MaxPendingJobs);
+            bResult = false;
+        }
+
+        std::vector<std::string> files;
+        TakePrintFiles(CTPrintCapture::MaxPendingJobs, files);
+        for (size_t i = 0; i < files.size() && i < expected.size(); ++i)
+        {
+            if (files[i] != expected[i])
+            {
+                LOGERR("Print file %zu of %u jobs: %zu bytes, expected %zu", i + 1, Jobs, files[i].size(),
+                       expected[i].size());
+                bResult = false;
+            }
+        }
+        if (files.size() != expected.size())
+        {
+            LOGERR("Found %zu print files for %u jobs, expected %zu", files.size(), Jobs, expected.size());
+            bResult = false;
+        }
+
+        printf("%-16s %u jobs into %zu files, %u merged, %s\n", "print.merge", Jobs, files.size(), merged,
+               bResult ? "content as expected" : "CONTENT DIFFERS");
+        return bResult;
+    }
+
+    bool RunPrint(CTRenderer *pRenderer)
+    {
+        std::string job;
+        BuildPrintJob(job);
+        const std::string stream = "\x1b[5i" + job + "\x1b[4ijob done\r\n";
+        bool bResult = true;
+
+        // Renderer only: the bytes must bypass the parser
+        pRenderer->RegisterPrintHandler(&CountPrintData);
+        u64 startUs = CTimer::GetClockTicks64();
+        for (unsigned i = 0; i < g_Options.iterations; ++i)
+        {
+            WritePrintJobs(pRenderer, stream, false);
+        }
+        Report("print.renderer", stream.size() * g_Options.iterations, g_PrintBytes,
+               CTimer::GetClockTicks64() - startUs, "byte");
+        if (g_PrintBytes != static_cast<u64>(job.size()) * g_Options.iterations || g_PrintJobs != g_Options.iterations)
+        {
+            LOGERR("Printer controller passed %llu bytes in %u jobs, expected %llu in %u",
+                   static_cast<unsigned long long>(g_PrintBytes), g_PrintJobs,
+                   static_cast<unsigned long long>(job.size()) * g_Options.iterations, g_Options.iterations);
+            bResult = false;
+        }
+
+        // Through the SD writer task; one file per job
+        CTPrintCapture *pCapture = CTPrintCapture::Get();
+        if (!pCapture->Initialize())
+        {
+            LOGERR("Print capture init failed");
+            return false;
+        }
+        pRenderer->RegisterPrintHandler(&CapturePrintData);
+
+        const unsigned jobs = g_Options.iterations < 8 ? g_Options.iterations : 8;
+        startUs = CTimer::GetClockTicks64();
+        for (unsigned i = 0; i < jobs; ++i)
+        {
+            WritePrintJobs(pRenderer, stream, true);
+        }
+        while (!pCapture->IsIdle())
+        {
+            CScheduler::Get()->MsSleep(1);
+        }
+        Report("print.sd", stream.size() * jobs, static_cast<u64>(job.size()) * jobs,
+               CTimer::GetClockTicks64() - startUs, "byte");
+        pRenderer->RegisterPrintHandler(nullptr);
+
+        if (pCapture->GetDroppedBytes() != 0)
+        {
+            LOGERR("Print capture dropped %u bytes", pCapture->GetDroppedBytes());
+            bResult = false;
+        }
+
+        std::vector<std::string> files;
+        TakePrintFiles(jobs, files);
+        for (const std::string &content : files)
+        {
+            if (content != job)
+            {
+                LOGERR("Print file: %zu bytes, content differs from the job (%zu bytes)", content.size(), job.size());
+                bResult = false;
+            }
+        }
+        if (files.size() != jobs)
+        {
+            LOGERR("Found %zu print files, expected %u", files.size(), jobs);
+            bResult = false;
+        }
+
+        return RunPrintMerge(pRenderer) && bResult;
+    }
+
+    bool RunBlit()
+    {
+        // Correctness: the destination must equal the reference result, also
+        // outside the span, for every alignment of source and destination
+        const unsigned checkLines = 8;
+        const unsigned checkSize = BlitPitch * (checkLines + 1);
+        std::vector<u8> source(checkSize);
+        std::vector<u8> burst(checkSize);
+        std::vector<u8> reference(checkSize);
+        unsigned random = 1;
+        for (u8 &rByte : source)
+        {
+            rByte = static_cast<u8>(NextRandom(random));
+        }
+
+        bool bResult = true;
+        for (unsigned trial = 0; trial < BlitTrials && bResult; ++trial)
+        {
+            const unsigned sourcePitch = BlitPitch / 2 + NextRandom(random) % (BlitPitch / 2);
+            const unsigned destPitch = BlitPitch / 2 + NextRandom(random) % (BlitPitch / 2);
+            const unsigned sourceOffset = NextRandom(random) % 64;
+            const unsigned destOffset = NextRandom(random) % 64;
+            const unsigned maxBytes = (sourcePitch < destPitch ? sourcePitch : destPitch) - 64;
+            const unsigned bytes = NextRandom(random) % (trial % 4 ? 256 : maxBytes);
+            const unsigned lines = 1 + NextRandom(random) % checkLines;
+
+            memset(burst.data(), 0xA5, checkSize);
+            memset(reference.data(), 0xA5, checkSize);
+            CTBlit::Copy(burst.data() + destOffset, destPitch, source.data() + sourceOffset, sourcePitch,
+                         bytes, lines);
+            CTBlit::CopyReference(reference.data() + destOffset, destPitch, source.data() + sourceOffset,
+                                  sourcePitch, bytes, lines);
+            if (burst != reference)
+            {
+                LOGERR("Blit trial %u differs: %u bytes x %u lines, offsets %u -> %u, pitches %u -> %u",
+                       trial, bytes, lines, sourceOffset, destOffset, sourcePitch, destPitch);
+                bResult = false;
+            }
+        }
+        printf("%-16s %u trials %s\n", "blit.check", BlitTrials, bResult ? "ok" : "FAILED");
+
+        // Throughput: a 1024x768 16 bpp screen, shadow buffer to framebuffer
+        const unsigned lineBytes = 1024 * 2;
+        std::vector<u8> screen(static_cast<size_t>(lineBytes) * BlitLines);
+        std::vector<u8> frame(static_cast<size_t>(lineBytes) * BlitLines);
+        for (u8 &rByte : screen)
+        {
+            rByte = static_cast<u8>(NextRandom(random));
+        }
+
+        const char *const names[] = {"blit.burst", "blit.reference", "blit.memcpy"};
+        for (unsigned method = 0; method < 3; ++method)
+        {
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                if (method == 0)
+                {
+                    CTBlit::Copy(frame.data(), lineBytes, screen.data(), lineBytes, lineBytes, BlitLines);
+                }
+                else if (method == 1)
+                {
+                    CTBlit::CopyReference(frame.data(), lineBytes, screen.data(), lineBytes, lineBytes, BlitLines);
+                }
+                else
+                {
+                    for (unsigned y = 0; y < BlitLines; ++y)
+                    {
+                        memcpy(frame.data() + y * lineBytes, screen.data() + y * lineBytes, lineBytes);
+                    }
+                }
+            }
+            const u64 elapsedUs = CTimer::GetClockTicks64() - startUs;
+            Report(names[method], screen.size() * g_Options.iterations,
+                   static_cast<u64>(BlitLines) * g_Options.iterations, elapsedUs, "line");
+
+            if (frame != screen)
+            {
+                LOGERR("%s: frame differs from the source", names[method]);
+                bResult = false;
+            }
+            memset(frame.data(), 0, frame.size());
+        }
+
+        return bResult;
+    }
+
+    /// The classification the parser applies per byte in Write(char).
+    size_t ScanPrintableBytewise(const char *pChar, size_t nCount)
+    {
+        size_t i = 0;
+        while (i < nCount && static_cast<unsigned char>(pChar[i]) >= 0x20U &&
+               static_cast<unsigned char>(pChar[i]) != 0x7FU)
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    typedef size_t TScanPrintable(const char *pChar, size_t nCount);
+
+    /// Split rStream into printable spans as WriteBytes() does, stepping over
+    /// the byte after each span; returns the number of spans.
+    u64 CountSpans(TScanPrintable *pScan, const std::string &rStream)
+    {
+        u64 spans = 0;
+        for (size_t offset = 0; offset < rStream.size();)
+        {
+            const size_t span = pScan(rStream.data() + offset, rStream.size() - offset);
+            spans += span > 0 ? 1 : 0;
+            offset += span + 1;
+        }
+        return spans;
+    }
+
+    bool RunScan(CTRenderer *pRenderer)
+    {
+        // Correctness: mostly text with controls, ESC, DEL and 8-bit bytes mixed
+        // in, at every alignment and length
+        std::vector<char> buffer(256);
+        unsigned random = 3;
+        bool bResult = true;
+        for (unsigned trial = 0; trial < ScanTrials && bResult; ++trial)
+        {
+            for (char &rByte : buffer)
+            {
+                const unsigned kind = NextRandom(random) % 64;
+                rByte = static_cast<char>(kind == 0   ? NextRandom(random) % 0x20
+                                          : kind == 1 ? 0x7F
+                                          : kind == 2 ? 0x80 + NextRandom(random) % 0x80
+                                                      : 0x20 + NextRandom(random) % 0x5F);
+            }
+            const size_t offset = NextRandom(random) % 16;
+            const size_t length = NextRandom(random) % (buffer.size() - offset);
+            if (CTRenderer::ScanPrintable(&buffer[offset], length) != ScanPrintableBytewise(&buffer[offset], length))
+            {
+                printf("%-16s mismatch in trial %u (offset %zu, length %zu)\n", "scan.check", trial, offset, length);
+                bResult = false;
+            }
+        }
+
+        std::string text;
+        const u64 glyphs = BuildTextStream(text);
+        std::string log;
+        std::vector<size_t> logLines;
+        BuildLogStream(log, logLines);
+
+        const struct
+        {
+            const char *pName;
+            const std::string *pStream;
+            TScanPrintable *pScan;
+        } scans[] = {
+            {"scan.text.bytes", &text, &ScanPrintableBytewise},
+            {"scan.text.swar", &text, &CTRenderer::ScanPrintable},
+            {"scan.log.bytes", &log, &ScanPrintableBytewise},
+            {"scan.log.swar", &log, &CTRenderer::ScanPrintable},
+        };
+        const unsigned scanIterations = g_Options.iterations * 50;
+        for (const auto &rScan : scans)
+        {
+            u64 spans = 0;
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < scanIterations; ++i)
+            {
+                spans += CountSpans(rScan.pScan, *rScan.pStream);
+            }
+            Report(rScan.pName, rScan.pStream->size() * scanIterations, spans, CTimer::GetClockTicks64() - startUs,
+                   "span");
+        }
+
+        // Full path: the same text once per byte through the parser, once in spans
+        for (unsigned spans = 0; spans <= 1; ++spans)
+        {
+            pRenderer->SetPrintableSpans(spans ? TRUE : FALSE);
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < g_Options.iterations; ++i)
+            {
+                for (size_t offset = 0; offset < text.size(); offset += ChunkSize)
+                {
+                    const size_t length = text.size() - offset < ChunkSize ? text.size() - offset : ChunkSize;
+                    pRenderer->Write(text.data() + offset, length);
+                }
+            }
+            Report(spans ? "scan.spans" : "scan.perbyte", text.size() * g_Options.iterations,
+                   glyphs * g_Options.iterations, CTimer::GetClockTicks64() - startUs, "glyph");
+        }
+
+        return bResult;
+    }
+
+    struct TScreenState
+    {
+        std::vector<u8> frame;
+        std::vector<CTCellBuffer::TCell> cells;
+        CTRenderer::TResumeState resume;
+    };
+
+    void CaptureScreen(CTRenderer *pRenderer, TScreenState &rState)
+    {
+        CBcmFrameBuffer *pFrameBuffer = HostDisplay::GetFrameBuffer();
+        const u8 *pFrame = pFrameBuffer->GetBuffer();
+        rState.frame.assign(pFrame, pFrame + static_cast<size_t>(pFrameBuffer->GetPitch()) * pFrameBuffer->GetHeight());
+
+        rState.cells.clear();
+        for (unsigned row = 0; row < pRenderer->GetRows(); ++row)
+        {
+            for (unsigned column = 0; column < pRenderer->GetColumns(); ++column)
+            {
+                CTCellBuffer::TCell cell = {0, 0};
+                pRenderer->GetCell(row, column, cell);
+                rState.cells.push_back(cell);
+            }
+        }
+
+        memset(&rState.resume, 0, sizeof(rState.resume));
+        pRenderer->GetResumeState(rState.resume);
+    }
+
+    bool SameScreen(const TScreenState &rLeft, const TScreenState &rRight)
+    {
+        bool bCells = rLeft.cells.size() == rRight.cells.size();
+        for (size_t i = 0; bCells && i < rLeft.cells.size(); ++i)
+        {
+            bCells = rLeft.cells[i].ch == rRight.cells[i].ch && rLeft.cells[i].attr == rRight.cells[i].attr;
+        }
+        return bCells && rLeft.frame == rRight.frame && memcmp(&rLeft.resume, &rRight.resume, sizeof(rLeft.resume)) == 0;
+    }
+
+    bool RunSnapshot(CTRenderer *pRenderer)
+    {
+        std::string text;
+        BuildTextStream(text);
+        for (size_t offset = 0; offset < text.size(); offset += ChunkSize)
+        {
+            const size_t length = text.size() - offset < ChunkSize ? text.size() - offset : ChunkSize;
+            pRenderer->Write(text.data() + offset, length);
+        }
+        // State a dialog must not disturb: scroll region, rendition, G0 graphics, cursor
+        const char state[] = "\x1B[3;20r\x1B[1;7m\x1B(0\x1B[12;30Hlqk";
+        pRenderer->Write(state, sizeof(state) - 1);
+
+        TScreenState before;
+        CaptureScreen(pRenderer, before);
+
+        // What SET-UP draws: its own modes on a cleared screen
+        std::string dialog = "\x1B[2J\x1B[H\x1B#6SET-UP A\r\n\x1B[5;10r\x1B[4h\x1B[7m";
+        for (unsigned i = 0; i < 24; ++i)
+        {
+            dialog += " TO EXIT PRESS \"SET-UP\" \r\n";
+        }
+        dialog += "\x1B[0m\x1B[?25l";
+
+        bool bResult = true;
+        const u32 first = pRenderer->TakeSnapshot();
+        if (first == 0 || pRenderer->TakeSnapshot() != 0)
+        {
+            printf("%-16s snapshot %u not taken or taken twice\n", "snapshot.check", first);
+            bResult = false;
+        }
+        pRenderer->Write(dialog.data(), dialog.size());
+        if (pRenderer->RestoreSnapshot(first + 1) || !pRenderer->RestoreSnapshot(first) ||
+            pRenderer->RestoreSnapshot(first))
+        {
+            printf("%-16s stale snapshot id accepted\n", "snapshot.check");
+            bResult = false;
+        }
+        // Restoring only marks the screen; the renderer task presents it
+        pRenderer->Update();
+
+        TScreenState after;
+        CaptureScreen(pRenderer, after);
+        const bool bSame = SameScreen(before, after);
+        printf("%-16s frame, cells and state %s\n", "snapshot.check", bSame ? "restored" : "DIFFER");
+        bResult = bResult && bSame;
+
+        const unsigned trips = g_Options.iterations * 50;
+        for (unsigned withDialog = 0; withDialog <= 1; ++withDialog)
+        {
+            const u64 startUs = CTimer::GetClockTicks64();
+            for (unsigned i = 0; i < trips; ++i)
+            {
+                const u32 snapshot = pRenderer->TakeSnapshot();
+                if (withDialog)
+                {
+                    pRenderer->Write(dialog.data(), dialog.size());
+                }
+                pRenderer->RestoreSnapshot(snapshot);
+                pRenderer->Update();
+            }
+            const u64 elapsedUs = CTimer::GetClockTicks64() - startUs;
+            printf("%-16s %10.2f us per round trip  (%u trips, %.3f s)\n",
+                   withDialog ? "snapshot.dialog" : "snapshot.trip", static_cast<double>(elapsedUs) / trips, trips,
+                   elapsedUs / 1000000.0);
+        }
+
+        // The former SaveScreenBuffer()/RestoreScreenBuffer() pair copied pixels and cells both ways
+        const size_t screenBytes = before.frame.size() + before.cells.size() * sizeof(CTCellBuffer::TCell);
+        std::vector<u8> live(screenBytes);
+        std::vector<u8> saved(screenBytes);
+        const u64 startUs = CTimer::GetClockTicks64();
+        for (unsigned i = 0; i < trips; ++i)
+        {
+            memcpy(saved.data(), live.data(), screenBytes);
+            live[i % screenBytes] ^= 1;
+            memcpy(live.data(), saved.data(), screenBytes);
+        }
+        const u64 elapsedUs = CTimer::GetClockTicks64() - startUs;
+        printf("%-16s %10.2f us per round trip  (%u trips, %zu bytes each way)\n", "snapshot.copy",
+               static_cast<double>(elapsedUs) / trips, trips, screenBytes);
+
+        CaptureScreen(pRenderer, after);
+        if (!SameScreen(before, after))
+        {
+            printf("%-16s screen differs after %u round trips\n", "snapshot.check", 2 * trips);
+            bResult = false;
+        }
+
+        return bResult;
+    }
+
+    bool WritePpm(const char *pPath)
+    {
+        CBcmFrameBuffer *pFrameBuffer = HostDisplay::GetFrameBuffer();
+        FILE *pFile = fopen(pPath, "wb");
+        if (pFile == nullptr)
+        {
+            LOGERR("Cannot open %s", pPath);
+            return false;
+        }
+
+        const unsigned width = pFrameBuffer->GetWidth();
+        const unsigned height = pFrameBuffer->GetHeight();
+        fprintf(pFile, "P6\n%u %u\n255\n", width, height);
+
+        const u8 *pRow = pFrameBuffer->GetBuffer();
+        for (unsigned y = 0; y < height; ++y, pRow += pFrameBuffer->GetPitch())
+        {
+            const u16 *pPixel = reinterpret_cast<const u16 *>(pRow);
+            for (unsigned x = 0; x < width; ++x)
+            {
+                const u16 color = pPixel[x];
+                const u8 r = (color >> 11) & 0x1F;
+                const u8 g = (color >> 5) & 0x3F;
+                const u8 b = color & 0x1F;
+                const u8 rgb[3] = {static_cast<u8>(r << 3 | r >> 2), static_cast<u8>(g << 2 | g >> 4),
+                                   static_cast<u8>(b << 3 | b >> 2)};
+                fwrite(rgb, 1, sizeof(rgb), pFile);
+            }
+        }
+
+        fclose(pFile);
+        return true;
+    }
+
+    void PrintUsage(const char *pProgram)
+    {
+        fprintf(stderr,
+                "Usage: %s [options] [CASE]\n"
+                "  CASE               benchmark to run: sixel (default), crt, text, mccp, print, prims,\n"
+                "                     logpane, blit, hud, scan, snapshot\n"
+                "  --iterations N     repetitions per case (default 20)\n"
+                "  --sd DIR           directory used as SD: root, holds VT100.txt (default .)\n"
+                "  --ppm FILE         write the final frame as P6 to FILE\n",
+                pProgram);
+    }
+
+    bool ParseOptions(int argc, char **argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                return false;
+            }
+            if (arg[0] != '-')
+            {
+                g_Options.benchCase = arg;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *pValue = argv[++i];
+            if (arg == "--iterations")
+            {
+                g_Options.iterations = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--sd")
+            {
+                g_Options.driveRoot = pValue;
+            }
+            else if (arg == "--ppm")
+            {
+                g_Options.ppmPath = pValue;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return g_Options.iterations != 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!ParseOptions(argc, argv))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    CLogger::Get()->SetLevel(LogWarning);
+    HostSetDriveRoot(g_Options.driveRoot.c_str());
+    CScheduler::Get()->Lock();
+
+    CTConfig *pConfig = CTConfig::Get();
+    if (!pConfig->Initialize())
+    {
+        LOGERR("Config init failed");
+        return 1;
+    }
+    pConfig->LoadFromFile();
+
+    if (!CTFontConverter::Get()->Initialize())
+    {
+        LOGERR("Font converter init failed");
+        return 1;
+    }
+
+    CTRenderer *pRenderer = CTRenderer::Get();
+    if (!pRenderer->Initialize())
+    {
+        LOGERR("Renderer init failed");
+        return 1;
+    }
+
+    // Measure the drawing paths, not the scroll animation
+    pRenderer->SetSmoothScrollEnabled(FALSE);
+
+    bool bResult = false;
+    if (g_Options.benchCase == "sixel")
+    {
+        bResult = RunSixel(pRenderer);
+    }
+    else if (g_Options.benchCase == "crt")
+    {
+        bResult = RunCrt(pRenderer);
+    }
+    else if (g_Options.benchCase == "text")
+    {
+        bResult = RunText(pRenderer);
+    }
+    else if (g_Options.benchCase == "mccp")
+    {
+        bResult = RunMccp();
+    }
+    else if (g_Options.benchCase == "print")
+    {
+        bResult = RunPrint(pRenderer);
+    }
+    else if (g_Options.benchCase == "logpane")
+    {
+        bResult = RunLogPane(pRenderer);
+    }
+    else if (g_Options.benchCase == "hud")
+    {
+        bResult = RunPerfHud(pRenderer);
+    }
+    else if (g_Options.benchCase == "blit")
+    {
+        bResult = RunBlit();
+    }
+    else if (g_Options.benchCase == "scan")
+    {
+        bResult = RunScan(pRenderer);
+    }
+    else if (g_Options.benchCase == "snapshot")
+    {
+        bResult = RunSnapshot(pRenderer);
+    }
+    else if (g_Options.benchCase == "prims")
+    {
+        // Same code and log output as render_bench=1 on the device
+        CLogger::Get()->SetLevel(LogNotice);
+        bResult = CTRenderBench::Run(pRenderer) ? true : false;
+        CLogger::Get()->SetLevel(LogWarning);
+    }
+    else
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!g_Options.ppmPath.empty() && !WritePpm(g_Options.ppmPath.c_str()))
+    {
+        bResult = false;
+    }
+
+    return bResult ? 0 : 1;
+}
@@ -0,0 +1,673 @@
+//------------------------------------------------------------------------------
+// Module:        VT100_HOST
+// Description:   Linux/macOS terminal driving the unmodified CTRenderer from a PTY
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+// 2026-10-18     R. Zuehlsdorff        Forward renderer reports to the PTY
+// 2026-10-18     R. Zuehlsdorff        Predictive echo with injected latency
+// 2026-10-18     R. Zuehlsdorff        Frames for direct_render, which bypasses SetArea()
+// 2026-10-18     R. Zuehlsdorff        Frames for blank lines filled without SetArea()
+// 2026-10-18     R. Zuehlsdorff        Frames for in-place presentation counted by the renderer
+//------------------------------------------------------------------------------
+
+/**
+ * @file VT100_HOST.cpp
+ * @brief Host executable for renderer development, profiling and debugging.
+ * @details Links the firmware sources TRenderer.cpp, TConfig.cpp,
+ * TFontConverter.cpp and VT100_FontConverter.cpp unchanged against the Circle
+ * shim in `shim/`. A shell (or `--command`) runs on a PTY; its output is fed to
+ * CTRenderer::Write() exactly as CKernel does for UART/TCP host data, and the
+ * keyboard (stdin) is forwarded to the PTY.
+ *
+ * The framebuffer can be observed as
+ * - a PPM (P6) stream (`--ppm FILE|-`), one frame per presented update, or
+ * - a POSIX shared-memory buffer (`--shm NAME`): THostShmHeader + raw pixels.
+ *
+ * Stage timings use tools/profiler (PROFILE_SCOPE/PROFILE_DUMP), the renderer
+ * keeps logging its own scroll statistics from CTRenderer::Run().
+ *
+ * `--resume` runs CTWarmResume against `--sd DIR/VT100.scr`: the saved screen is
+ * restored at start-up and changed rows are persisted while the PTY is idle.
+ *
+ * Terminal reports (DECRQCRA) are written back to the PTY, so conformance
+ * suites such as esctest can run against the host build.
+ *
+ * `--predict MODE` runs CTPredictiveEcho on the keystrokes sent to the PTY as
+ * CKernel does in TCP host mode; `--latency MS` holds PTY output back to
+ * emulate a slow WLAN link and `--type TEXT` injects keystrokes for unattended
+ * runs.
+ */
+
+#include <circle/logger.h>
+#include <circle/sched/scheduler.h>
+#include <circle/timer.h>
+#include <fatfs/ff.h>
+
+#include "TConfig.h"
+#include "TFontConverter.h"
+#include "TRenderer.h"
+#include "TPredictiveEcho.h"
+#include "TWarmResume.h"
+#include "host_display.h"
+#include "profiler.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <util.h>
+#else
+#include <pty.h>
+#endif
+
+LOGMODULE("host");
+
+/// Layout of the --shm buffer; pixels (pitch * height bytes) follow directly.
+struct THostShmHeader
+{
+    char magic[8];              // "VT100FB"
+    u32 width;
+    u32 height;
+    u32 depth;                  // bits per pixel (16 = RGB565)
+    u32 pitch;                  // bytes per row
+    volatile u64 frame;         // incremented after every presented update
+};
+
+namespace
+{
+    const unsigned ReadChunkSize = 4096;
+    const unsigned PollIntervalMs = 10;
+    const unsigned WarmResumeTickMs = 50;     // CKernel heartbeat period
+    const unsigned TypeStartDelayMs = 500;
+    const unsigned TypeIntervalMs = 150;
+
+    struct TOptions
+    {
+        unsigned width = 1024;
+        unsigned height = 768;
+        std::string driveRoot = ".";
+        std::string command;
+        std::string ppmPath;
+        std::string shmName;
+        unsigned fps = 10;
+        double duration = 0.0;
+        unsigned profileIntervalS = 10;
+        bool verbose = false;
+        bool resume = false;
+        unsigned predictMode = CTPredictiveEcho::ModeOff;
+        unsigned latencyMs = 0;
+        std::string typeText;
+    };
+
+    /// PTY output held back by --latency.
+    struct TDelayedChunk
+    {
+        u64 dueUs;
+        std::string data;
+    };
+
+    TOptions g_Options;
+    THostShmHeader *g_pShmHeader = nullptr;
+    size_t g_ShmSize = 0;
+    FILE *g_pPpmFile = nullptr;
+    bool g_bDamaged = false;
+    struct termios g_SavedStdin;
+    bool g_bStdinRaw = false;
+    volatile sig_atomic_t g_bStop = 0;
+    int g_MasterFd = -1;
+    CTPredictiveEcho *g_pPredictiveEcho = nullptr;
+
+    void HandleStop(int)
+    {
+        g_bStop = 1;
+    }
+
+    void RestoreStdin(void)
+    {
+        if (g_bStdinRaw)
+        {
+            tcsetattr(STDIN_FILENO, TCSANOW, &g_SavedStdin);
+            g_bStdinRaw = false;
+        }
+    }
+
+    void OnRendererReply(unsigned nConsole, const char *pData, size_t nLength)
+    {
+        (void)nConsole;     // single PTY, every console answers the same host
+        if (g_MasterFd >= 0 && write(g_MasterFd, pData, nLength) < 0)
+        {
+            LOGWARN("Report to PTY failed: %s", strerror(errno));
+        }
+    }
+
+    /// Send keystrokes to the PTY and let the predictor see them key by key.
+    bool SendKeys(const char *pData, size_t nLength)
+    {
+        if (write(g_MasterFd, pData, nLength) < 0)
+        {
+            return false;
+        }
+
+        if (g_pPredictiveEcho != nullptr)
+        {
+            size_t i = 0;
+            while (i < nLength)
+            {
+                size_t keyLength = 1;
+                if (pData[i] == '\x1B' && i + 2 < nLength && (pData[i + 1] == '[' || pData[i + 1] == 'O'))
+                {
+                    keyLength = 3;
+                }
+                g_pPredictiveEcho->OnHostInput(pData + i, keyLength);
+                i += keyLength;
+            }
+        }
+        return true;
+    }
+
+    /// Feed host output to the renderer the way CKernel::HandleWlanHostRx() does.
+    void RenderHostOutput(CTRenderer *pRenderer, const char *pData, size_t nLength)
+    {
+        if (g_pPredictiveEcho != nullptr)
+        {
+            g_pPredictiveEcho->BeginHostOutput();
+        }
+
+        {
+            PROFILE_SCOPE("renderer.write");
+            pRenderer->Write(pData, nLength);
+        }
+
+        if (g_pPredictiveEcho != nullptr)
+        {
+            g_pPredictiveEcho->EndHostOutput();
+        }
+    }
+
+    void OnDamage(const CDisplay::TArea &)
+    {
+        g_bDamaged = true;
+    }
+
+    u8 *ProvideShmBuffer(size_t nSize, unsigned nWidth, unsigned nHeight, unsigned nDepth)
+    {
+        int fd = shm_open(g_Options.shmName.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0)
+        {
+            LOGERR("shm_open %s failed: %s", g_Options.shmName.c_str(), strerror(errno));
+            return nullptr;
+        }
+
+        g_ShmSize = sizeof(THostShmHeader) + nSize;
+        if (ftruncate(fd, static_cast<off_t>(g_ShmSize)) != 0)
+        {
+            LOGERR("ftruncate %s failed: %s", g_Options.shmName.c_str(), strerror(errno));
+            close(fd);
+            return nullptr;
+        }
+
+        void *pMemory = mmap(nullptr, g_ShmSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (pMemory == MAP_FAILED)
+        {
+            LOGERR("mmap %s failed: %s", g_Options.shmName.c_str(), strerror(errno));
+            return nullptr;
+        }
+
+        g_pShmHeader = static_cast<THostShmHeader *>(pMemory);
+        memcpy(g_pShmHeader->magic, "VT100FB", 8);
+        g_pShmHeader->width = nWidth;
+        g_pShmHeader->height = nHeight;
+        g_pShmHeader->depth = nDepth;
+        g_pShmHeader->pitch = nWidth * nDepth / 8;
+        g_pShmHeader->frame = 0;
+
+        LOGNOTE("Framebuffer shared as /dev/shm%s (%ux%u, %u bpp)", g_Options.shmName.c_str(), nWidth, nHeight, nDepth);
+        return reinterpret_cast<u8 *>(g_pShmHeader + 1);
+    }
+
+    void WritePpmFrame(void)
+    {
+        CBcmFrameBuffer *pFrameBuffer = HostDisplay::GetFrameBuffer();
+        if (g_pPpmFile == nullptr || pFrameBuffer == nullptr)
+        {
+            return;
+        }
+
+        PROFILE_SCOPE("host.ppm_frame");
+
+        const unsigned width = pFrameBuffer->GetWidth();
+        const unsigned height = pFrameBuffer->GetHeight();
+        static std::vector<u8> rgb;
+        rgb.resize(static_cast<size_t>(width) * height * 3);
+
+        const u8 *pRow = pFrameBuffer->GetBuffer();
+        u8 *pOut = rgb.data();
+        for (unsigned y = 0; y < height; ++y, pRow += pFrameBuffer->GetPitch())
+        {
+            const u16 *pPixel = reinterpret_cast<const u16 *>(pRow);
+            for (unsigned x = 0; x < width; ++x)
+            {
+                const u16 color = pPixel[x];
+                const u8 r = (color >> 11) & 0x1F;
+                const u8 g = (color >> 5) & 0x3F;
+                const u8 b = color & 0x1F;
+                *pOut++ = static_cast<u8>(r << 3 | r >> 2);
+                *pOut++ = static_cast<u8>(g << 2 | g >> 4);
+                *pOut++ = static_cast<u8>(b << 3 | b >> 2);
+            }
+        }
+
+        fprintf(g_pPpmFile, "P6\n%u %u\n255\n", width, height);
+        fwrite(rgb.data(), 1, rgb.size(), g_pPpmFile);
+        fflush(g_pPpmFile);
+    }
+
+    void PresentFrame(void)
+    {
+        if (g_pShmHeader != nullptr)
+        {
+            __sync_synchronize();
+            ++g_pShmHeader->frame;
+        }
+        WritePpmFrame();
+        g_bDamaged = false;
+    }
+
+    pid_t SpawnShell(int &masterFd, unsigned nColumns, unsigned nRows)
+    {
+        struct winsize size;
+        memset(&size, 0, sizeof(size));
+        size.ws_col = static_cast<unsigned short>(nColumns);
+        size.ws_row = static_cast<unsigned short>(nRows);
+
+        pid_t pid = forkpty(&masterFd, nullptr, nullptr, &size);
+        if (pid != 0)
+        {
+            return pid;
+        }
+
+        setenv("TERM", "vt100", 1);
+        if (!g_Options.command.empty())
+        {
+            execl("/bin/sh", "sh", "-c", g_Options.command.c_str(), static_cast<char *>(nullptr));
+        }
+        else
+        {
+            const char *pShell = getenv("SHELL");
+            if (pShell == nullptr || *pShell == '\0')
+            {
+                pShell = "/bin/sh";
+            }
+            execl(pShell, pShell, "-i", static_cast<char *>(nullptr));
+        }
+        _exit(127);
+    }
+
+    void PrintUsage(const char *pProgram)
+    {
+        fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  --size WxH         framebuffer size (default 1024x768)\n"
+                "  --sd DIR           directory used as SD: root, holds VT100.txt (default .)\n"
+                "  --command CMD      run CMD via /bin/sh -c instead of an interactive $SHELL\n"
+                "  --ppm FILE|-       write P6 frames to FILE or stdout\n"
+                "  --fps N            max PPM/shm frame rate (default 10)\n"
+                "  --shm NAME         expose framebuffer as POSIX shm NAME (e.g. /vt100fb)\n"
+                "  --duration S       exit after S seconds (default: when the shell exits)\n"
+                "  --profile S        stage timing dump interval in seconds, 0 = off (default 10)\n"
+                "  --resume           restore/persist the screen via SD:/VT100.scr\n"
+                "  --predict MODE     predictive echo for typed keys: 0=off, 1=adaptive, 2=always\n"
+                "  --latency MS       delay PTY output by MS milliseconds (emulated WLAN RTT)\n"
+                "  --type TEXT        type TEXT into the PTY, one key every 150 ms\n"
+                "  --verbose          include debug log output\n",
+                pProgram);
+    }
+
+    bool ParseOptions(int argc, char **argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "--verbose")
+            {
+                g_Options.verbose = true;
+                continue;
+            }
+            if (arg == "--resume")
+            {
+                g_Options.resume = true;
+                continue;
+            }
+            if (arg == "-h" || arg == "--help" || i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *pValue = argv[++i];
+            if (arg == "--size")
+            {
+                if (sscanf(pValue, "%ux%u", &g_Options.width, &g_Options.height) != 2)
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--sd")
+            {
+                g_Options.driveRoot = pValue;
+            }
+            else if (arg == "--command")
+            {
+                g_Options.command = pValue;
+            }
+            else if (arg == "--ppm")
+            {
+                g_Options.ppmPath = pValue;
+            }
+            else if (arg == "--fps")
+            {
+                g_Options.fps = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--shm")
+            {
+                g_Options.shmName = pValue;
+            }
+            else if (arg == "--duration")
+            {
+                g_Options.duration = strtod(pValue, nullptr);
+            }
+            else if (arg == "--profile")
+            {
+                g_Options.profileIntervalS = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--predict")
+            {
+                g_Options.predictMode = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--latency")
+            {
+                g_Options.latencyMs = static_cast<unsigned>(strtoul(pValue, nullptr, 10));
+            }
+            else if (arg == "--type")
+            {
+                g_Options.typeText = pValue;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!ParseOptions(argc, argv))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    CLogger::Get()->SetLevel(g_Options.verbose ? LogDebug : LogNotice);
+    signal(SIGINT, HandleStop);
+    signal(SIGTERM, HandleStop);
+    signal(SIGPIPE, SIG_IGN);
+
+    HostSetDriveRoot(g_Options.driveRoot.c_str());
+    HostDisplay::SetGeometry(g_Options.width, g_Options.height);
+    HostDisplay::SetDamageHook(OnDamage);
+    if (!g_Options.shmName.empty())
+    {
+        HostDisplay::SetBufferProvider(ProvideShmBuffer);
+    }
+
+    if (!g_Options.ppmPath.empty())
+    {
+        g_pPpmFile = g_Options.ppmPath == "-" ? stdout : fopen(g_Options.ppmPath.c_str(), "wb");
+        if (g_pPpmFile == nullptr)
+        {
+            LOGERR("Cannot open %s: %s", g_Options.ppmPath.c_str(), strerror(errno));
+            return 1;
+        }
+    }
+
+    // The main loop acts as the kernel task: it owns the scheduler lock except while polling
+    CScheduler::Get()->Lock();
+
+    // Same bring-up order as CKernel::Initialize()
+    CTConfig *pConfig = CTConfig::Get();
+    if (!pConfig->Initialize())
+    {
+        LOGERR("Config init failed");
+        return 1;
+    }
+    if (!pConfig->LoadFromFile())
+    {
+        LOGWARN("No VT100.txt in %s, using defaults", g_Options.driveRoot.c_str());
+    }
+
+    if (!CTFontConverter::Get()->Initialize())
+    {
+        LOGERR("Font converter init failed");
+        return 1;
+    }
+
+    CTRenderer *pRenderer = CTRenderer::Get();
+    if (!pRenderer->Initialize())
+    {
+        LOGERR("Renderer init failed");
+        return 1;
+    }
+    LOGNOTE("Renderer %ux%u px, %ux%u cells", pRenderer->GetWidth(), pRenderer->GetHeight(),
+            pRenderer->GetColumns(), pRenderer->GetRows());
+
+    CTWarmResume *pWarmResume = nullptr;
+    if (g_Options.resume)
+    {
+        pWarmResume = CTWarmResume::Get();
+        if (pWarmResume->Initialize(pRenderer, pConfig))
+        {
+            pWarmResume->Restore();
+        }
+    }
+
+    int masterFd = -1;
+    pid_t child = SpawnShell(masterFd, pRenderer->GetColumns(), pRenderer->GetRows());
+    if (child < 0)
+    {
+        LOGERR("forkpty failed: %s", strerror(errno));
+        return 1;
+    }
+    g_MasterFd = masterFd;
+    pRenderer->RegisterReplyHandler(&OnRendererReply);
+
+    if (g_Options.predictMode != CTPredictiveEcho::ModeOff)
+    {
+        g_pPredictiveEcho = CTPredictiveEcho::Get();
+        g_pPredictiveEcho->Initialize(pRenderer, g_Options.predictMode);
+    }
+
+    const bool bForwardStdin = isatty(STDIN_FILENO) && g_pPpmFile != stdout;
+    if (bForwardStdin && tcgetattr(STDIN_FILENO, &g_SavedStdin) == 0)
+    {
+        struct termios raw = g_SavedStdin;
+        cfmakeraw(&raw);
+        tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        g_bStdinRaw = true;
+        atexit(RestoreStdin);
+    }
+
+    const u64 startUs = CTimer::GetClockTicks64();
+    const u64 frameIntervalUs = g_Options.fps != 0 ? 1000000ULL / g_Options.fps : 0;
+    u64 lastFrameUs = 0;
+    unsigned lastInPlaceCount = 0;
+    u64 lastResumeTickUs = 0;
+    size_t typedKeys = 0;
+    std::deque<TDelayedChunk> delayed;
+    u64 bytesRendered = 0;
+    char buffer[ReadChunkSize];
+
+    while (!g_bStop)
+    {
+        struct pollfd fds[2];
+        fds[0] = {masterFd, POLLIN, 0};
+        fds[1] = {STDIN_FILENO, POLLIN, 0};
+
+        // Let renderer/config tasks run (cursor blink, Update(), stats) while idle
+        CScheduler::Get()->Unlock();
+        int ready = poll(fds, bForwardStdin ? 2 : 1, PollIntervalMs);
+        CScheduler::Get()->Lock();
+
+        if (ready < 0 && errno != EINTR)
+        {
+            break;
+        }
+
+        if (ready > 0 && (fds[0].revents & (POLLIN | POLLHUP)))
+        {
+            ssize_t nRead;
+            {
+                PROFILE_SCOPE("host.pty_read");
+                nRead = read(masterFd, buffer, sizeof(buffer));
+            }
+            if (nRead <= 0)
+            {
+                break;
+            }
+
+            if (g_Options.latencyMs != 0)
+            {
+                const u64 dueUs = CTimer::GetClockTicks64() + g_Options.latencyMs * 1000ULL;
+                delayed.push_back({dueUs, std::string(buffer, static_cast<size_t>(nRead))});
+            }
+            else
+            {
+                RenderHostOutput(pRenderer, buffer, static_cast<size_t>(nRead));
+            }
+            bytesRendered += static_cast<u64>(nRead);
+        }
+
+        if (bForwardStdin && ready > 0 && (fds[1].revents & POLLIN))
+        {
+            ssize_t nRead = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (nRead > 0 && !SendKeys(buffer, static_cast<size_t>(nRead)))
+            {
+                break;
+            }
+        }
+
+        const u64 nowUs = CTimer::GetClockTicks64();
+        while (!delayed.empty() && delayed.front().dueUs <= nowUs)
+        {
+            RenderHostOutput(pRenderer, delayed.front().data.data(), delayed.front().data.size());
+            delayed.pop_front();
+        }
+
+        if (typedKeys < g_Options.typeText.size()
+            && nowUs - startUs >= (TypeStartDelayMs + typedKeys * TypeIntervalMs) * 1000ULL)
+        {
+            if (!SendKeys(&g_Options.typeText[typedKeys], 1))
+            {
+                break;
+            }
+            ++typedKeys;
+        }
+        // direct_render draws into the buffer without SetArea(), and the shadow buffer
+        // is presented in place, so no damage is reported for either
+        const unsigned inPlaceCount = pRenderer->GetInPlaceCount();
+        if (pRenderer->IsDirectRender() || inPlaceCount != lastInPlaceCount)
+        {
+            g_bDamaged = true;
+            lastInPlaceCount = inPlaceCount;
+        }
+        if (g_bDamaged && nowUs - lastFrameUs >= frameIntervalUs)
+        {
+            PresentFrame();
+            lastFrameUs = nowUs;
+        }
+
+        if (nowUs - lastResumeTickUs >= WarmResumeTickMs * 1000ULL)
+        {
+            if (pWarmResume != nullptr)
+            {
+                PROFILE_SCOPE("host.warm_resume");
+                pWarmResume->Tick();
+            }
+            if (g_pPredictiveEcho != nullptr)
+            {
+                g_pPredictiveEcho->Tick();
+            }
+            lastResumeTickUs = nowUs;
+        }
+
+        if (g_Options.profileIntervalS != 0)
+        {
+            PROFILE_DUMP(g_Options.profileIntervalS * 1000000ULL);
+        }
+
+        if (g_Options.duration > 0.0 && nowUs - startUs >= static_cast<u64>(g_Options.duration * 1e6))
+        {
+            break;
+        }
+    }
+
+    for (const TDelayedChunk &chunk : delayed)
+    {
+        RenderHostOutput(pRenderer, chunk.data.data(), chunk.data.size());
+    }
+
+    if (g_bDamaged)
+    {
+        PresentFrame();
+    }
+
+    RestoreStdin();
+    if (g_pPredictiveEcho != nullptr)
+    {
+        LOGNOTE("Predictive echo: %u confirmed, %u rollbacks, smoothed RTT %u ms",
+                g_pPredictiveEcho->GetConfirmedCount(), g_pPredictiveEcho->GetMispredictedCount(),
+                g_pPredictiveEcho->GetSmoothedRttMs());
+    }
+    const double elapsedS = static_cast<double>(CTimer::GetClockTicks64() - startUs) / 1e6;
+    LOGNOTE("Rendered %llu bytes in %.2f s (%.0f B/s)", static_cast<unsigned long long>(bytesRendered),
+            elapsedS, elapsedS > 0.0 ? static_cast<double>(bytesRendered) / elapsedS : 0.0);
+    if (g_Options.profileIntervalS != 0)
+    {
+        CProfiler::Get().Dump();
+    }
+
+    kill(child, SIGHUP);
+    waitpid(child, nullptr, 0);
+    if (g_pPpmFile != nullptr && g_pPpmFile != stdout)
+    {
+        fclose(g_pPpmFile);
+    }
+    if (g_pShmHeader != nullptr)
+    {
+        munmap(g_pShmHeader, g_ShmSize);
+        shm_unlink(g_Options.shmName.c_str());
+    }
+
+    // Task threads never return; leave without running static destructors under them
+    fflush(nullptr);
+    _exit(0);
+}
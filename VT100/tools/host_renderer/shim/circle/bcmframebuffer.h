@@ -0,0 +1,29 @@
+// Host shim for <circle/bcmframebuffer.h>; pixels live in host memory (heap or shm)
+#pragma once
+
+#include <circle/display.h>
+
+class CBcmFrameBuffer : public CDisplay
+{
+public:
+    CBcmFrameBuffer(unsigned nWidth, unsigned nHeight, unsigned nDepth,
+                    unsigned nVirtualWidth = 0, unsigned nVirtualHeight = 0,
+                    unsigned nDisplay = 0);
+    ~CBcmFrameBuffer(void);
+
+    boolean Initialize(void);
+
+    unsigned GetWidth(void) const override { return m_nWidth; }
+    unsigned GetHeight(void) const override { return m_nHeight; }
+    unsigned GetPitch(void) const { return m_nPitch; }
+    u8 *GetBuffer(void) const { return m_pBuffer; }
+
+    void SetPixel(unsigned nPosX, unsigned nPosY, TRawColor nColor) override;
+    void SetArea(const TArea &rArea, const void *pPixels) override;
+
+private:
+    unsigned m_nWidth;
+    unsigned m_nHeight;
+    unsigned m_nPitch;
+    u8 *m_pBuffer;
+};
@@ -0,0 +1,48 @@
+// Host shim for <circle/chargenerator.h>; same bit layout as Circle (MSB = left pixel)
+#pragma once
+
+#include <circle/font.h>
+#include <circle/types.h>
+
+class CCharGenerator
+{
+public:
+    typedef u32 TPixelLine;
+
+    enum TFontFlags
+    {
+        FontFlagsNone = 0,
+        FontFlagsDoubleWidth = 1 << 0,
+        FontFlagsDoubleHeight = 1 << 1,
+        FontFlagsDoubleBoth = FontFlagsDoubleWidth | FontFlagsDoubleHeight
+    };
+
+    CCharGenerator(const TFont &rFont, TFontFlags Flags = FontFlagsNone);
+
+    unsigned GetCharWidth(void) const { return m_nCharWidth; }
+    unsigned GetCharHeight(void) const { return m_nCharHeight; }
+    unsigned GetUnderline(void) const { return m_nUnderline; }
+
+    TPixelLine GetPixelLine(char chAscii, unsigned nPosY) const;
+    boolean GetPixel(unsigned nPosX, TPixelLine Line) const
+    {
+        if (m_bDoubleWidth)
+        {
+            nPosX /= 2;
+        }
+        return nPosX < m_rFont.width && (Line & (m_nFirstBit >> nPosX)) != 0;
+    }
+    boolean GetPixel(char chAscii, unsigned nPosX, unsigned nPosY) const
+    {
+        return GetPixel(nPosX, GetPixelLine(chAscii, nPosY));
+    }
+
+private:
+    const TFont &m_rFont;
+    boolean m_bDoubleWidth;
+    boolean m_bDoubleHeight;
+    unsigned m_nCharWidth;
+    unsigned m_nCharHeight;
+    unsigned m_nUnderline;
+    TPixelLine m_nFirstBit;
+};
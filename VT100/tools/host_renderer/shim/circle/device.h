@@ -0,0 +1,14 @@
+// Host shim for <circle/device.h>
+#pragma once
+
+#include <circle/types.h>
+
+class CDevice
+{
+public:
+    CDevice(void) {}
+    virtual ~CDevice(void) {}
+
+    virtual int Read(void *pBuffer, size_t nCount) { (void)pBuffer; (void)nCount; return -1; }
+    virtual int Write(const void *pBuffer, size_t nCount) { (void)pBuffer; (void)nCount; return -1; }
+};
@@ -0,0 +1,17 @@
+// Host shim for <circle/devicenameservice.h>
+#pragma once
+
+#include <circle/device.h>
+
+class CDeviceNameService
+{
+public:
+    static CDeviceNameService *Get(void);
+
+    void AddDevice(const char *pPrefix, unsigned nIndex, CDevice *pDevice, boolean bBlockDevice);
+    void RemoveDevice(const char *pPrefix, unsigned nIndex, boolean bBlockDevice);
+    CDevice *GetDevice(const char *pPrefix, unsigned nIndex, boolean bBlockDevice);
+
+private:
+    CDevice *m_pDevice = nullptr;
+};
@@ -0,0 +1,79 @@
+// Host shim for <circle/display.h>
+#pragma once
+
+#include <circle/device.h>
+#include <circle/types.h>
+
+#define DISPLAY_COLOR(red, green, blue) \
+    static_cast<CDisplay::TColor>(((u32)(red) & 0xFF) << 16 | ((u32)(green) & 0xFF) << 8 | ((u32)(blue) & 0xFF))
+
+class CDisplay : public CDevice
+{
+public:
+    enum TColor : u32
+    {
+        Black = 0x000000,
+        Red = 0xAA0000,
+        Green = 0x00AA00,
+        Yellow = 0xAA5500,
+        Blue = 0x0000AA,
+        Magenta = 0xAA00AA,
+        Cyan = 0x00AAAA,
+        White = 0xAAAAAA,
+        BrightBlack = 0x555555,
+        BrightRed = 0xFF5555,
+        BrightGreen = 0x55FF55,
+        BrightYellow = 0xFFFF55,
+        BrightBlue = 0x5555FF,
+        BrightMagenta = 0xFF55FF,
+        BrightCyan = 0x55FFFF,
+        BrightWhite = 0xFFFFFF,
+        NormalColor = BrightWhite,
+        HighColor = BrightRed,
+        HalfColor = Blue
+    };
+
+    typedef u32 TRawColor;
+
+    struct TArea
+    {
+        unsigned x1;
+        unsigned x2;
+        unsigned y1;
+        unsigned y2;
+    };
+
+    CDisplay(unsigned nDepth) : m_nDepth(nDepth) {}
+
+    virtual unsigned GetWidth(void) const = 0;
+    virtual unsigned GetHeight(void) const = 0;
+    unsigned GetDepth(void) const { return m_nDepth; }
+
+    virtual void SetPixel(unsigned nPosX, unsigned nPosY, TRawColor nColor) = 0;
+    virtual void SetArea(const TArea &rArea, const void *pPixels) = 0;
+
+    /// RGB888 logical color to raw RGB565 (16 bpp) or XRGB8888 (32 bpp)
+    TRawColor GetColor(TColor Color) const
+    {
+        if (m_nDepth == 16)
+        {
+            return ((Color >> 8) & 0xF800) | ((Color >> 5) & 0x07E0) | ((Color >> 3) & 0x001F);
+        }
+        return Color;
+    }
+
+    TColor GetColor(TRawColor nColor) const
+    {
+        if (m_nDepth == 16)
+        {
+            u32 r = (nColor >> 11) & 0x1F;
+            u32 g = (nColor >> 5) & 0x3F;
+            u32 b = nColor & 0x1F;
+            return DISPLAY_COLOR(r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2);
+        }
+        return static_cast<TColor>(nColor & 0xFFFFFF);
+    }
+
+private:
+    unsigned m_nDepth;
+};
@@ -0,0 +1,14 @@
+// Host shim for <circle/font.h>
+#pragma once
+
+#include <circle/types.h>
+
+struct TFont
+{
+    unsigned width;
+    unsigned height;
+    unsigned extra_height;
+    unsigned first_char;
+    unsigned last_char;
+    const void *data;           // u8 for width <= 8, u16 for width <= 16
+};
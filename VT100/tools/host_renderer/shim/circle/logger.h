@@ -0,0 +1,34 @@
+// Host shim for <circle/logger.h>; messages go to stderr
+#pragma once
+
+#include <circle/types.h>
+
+enum TLogSeverity
+{
+    LogPanic,
+    LogError,
+    LogWarning,
+    LogNotice,
+    LogDebug
+};
+
+class CLogger
+{
+public:
+    static CLogger *Get(void);
+
+    void SetLevel(TLogSeverity Severity) { m_Level = Severity; }
+    void Write(const char *pSource, TLogSeverity Severity, const char *pMessage, ...)
+        __attribute__((format(printf, 4, 5)));
+
+private:
+    TLogSeverity m_Level = LogNotice;
+};
+
+#define LOGMODULE(name) static const char From[] = name
+#define LOGPANIC(...) CLogger::Get()->Write(From, LogPanic, __VA_ARGS__)
+#define LOGERR(...) CLogger::Get()->Write(From, LogError, __VA_ARGS__)
+#define LOGWARN(...) CLogger::Get()->Write(From, LogWarning, __VA_ARGS__)
+#define LOGNOTE(...) CLogger::Get()->Write(From, LogNotice, __VA_ARGS__)
+#define LOGDBG(...) CLogger::Get()->Write(From, LogDebug, __VA_ARGS__)
+#define LOGDEBUG(...) CLogger::Get()->Write(From, LogDebug, __VA_ARGS__)
@@ -0,0 +1,20 @@
+// Host shim for <circle/sched/scheduler.h>
+#pragma once
+
+#include <circle/sched/task.h>
+#include <circle/types.h>
+
+class CScheduler
+{
+public:
+    static CScheduler *Get(void);
+
+    void Yield(void);
+    void Sleep(unsigned nSeconds) { MsSleep(nSeconds * 1000); }
+    void MsSleep(unsigned nMilliSeconds);
+    void usSleep(unsigned nMicroSeconds);
+
+    /// Host only: the main thread holds the cooperative lock like a task does
+    void Lock(void);
+    void Unlock(void);
+};
@@ -0,0 +1,35 @@
+// Host shim for <circle/sched/task.h>
+// Each task runs on its own thread, but only one thread holds the cooperative
+// scheduler lock at a time, so Circle's run-until-Yield semantics are kept.
+#pragma once
+
+#include <circle/types.h>
+#include <string>
+#include <thread>
+
+#define TASK_STACK_SIZE 0x8000
+
+class CTask
+{
+public:
+    CTask(unsigned nStackSize = TASK_STACK_SIZE, boolean bCreateSuspended = FALSE);
+    virtual ~CTask(void);
+
+    virtual void Run(void) = 0;
+
+    void Start(void) { Resume(); }
+    void Suspend(void) { m_bSuspended = TRUE; }
+    void Resume(void);
+    boolean IsSuspended(void) const { return m_bSuspended; }
+
+    void SetName(const char *pName) { m_Name = pName; }
+    const char *GetName(void) const { return m_Name.c_str(); }
+
+private:
+    void ThreadMain(void);
+
+    volatile boolean m_bSuspended;
+    boolean m_bRunning;
+    std::string m_Name;
+    std::thread m_Thread;
+};
@@ -0,0 +1,19 @@
+// Host shim for <circle/spinlock.h>
+// On the single-core Pi Zero build Circle compiles CSpinLock to nothing; the host
+// scheduler lock (see sched/task.h) already serializes all tasks, so do the same.
+#pragma once
+
+#include <circle/types.h>
+
+#define TASK_LEVEL 0
+#define IRQ_LEVEL 1
+#define FIQ_LEVEL 2
+
+class CSpinLock
+{
+public:
+    CSpinLock(unsigned nTargetLevel = IRQ_LEVEL) { (void)nTargetLevel; }
+
+    void Acquire(void) {}
+    void Release(void) {}
+};
@@ -0,0 +1,33 @@
+// Host shim for <circle/string.h>
+#pragma once
+
+#include <circle/types.h>
+#include <stdarg.h>
+#include <string>
+
+class CString
+{
+public:
+    CString(void) {}
+    CString(const char *pString) : m_String(pString != nullptr ? pString : "") {}
+
+    operator const char *(void) const { return m_String.c_str(); }
+    const char *c_str(void) const { return m_String.c_str(); }
+    size_t GetLength(void) const { return m_String.size(); }
+
+    CString &operator=(const char *pString)
+    {
+        m_String = pString != nullptr ? pString : "";
+        return *this;
+    }
+    void Append(const char *pString) { m_String += pString; }
+    int Compare(const char *pString) const { return m_String.compare(pString); }
+    CString &operator+=(const char *pString) { m_String += pString; return *this; }
+    CString &operator+=(char chChar) { m_String += chChar; return *this; }
+
+    void Format(const char *pFormat, ...) __attribute__((format(printf, 2, 3)));
+    void FormatV(const char *pFormat, va_list Args);
+
+private:
+    std::string m_String;
+};
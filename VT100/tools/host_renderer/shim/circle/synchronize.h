@@ -0,0 +1,8 @@
+// Host shim for <circle/synchronize.h>; cooperative scheduling makes these no-ops
+#pragma once
+
+#define EnterCritical(...) do { } while (0)
+#define LeaveCritical() do { } while (0)
+#define DataMemBarrier() __sync_synchronize()
+#define DataSyncBarrier() __sync_synchronize()
+#define CleanAndInvalidateDataCacheRange(addr, len) do { (void)(addr); (void)(len); } while (0)
@@ -0,0 +1,4 @@
+// Host shim for <circle/sysconfig.h>
+#pragma once
+
+#define HZ 100
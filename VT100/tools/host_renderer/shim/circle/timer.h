@@ -0,0 +1,20 @@
+// Host shim for <circle/timer.h>; ticks derive from CLOCK_MONOTONIC
+#pragma once
+
+#include <circle/sysconfig.h>
+#include <circle/types.h>
+
+#define MSEC2HZ(msec) ((msec) * HZ / 1000)
+
+class CTimer
+{
+public:
+    static CTimer *Get(void);
+
+    unsigned GetTicks(void) const;
+    static unsigned GetClockTicks(void);
+    static u64 GetClockTicks64(void);
+
+    static void SimpleMsDelay(unsigned nMilliSeconds);
+    static void SimpleusDelay(unsigned nMicroSeconds);
+};
@@ -0,0 +1,20 @@
+// Host shim for <circle/types.h> (see tools/host_renderer/README section in tools/README.md)
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef uintptr_t uintptr;
+
+typedef bool boolean;
+#define FALSE false
+#define TRUE true
@@ -0,0 +1,6 @@
+// Host shim for <circle/util.h>
+#pragma once
+
+#include <circle/types.h>
+#include <stdlib.h>
+#include <string.h>
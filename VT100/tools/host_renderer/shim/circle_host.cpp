@@ -0,0 +1,565 @@
+//------------------------------------------------------------------------------
+// Module:        circle_host
+// Description:   Host (Linux/macOS) implementation of the Circle subset used by
+//                CTRenderer, CTConfig and the VT100 font converter
+// Author:        R. Zuehlsdorff, ralf.zuehlsdorff@t-online.de
+// Created:       2026-10-18
+// License:       MIT License (https://opensource.org/license/mit/)
+//------------------------------------------------------------------------------
+// Change Log:
+// 2026-10-18     R. Zuehlsdorff        Initial creation
+//------------------------------------------------------------------------------
+
+#include <circle/bcmframebuffer.h>
+#include <circle/chargenerator.h>
+#include <circle/devicenameservice.h>
+#include <circle/logger.h>
+#include <circle/sched/scheduler.h>
+#include <circle/string.h>
+#include <circle/timer.h>
+#include <fatfs/ff.h>
+
+#include "hal.h"
+#include "host_display.h"
+
+#include <chrono>
+#include <mutex>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    // Cooperative scheduler lock: exactly one task (or the main loop) runs at a time
+    std::mutex g_SchedulerLock;
+
+    const std::chrono::steady_clock::time_point g_StartTime = std::chrono::steady_clock::now();
+
+    u64 ElapsedMicros(void)
+    {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now() - g_StartTime)
+                                    .count());
+    }
+
+    unsigned g_DisplayWidth = 1024;
+    unsigned g_DisplayHeight = 768;
+    u8 *(*g_pBufferProvider)(size_t, unsigned, unsigned, unsigned) = nullptr;
+    void (*g_pDamageHook)(const CDisplay::TArea &) = nullptr;
+    CBcmFrameBuffer *g_pFrameBuffer = nullptr;
+
+    std::string g_DriveRoot = ".";
+}
+
+//------------------------------------------------------------------------------
+// CLogger
+//------------------------------------------------------------------------------
+
+CLogger *CLogger::Get(void)
+{
+    static CLogger s_Logger;
+    return &s_Logger;
+}
+
+void CLogger::Write(const char *pSource, TLogSeverity Severity, const char *pMessage, ...)
+{
+    if (Severity > m_Level)
+    {
+        return;
+    }
+
+    static const char *const Prefix[] = {"!", "E", "W", "", "D"};
+    const u64 us = ElapsedMicros();
+
+    char message[512];
+    va_list args;
+    va_start(args, pMessage);
+    vsnprintf(message, sizeof(message), pMessage, args);
+    va_end(args);
+
+    fprintf(stderr, "%02u:%02u:%02u.%02u %s%s%s: %s\n",
+            static_cast<unsigned>(us / 3600000000ULL),
+            static_cast<unsigned>(us / 60000000ULL % 60),
+            static_cast<unsigned>(us / 1000000ULL % 60),
+            static_cast<unsigned>(us / 10000ULL % 100),
+            Prefix[Severity], Prefix[Severity][0] != '\0' ? " " : "", pSource, message);
+}
+
+//------------------------------------------------------------------------------
+// CTimer
+//------------------------------------------------------------------------------
+
+CTimer *CTimer::Get(void)
+{
+    static CTimer s_Timer;
+    return &s_Timer;
+}
+
+unsigned CTimer::GetTicks(void) const
+{
+    return static_cast<unsigned>(ElapsedMicros() * HZ / 1000000ULL);
+}
+
+unsigned CTimer::GetClockTicks(void)
+{
+    return static_cast<unsigned>(ElapsedMicros());
+}
+
+u64 CTimer::GetClockTicks64(void)
+{
+    return ElapsedMicros();
+}
+
+void CTimer::SimpleMsDelay(unsigned nMilliSeconds)
+{
+    usleep(nMilliSeconds * 1000);
+}
+
+void CTimer::SimpleusDelay(unsigned nMicroSeconds)
+{
+    usleep(nMicroSeconds);
+}
+
+//------------------------------------------------------------------------------
+// CTask / CScheduler
+//------------------------------------------------------------------------------
+
+CTask::CTask(unsigned nStackSize, boolean bCreateSuspended)
+    : m_bSuspended(bCreateSuspended),
+      m_bRunning(FALSE)
+{
+    (void)nStackSize;
+}
+
+CTask::~CTask(void)
+{
+    if (m_Thread.joinable())
+    {
+        m_Thread.detach();
+    }
+}
+
+void CTask::Resume(void)
+{
+    m_bSuspended = FALSE;
+    if (m_bRunning)
+    {
+        return;
+    }
+
+    // Run() returned after an earlier Suspend(); the old thread is done with the lock
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+    m_bRunning = TRUE;
+    m_Thread = std::thread(&CTask::ThreadMain, this);
+}
+
+void CTask::ThreadMain(void)
+{
+    g_SchedulerLock.lock();
+    Run();
+    m_bRunning = FALSE;
+    g_SchedulerLock.unlock();
+}
+
+CScheduler *CScheduler::Get(void)
+{
+    static CScheduler s_Scheduler;
+    return &s_Scheduler;
+}
+
+void CScheduler::Yield(void)
+{
+    // A bare unlock/lock pair would let the same thread win again; give others a slot
+    g_SchedulerLock.unlock();
+    std::this_thread::sleep_for(std::chrono::microseconds(500));
+    g_SchedulerLock.lock();
+}
+
+void CScheduler::MsSleep(unsigned nMilliSeconds)
+{
+    g_SchedulerLock.unlock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(nMilliSeconds));
+    g_SchedulerLock.lock();
+}
+
+void CScheduler::usSleep(unsigned nMicroSeconds)
+{
+    g_SchedulerLock.unlock();
+    std::this_thread::sleep_for(std::chrono::microseconds(nMicroSeconds));
+    g_SchedulerLock.lock();
+}
+
+void CScheduler::Lock(void)
+{
+    g_SchedulerLock.lock();
+}
+
+void CScheduler::Unlock(void)
+{
+    g_SchedulerLock.unlock();
+}
+
+//------------------------------------------------------------------------------
+// CDeviceNameService
+//------------------------------------------------------------------------------
+
+CDeviceNameService *CDeviceNameService::Get(void)
+{
+    static CDeviceNameService s_Service;
+    return &s_Service;
+}
+
+void CDeviceNameService::AddDevice(const char *pPrefix, unsigned nIndex, CDevice *pDevice, boolean bBlockDevice)
+{
+    (void)pPrefix;
+    (void)nIndex;
+    (void)bBlockDevice;
+    m_pDevice = pDevice;
+}
+
+void CDeviceNameService::RemoveDevice(const char *pPrefix, unsigned nIndex, boolean bBlockDevice)
+{
+    (void)pPrefix;
+    (void)nIndex;
+    (void)bBlockDevice;
+    m_pDevice = nullptr;
+}
+
+CDevice *CDeviceNameService::GetDevice(const char *pPrefix, unsigned nIndex, boolean bBlockDevice)
+{
+    (void)pPrefix;
+    (void)nIndex;
+    (void)bBlockDevice;
+    return m_pDevice;
+}
+
+//------------------------------------------------------------------------------
+// CString
+//------------------------------------------------------------------------------
+
+void CString::Format(const char *pFormat, ...)
+{
+    va_list args;
+    va_start(args, pFormat);
+    FormatV(pFormat, args);
+    va_end(args);
+}
+
+void CString::FormatV(const char *pFormat, va_list Args)
+{
+    va_list copy;
+    va_copy(copy, Args);
+    int length = vsnprintf(nullptr, 0, pFormat, copy);
+    va_end(copy);
+
+    if (length < 0)
+    {
+        m_String.clear();
+        return;
+    }
+    m_String.resize(static_cast<size_t>(length) + 1);
+    vsnprintf(&m_String[0], m_String.size(), pFormat, Args);
+    m_String.resize(static_cast<size_t>(length));
+}
+
+//------------------------------------------------------------------------------
+// CCharGenerator
+//------------------------------------------------------------------------------
+
+CCharGenerator::CCharGenerator(const TFont &rFont, TFontFlags Flags)
+    : m_rFont(rFont),
+      m_bDoubleWidth((Flags & FontFlagsDoubleWidth) != 0),
+      m_bDoubleHeight((Flags & FontFlagsDoubleHeight) != 0),
+      m_nCharWidth(rFont.width * (m_bDoubleWidth ? 2 : 1)),
+      m_nCharHeight((rFont.height + rFont.extra_height) * (m_bDoubleHeight ? 2 : 1)),
+      m_nUnderline(rFont.height * (m_bDoubleHeight ? 2 : 1)),
+      m_nFirstBit(static_cast<TPixelLine>(1u) << (rFont.width - 1))
+{
+}
+
+CCharGenerator::TPixelLine CCharGenerator::GetPixelLine(char chAscii, unsigned nPosY) const
+{
+    unsigned nAscii = static_cast<u8>(chAscii);
+    if (nAscii < m_rFont.first_char || nAscii > m_rFont.last_char)
+    {
+        return 0;
+    }
+    nAscii -= m_rFont.first_char;
+
+    if (m_bDoubleHeight)
+    {
+        nPosY /= 2;
+    }
+    if (nPosY >= m_rFont.height)
+    {
+        return 0;
+    }
+
+    const unsigned index = nAscii * m_rFont.height + nPosY;
+    if (m_rFont.width <= 8)
+    {
+        return static_cast<const u8 *>(m_rFont.data)[index];
+    }
+    return static_cast<const u16 *>(m_rFont.data)[index];
+}
+
+//------------------------------------------------------------------------------
+// CBcmFrameBuffer
+//------------------------------------------------------------------------------
+
+CBcmFrameBuffer::CBcmFrameBuffer(unsigned nWidth, unsigned nHeight, unsigned nDepth,
+                                 unsigned nVirtualWidth, unsigned nVirtualHeight,
+                                 unsigned nDisplay)
+    : CDisplay(nDepth),
+      m_nWidth(nWidth != 0 ? nWidth : g_DisplayWidth),
+      m_nHeight(nHeight != 0 ? nHeight : g_DisplayHeight),
+      m_nPitch(0),
+      m_pBuffer(nullptr)
+{
+    (void)nVirtualWidth;
+    (void)nVirtualHeight;
+    (void)nDisplay;
+}
+
+CBcmFrameBuffer::~CBcmFrameBuffer(void)
+{
+    if (g_pBufferProvider == nullptr)
+    {
+        delete[] m_pBuffer;
+    }
+    if (g_pFrameBuffer == this)
+    {
+        g_pFrameBuffer = nullptr;
+    }
+}
+
+boolean CBcmFrameBuffer::Initialize(void)
+{
+    m_nPitch = m_nWidth * GetDepth() / 8;
+    const size_t size = static_cast<size_t>(m_nPitch) * m_nHeight;
+
+    m_pBuffer = g_pBufferProvider != nullptr ? g_pBufferProvider(size, m_nWidth, m_nHeight, GetDepth())
+                                             : new u8[size];
+    if (m_pBuffer == nullptr)
+    {
+        return FALSE;
+    }
+    memset(m_pBuffer, 0, size);
+
+    g_pFrameBuffer = this;
+    return TRUE;
+}
+
+void CBcmFrameBuffer::SetPixel(unsigned nPosX, unsigned nPosY, TRawColor nColor)
+{
+    if (nPosX >= m_nWidth || nPosY >= m_nHeight)
+    {
+        return;
+    }
+
+    u8 *pPixel = m_pBuffer + nPosY * m_nPitch + nPosX * GetDepth() / 8;
+    if (GetDepth() == 16)
+    {
+        *reinterpret_cast<u16 *>(pPixel) = static_cast<u16>(nColor);
+    }
+    else if (GetDepth() == 32)
+    {
+        *reinterpret_cast<u32 *>(pPixel) = nColor;
+    }
+    else
+    {
+        *pPixel = static_cast<u8>(nColor);
+    }
+
+    if (g_pDamageHook != nullptr)
+    {
+        const TArea area = {nPosX, nPosX, nPosY, nPosY};
+        g_pDamageHook(area);
+    }
+}
+
+void CBcmFrameBuffer::SetArea(const TArea &rArea, const void *pPixels)
+{
+    if (rArea.x2 < rArea.x1 || rArea.y2 < rArea.y1 || rArea.x2 >= m_nWidth || rArea.y2 >= m_nHeight)
+    {
+        return;
+    }
+
+    // Source pixels are packed per area row, as with Circle's DMA-based SetArea()
+    const unsigned bytesPerPixel = GetDepth() / 8;
+    const size_t rowBytes = static_cast<size_t>(rArea.x2 - rArea.x1 + 1) * bytesPerPixel;
+    const u8 *pSource = static_cast<const u8 *>(pPixels);
+
+    for (unsigned y = rArea.y1; y <= rArea.y2; ++y)
+    {
+        memcpy(m_pBuffer + y * m_nPitch + rArea.x1 * bytesPerPixel, pSource, rowBytes);
+        pSource += rowBytes;
+    }
+
+    if (g_pDamageHook != nullptr)
+    {
+        g_pDamageHook(rArea);
+    }
+}
+
+//------------------------------------------------------------------------------
+// HostDisplay hooks
+//------------------------------------------------------------------------------
+
+void HostDisplay::SetGeometry(unsigned nWidth, unsigned nHeight)
+{
+    g_DisplayWidth = nWidth;
+    g_DisplayHeight = nHeight;
+}
+
+void HostDisplay::SetBufferProvider(u8 *(*pProvider)(size_t, unsigned, unsigned, unsigned))
+{
+    g_pBufferProvider = pProvider;
+}
+
+void HostDisplay::SetDamageHook(void (*pHook)(const CDisplay::TArea &))
+{
+    g_pDamageHook = pHook;
+}
+
+CBcmFrameBuffer *HostDisplay::GetFrameBuffer(void)
+{
+    return g_pFrameBuffer;
+}
+
+//------------------------------------------------------------------------------
+// CHAL
+//------------------------------------------------------------------------------
+
+CHAL *CHAL::Get(void)
+{
+    static CHAL s_HAL;
+    return &s_HAL;
+}
+
+void CHAL::BEEP(void)
+{
+    fputc('\a', stderr);
+}
+
+//------------------------------------------------------------------------------
+// FatFs
+//------------------------------------------------------------------------------
+
+void HostSetDriveRoot(const char *pDirectory)
+{
+    g_DriveRoot = pDirectory != nullptr ? pDirectory : ".";
+}
+
+FRESULT f_open(FIL *fp, const char *path, BYTE mode)
+{
+    if (fp == nullptr || path == nullptr)
+    {
+        return FR_INVALID_NAME;
+    }
+
+    // "SD:/name" and "SD:name" both resolve below the configured drive root
+    const char *pRelative = path;
+    const char *pColon = strchr(path, ':');
+    if (pColon != nullptr)
+    {
+        pRelative = pColon + 1;
+    }
+    while (*pRelative == '/')
+    {
+        ++pRelative;
+    }
+    const std::string hostPath = g_DriveRoot + "/" + pRelative;
+
+    const char *pMode = "rb";
+    if (mode & FA_WRITE)
+    {
+        if ((mode & FA_OPEN_APPEND) == FA_OPEN_APPEND)
+        {
+            pMode = "ab";
+        }
+        else if (mode & FA_CREATE_ALWAYS)
+        {
+            pMode = "wb";
+        }
+        else
+        {
+            pMode = "r+b";
+        }
+    }
+
+    fp->fp = fopen(hostPath.c_str(), pMode);
+    if (fp->fp == nullptr && (mode & (FA_OPEN_ALWAYS | FA_CREATE_NEW)))
+    {
+        fp->fp = fopen(hostPath.c_str(), "w+b");
+    }
+    return fp->fp != nullptr ? FR_OK : FR_NO_FILE;
+}
+
+FRESULT f_close(FIL *fp)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return FR_INT_ERR;
+    }
+    fclose(fp->fp);
+    fp->fp = nullptr;
+    return FR_OK;
+}
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return FR_INT_ERR;
+    }
+    *br = static_cast<UINT>(fread(buff, 1, btr, fp->fp));
+    return ferror(fp->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+FRESULT f_write(FIL *fp, const void *buff, UINT btw, UINT *bw)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return FR_INT_ERR;
+    }
+    *bw = static_cast<UINT>(fwrite(buff, 1, btw, fp->fp));
+    return *bw == btw ? FR_OK : FR_DISK_ERR;
+}
+
+FRESULT f_sync(FIL *fp)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return FR_INT_ERR;
+    }
+    return fflush(fp->fp) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return FR_INT_ERR;
+    }
+    return fseek(fp->fp, static_cast<long>(ofs), SEEK_SET) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+FSIZE_t f_size(FIL *fp)
+{
+    if (fp == nullptr || fp->fp == nullptr)
+    {
+        return 0;
+    }
+    long current = ftell(fp->fp);
+    fseek(fp->fp, 0, SEEK_END);
+    long size = ftell(fp->fp);
+    fseek(fp->fp, current, SEEK_SET);
+    return size < 0 ? 0 : static_cast<FSIZE_t>(size);
+}
@@ -0,0 +1,50 @@
+// Host shim for FatFs <fatfs/ff.h>; "SD:/..." paths map to a host directory
+#pragma once
+
+#include <stdio.h>
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef unsigned long DWORD;
+typedef unsigned long FSIZE_t;
+
+typedef enum
+{
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NO_FILE,
+    FR_NO_PATH,
+    FR_INVALID_NAME,
+    FR_DENIED
+} FRESULT;
+
+#define FA_READ 0x01
+#define FA_WRITE 0x02
+#define FA_OPEN_EXISTING 0x00
+#define FA_CREATE_NEW 0x04
+#define FA_CREATE_ALWAYS 0x08
+#define FA_OPEN_ALWAYS 0x10
+#define FA_OPEN_APPEND 0x30
+
+typedef struct
+{
+    FILE *fp;
+} FIL;
+
+typedef struct
+{
+    int unused;
+} FATFS;
+
+FRESULT f_open(FIL *fp, const char *path, BYTE mode);
+FRESULT f_close(FIL *fp);
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br);
+FRESULT f_write(FIL *fp, const void *buff, UINT btw, UINT *bw);
+FRESULT f_sync(FIL *fp);
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs);
+FSIZE_t f_size(FIL *fp);
+
+/// Host only: directory that stands in for the SD card root (default ".")
+void HostSetDriveRoot(const char *pDirectory);
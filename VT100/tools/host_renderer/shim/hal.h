@@ -0,0 +1,10 @@
+// Host stand-in for VT100/include/hal.h: bell goes to the host terminal
+#pragma once
+
+class CHAL
+{
+public:
+    static CHAL *Get(void);
+
+    void BEEP(void);
+};
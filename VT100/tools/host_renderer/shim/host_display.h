@@ -0,0 +1,19 @@
+// Host-only hooks for the CBcmFrameBuffer shim
+#pragma once
+
+#include <circle/display.h>
+
+namespace HostDisplay
+{
+    /// Geometry reported by CBcmFrameBuffer::Initialize() (default 1024x768)
+    void SetGeometry(unsigned nWidth, unsigned nHeight);
+
+    /// Optional external pixel memory (e.g. shared memory); nullptr = heap
+    void SetBufferProvider(u8 *(*pProvider)(size_t nSize, unsigned nWidth, unsigned nHeight, unsigned nDepth));
+
+    /// Called after every SetArea()/SetPixel() with the touched rows
+    void SetDamageHook(void (*pHook)(const CDisplay::TArea &rArea));
+
+    /// Frame buffer created by the renderer, nullptr before Initialize()
+    class CBcmFrameBuffer *GetFrameBuffer(void);
+}
@@ -0,0 +1,4 @@
+// Host stand-in for VT100/include/kernel.h: the host build has no CKernel
+#pragma once
+
+class CKernel;